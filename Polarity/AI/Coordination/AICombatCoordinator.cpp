@@ -1,11 +1,15 @@
 // AICombatCoordinator.cpp
 
 #include "AICombatCoordinator.h"
+#include "AILineOfSightSubsystem.h"
 #include "Coop/CoopPlayers.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
+#include "EngineUtils.h"
+#include "Components/SceneComponent.h"
+#include "HAL/IConsoleManager.h"
 #include "ShooterNPC.h"
 #include "MeleeNPC.h"
 #include "FlyingDrone.h"
@@ -13,6 +17,94 @@
 #include "ShooterCharacter.h"
 #include "ShooterAIController.h"
 #include "ThreatComponent.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarAICoordinatorTimeSlice(
+	TEXT("AI.Coordinator.TimeSlice"),
+	1,
+	TEXT("1=attack scoring and battle slots are spread over several coordinator ticks, 0=every NPC every tick"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAICoordinatorBudgetMs(
+	TEXT("AI.Coordinator.BudgetMs"),
+	0.5f,
+	TEXT("Coordinator tick time (ms) after which the sliced phases stop and leave the rest for the next tick"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAICoordinatorScoresPerTick(
+	TEXT("AI.Coordinator.ScoresPerTick"),
+	16,
+	TEXT("Most NPCs in engagement range whose attack score (and line of sight) is refreshed per coordinator tick"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAICoordinatorSlotNPCsPerTick(
+	TEXT("AI.Coordinator.SlotNPCsPerTick"),
+	48,
+	TEXT("Most NPCs given battle slots per coordinator tick; a group is done whole, and the first due group always is"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAICoordinatorStrafeCache(
+	TEXT("AI.Coordinator.StrafeCache"),
+	1,
+	TEXT("1=strafe slots read a shared clearance ring per target refreshed by async traces, 0=each request traces its own ring"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GAICoordinatorReportCmd(
+	TEXT("AI.Coordinator.Report"),
+	TEXT("Print combat coordinator tick cost and NPCs processed per phase since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		// Not GetCoordinator: asking for a report should not spawn one
+		if (World)
+		{
+			for (TActorIterator<AAICombatCoordinator> It(World); It; ++It)
+			{
+				It->ReportStats();
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GAICoordinatorStressCmd(
+	TEXT("AI.Coordinator.Stress"),
+	TEXT("Register N placeholder NPCs (default 200), time lookups and coordinator ticks over them, then remove them"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumNPCs = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+		if (AAICombatCoordinator* Coordinator = AAICombatCoordinator::GetCoordinator(World))
+		{
+			Coordinator->RunStressTest(NumNPCs);
+		}
+	}));
+
+DECLARE_STATS_GROUP(TEXT("AI Combat Coordinator"), STATGROUP_AICoordinator, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Tick"), STAT_AICoordinator_Tick, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Targets & Groups"), STAT_AICoordinator_Targets, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Tokens"), STAT_AICoordinator_Tokens, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Scoring"), STAT_AICoordinator_Scoring, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Permissions"), STAT_AICoordinator_Permissions, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Roles"), STAT_AICoordinator_Roles, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Battle Slots"), STAT_AICoordinator_Slots, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Debug"), STAT_AICoordinator_Debug, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Strafe Clearance"), STAT_AICoordinator_StrafeClearance, STATGROUP_AICoordinator);
+DECLARE_CYCLE_STAT(TEXT("Strafe Requests"), STAT_AICoordinator_StrafeRequests, STATGROUP_AICoordinator);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Strafe Requests"), STAT_AICoordinator_StrafeRequestCount, STATGROUP_AICoordinator);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Strafe Traces"), STAT_AICoordinator_StrafeTraces, STATGROUP_AICoordinator);
+// Accumulators rather than counters: the coordinator ticks at 10Hz, and a counter would read zero
+// on every frame in between
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered NPCs"), STAT_AICoordinator_Registered, STATGROUP_AICoordinator);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Groups"), STAT_AICoordinator_Groups, STATGROUP_AICoordinator);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NPCs Scored"), STAT_AICoordinator_Scored, STATGROUP_AICoordinator);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NPCs Slotted"), STAT_AICoordinator_Slotted, STATGROUP_AICoordinator);
+
+namespace CombatCoordinator
+{
+	/** Clearance rings no drone asked about for this long are dropped */
+	static constexpr double StrafeClearanceExpirySeconds = 2.0;
+
+	/** Rings are traced this much past the orbit that asked, so a drone a little further out does
+	 *  not force another synchronous ring */
+	static constexpr float StrafeClearanceLengthSlack = 1.25f;
+}
 
 // ==================== FTokenPool ====================
 
@@ -92,87 +184,124 @@ void AAICombatCoordinator::BeginPlay()
 	PrimaryTarget = CoopPlayers::GetNearest(GetWorld(), GetActorLocation());
 }
 
+void AAICombatCoordinator::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// A strafe clearance probe issued this frame would otherwise write into a map that is about to be emptied
+	StrafeTraceDelegate.Unbind();
+	ClearanceMaps.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AAICombatCoordinator::Tick(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Tick);
+	const double StartTime = FPlatformTime::Seconds();
+
 	Super::Tick(DeltaTime);
 
 	TimeSinceLastAttackGrant += DeltaTime;
 
-	// Cleanup first: targeting below walks the registered list and should not walk corpses.
-	CleanupInvalidNPCs();
+	// The sliced phases below get whatever the every-tick phases leave of this
+	const bool bTimeSlice = CVarAICoordinatorTimeSlice.GetValueOnGameThread() != 0;
+	const double Deadline = bTimeSlice
+		? StartTime + FMath::Max(CVarAICoordinatorBudgetMs.GetValueOnGameThread(), 0.0f) / 1000.0
+		: TNumericLimits<double>::Max();
 
-	// Who each NPC is fighting, remembered between frames. This also derives PrimaryTarget, so the
-	// old "re-find the nearest player to the coordinator actor" is gone — that answer had nothing to
-	// do with where the fighting was.
-	UpdateNPCTargets(DeltaTime);
-
-	if (!PrimaryTarget.IsValid())
 	{
-		PrimaryTarget = CoopPlayers::GetNearest(GetWorld(), GetActorLocation());
-	}
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Targets);
 
-	// Groups follow from the targets decided just above.
-	RebuildTargetGroups();
+		// Cleanup first: targeting below walks the registered list and should not walk corpses.
+		CleanupInvalidNPCs();
 
-	// Token pools
-	UpdateTokenPools();
-	UpdateKamikazeTokenPoolSize();
-	UpdateProximityOverrides();
-	for (FTargetGroup& Group : Groups)
+		// Who each NPC is fighting, remembered between frames. This also derives PrimaryTarget, so the
+		// old "re-find the nearest player to the coordinator actor" is gone — that answer had nothing to
+		// do with where the fighting was.
+		UpdateNPCTargets(DeltaTime);
+
+		if (!PrimaryTarget.IsValid())
+		{
+			PrimaryTarget = CoopPlayers::GetNearest(GetWorld(), GetActorLocation());
+		}
+
+		// Groups follow from the targets decided just above.
+		RebuildTargetGroups();
+	}
+
+	// Token pools. Every tick: these are what RequestAttackPermission grants from.
 	{
-		Group.Ranged.CleanupInvalid();
-		Group.Melee.CleanupInvalid();
-		Group.Special.CleanupInvalid();
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Tokens);
+
+		UpdateTokenPools();
+		UpdateKamikazeTokenPoolSize();
+		UpdateProximityOverrides();
+		for (FTargetGroup& Group : Groups)
+		{
+			Group.Ranged.CleanupInvalid();
+			Group.Melee.CleanupInvalid();
+			Group.Special.CleanupInvalid();
+		}
+		KamikazeTokenPool.CleanupInvalid();
 	}
-	KamikazeTokenPool.CleanupInvalid();
 
-	// Scores
-	UpdateAttackScores();
+	// Scores. Each one is a LOS query, and nothing grants on them, so they can trail by a few ticks.
+	// Nothing else reads them either: token grants, roles and slots are decided without the score,
+	// which only shows up in the bDrawDebug labels. Without those labels there is nobody to score for.
+	if (bDrawDebug)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Scoring);
 
-	// Permission timeouts
-	UpdatePermissionTimeouts(DeltaTime);
+		const int32 MaxScored = bTimeSlice ? FMath::Max(CVarAICoordinatorScoresPerTick.GetValueOnGameThread(), 1) : MAX_int32;
+		const int32 Scored = UpdateAttackScores(MaxScored, Deadline);
+		TotalScored += Scored;
+		SET_DWORD_STAT(STAT_AICoordinator_Scored, Scored);
+	}
 
-	// Wait times
-	for (FRegisteredNPCData& Data : RegisteredNPCs)
 	{
-		if (!Data.bHasAttackPermission && !Data.bIsCurrentlyAttacking)
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Permissions);
+
+		// Permission timeouts
+		UpdatePermissionTimeouts(DeltaTime);
+
+		// Wait times
+		for (FRegisteredNPCData& Data : RegisteredNPCs)
 		{
-			Data.WaitTime += DeltaTime;
+			if (!Data.bHasAttackPermission && !Data.bIsCurrentlyAttacking)
+			{
+				Data.WaitTime += DeltaTime;
+			}
 		}
 	}
 
-	// Player state cache, one per group
-	for (FTargetGroup& Group : Groups)
 	{
-		UpdatePlayerStateCacheForGroup(Group);
-	}
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Roles);
+
+		// Player state cache, one per group
+		for (FTargetGroup& Group : Groups)
+		{
+			UpdatePlayerStateCacheForGroup(Group);
+		}
 
-	// Role assignment
-	AssignRoles();
+		// Role assignment
+		AssignRoles();
+	}
 
 	// Battle Circle, one ring per group. Each group keeps its own clock and its own member count, so
 	// an enemy joining the fight around one player does not rebuild the formation around another.
 	if (bUseBattleCircle)
 	{
-		for (FTargetGroup& Group : Groups)
-		{
-			Group.TimeSinceLastSlotRecalc += DeltaTime;
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Slots);
 
-			const int32 ActiveNPCCount = Group.Members.Num();
-			if (ActiveNPCCount != Group.LastSlotNPCCount || Group.BattleSlots.Num() == 0)
-			{
-				GenerateBattleSlotsForGroup(Group);
-				AssignNPCsToSlotsForGroup(Group);
-				Group.LastSlotNPCCount = ActiveNPCCount;
-				Group.TimeSinceLastSlotRecalc = 0.0f;
-			}
-			else if (Group.TimeSinceLastSlotRecalc >= SlotRecalculationInterval)
-			{
-				RecalculateSlotPositionsForGroup(Group);
-				AssignNPCsToSlotsForGroup(Group);
-				Group.TimeSinceLastSlotRecalc = 0.0f;
-			}
-		}
+		const int32 MaxSlotted = bTimeSlice ? FMath::Max(CVarAICoordinatorSlotNPCsPerTick.GetValueOnGameThread(), 1) : MAX_int32;
+		const int32 Slotted = UpdateBattleSlots(DeltaTime, MaxSlotted, Deadline);
+		TotalSlotted += Slotted;
+		SET_DWORD_STAT(STAT_AICoordinator_Slotted, Slotted);
+	}
+
+	// Strafe clearance rings: refreshed here, in the background, so drone requests only read them
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_StrafeClearance);
+		UpdateStrafeClearance();
 	}
 
 	// Enemy cluster direction (for kamikaze orbit bias)
@@ -196,18 +325,169 @@ void AAICombatCoordinator::Tick(float DeltaTime)
 	}
 
 	// Debug drawing
-	if (bDrawDebug)
 	{
-		DrawDebugInfo();
+		SCOPE_CYCLE_COUNTER(STAT_AICoordinator_Debug);
+
+		if (bDrawDebug)
+		{
+			DrawDebugInfo();
+		}
+		if (bDrawBattleCircle)
+		{
+			DrawBattleCircleDebug();
+		}
+		if (bDrawRoleDebug)
+		{
+			DrawRoleDebug();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AICoordinator_Registered, RegisteredNPCs.Num());
+	SET_DWORD_STAT(STAT_AICoordinator_Groups, Groups.Num());
+
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+	if (TotalTicks == 0)
+	{
+		FirstTickFrame = GFrameCounter;
+	}
+	++TotalTicks;
+	TotalSeconds += Seconds;
+	PeakSeconds = FMath::Max(PeakSeconds, Seconds);
+	PeakRegistered = FMath::Max(PeakRegistered, RegisteredNPCs.Num());
+}
+
+void AAICombatCoordinator::ReportStats() const
+{
+	const double AvgTickMs = TotalTicks > 0 ? 1000.0 * TotalSeconds / static_cast<double>(TotalTicks) : 0.0;
+
+	// Spread over every frame since the first tick, ticked or not: what the coordinator costs the game
+	const uint64 Frames = GFrameCounter > FirstTickFrame ? GFrameCounter - FirstTickFrame : 1;
+	const double AvgFrameMs = TotalTicks > 0 ? 1000.0 * TotalSeconds / static_cast<double>(Frames) : 0.0;
+
+	const double ScoredPerTick = TotalTicks > 0 ? static_cast<double>(TotalScored) / static_cast<double>(TotalTicks) : 0.0;
+	const double TracesPerStrafeRequest = TotalStrafeRequests > 0
+		? static_cast<double>(TotalStrafeSyncTraces + TotalStrafeAsyncTraces) / static_cast<double>(TotalStrafeRequests) : 0.0;
+	const double SlottedPerTick = TotalTicks > 0 ? static_cast<double>(TotalSlotted) / static_cast<double>(TotalTicks) : 0.0;
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[COORDINATOR] npcs=%d peak=%d groups=%d | tick avg=%.3f ms peak=%.3f ms, %.4f ms/frame over %llu ticks | scored=%llu (%.1f/tick) slotted=%llu (%.1f/tick) slot groups deferred=%llu | slice=%d budget=%.2f ms"),
+		RegisteredNPCs.Num(), PeakRegistered, Groups.Num(),
+		AvgTickMs, PeakSeconds * 1000.0, AvgFrameMs, TotalTicks,
+		TotalScored, ScoredPerTick, TotalSlotted, SlottedPerTick, TotalSlotGroupsDeferred,
+		CVarAICoordinatorTimeSlice.GetValueOnGameThread(), CVarAICoordinatorBudgetMs.GetValueOnGameThread());
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[COORDINATOR] strafe requests=%llu traces sync=%llu async=%llu (%.2f per request) rings=%d slots=%d | cache=%d"),
+		TotalStrafeRequests, TotalStrafeSyncTraces, TotalStrafeAsyncTraces, TracesPerStrafeRequest,
+		ClearanceMaps.Num(), StrafeSlots.Num(), CVarAICoordinatorStrafeCache.GetValueOnGameThread());
+}
+
+void AAICombatCoordinator::RunStressTest(int32 NumNPCs)
+{
+	UWorld* World = GetWorld();
+	if (!World || NumNPCs <= 0)
+	{
+		return;
 	}
-	if (bDrawBattleCircle)
+
+	// Plain pawns on the rings around the fight: no controller, no tick, no collision. Enough for
+	// every lookup, group and slot path here, and none of their own cost in the numbers.
+	const FVector Origin = PrimaryTarget.IsValid() ? PrimaryTarget->GetActorLocation() : GetActorLocation();
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	// The run gets a coordinator of its own. Registering the placeholders here and ticking this one
+	// would let them take tokens, slots and groups from the real NPCs and move the real fight on by
+	// a couple of seconds; the probe sees nobody but the placeholders and is gone afterwards.
+	AAICombatCoordinator* Probe = World->SpawnActor<AAICombatCoordinator>(GetClass(), GetActorTransform(), SpawnParams);
+	if (!Probe)
 	{
-		DrawBattleCircleDebug();
+		return;
 	}
-	if (bDrawRoleDebug)
+	Instance = this; // the probe's BeginPlay claimed the singleton
+	Probe->SetActorTickEnabled(false);
+
+	// Ticks with the drawing and the log snapshot off, which would otherwise be most of what is timed.
+	// Attack scoring goes with the drawing: it only exists for the debug labels.
+	Probe->bDrawDebug = Probe->bDrawBattleCircle = Probe->bDrawRoleDebug = Probe->bLogStateSnapshot = false;
+
+	TArray<APawn*> Pawns;
+	Pawns.Reserve(NumNPCs);
+	for (int32 i = 0; i < NumNPCs; ++i)
 	{
-		DrawRoleDebug();
+		APawn* Pawn = World->SpawnActor<APawn>(APawn::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		// APawn has no root of its own, and a pawn with no location is no use to a battle circle
+		USceneComponent* Root = NewObject<USceneComponent>(Pawn, TEXT("StressRoot"));
+		Pawn->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		const float Angle = 2.0f * PI * static_cast<float>(i) / static_cast<float>(NumNPCs);
+		const float Radius = FMath::Lerp(InnerRingMinRadius, OuterRingMaxRadius, static_cast<float>(i % 7) / 6.0f);
+		Pawn->SetActorLocation(Origin + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f));
+		Pawn->SetActorTickEnabled(false);
+		Pawns.Add(Pawn);
+	}
+
+	double Start = FPlatformTime::Seconds();
+	for (APawn* Pawn : Pawns)
+	{
+		Probe->RegisterNPC(Pawn);
+	}
+	const double RegisterMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	// The queries the StateTree tasks and weapons make per NPC, several times a tick each
+	constexpr int32 QueryRounds = 20;
+	Start = FPlatformTime::Seconds();
+	int32 Hits = 0;
+	for (int32 Round = 0; Round < QueryRounds; ++Round)
+	{
+		for (APawn* Pawn : Pawns)
+		{
+			Probe->SetNPCRole(Pawn, Probe->GetNPCRole(Pawn));
+			Hits += Probe->HasAttackPermission(Pawn) ? 1 : 0;
+			Hits += Probe->HasAttackToken(Pawn) ? 1 : 0;
+			Hits += Probe->FindGroupFor(Pawn) ? 1 : 0;
+		}
 	}
+	const int32 NumQueries = QueryRounds * Pawns.Num() * 5;
+	const double QueryNs = NumQueries > 0 ? (FPlatformTime::Seconds() - Start) * 1e9 / NumQueries : 0.0;
+
+	constexpr int32 NumTicks = 20;
+	const float TickDelta = FMath::Max(PrimaryActorTick.TickInterval, 0.1f);
+	double TickSeconds = 0.0;
+	double PeakTickSeconds = 0.0;
+	for (int32 i = 0; i < NumTicks; ++i)
+	{
+		Start = FPlatformTime::Seconds();
+		Probe->Tick(TickDelta);
+		const double Seconds = FPlatformTime::Seconds() - Start;
+		TickSeconds += Seconds;
+		PeakTickSeconds = FMath::Max(PeakTickSeconds, Seconds);
+	}
+
+	const int32 GroupsDuring = Probe->Groups.Num();
+
+	Start = FPlatformTime::Seconds();
+	for (APawn* Pawn : Pawns)
+	{
+		Probe->UnregisterNPC(Pawn);
+	}
+	const double UnregisterMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	for (APawn* Pawn : Pawns)
+	{
+		Pawn->Destroy();
+	}
+	Probe->Destroy();
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[COORDINATOR] stress npcs=%d groups=%d | register=%.3f ms unregister=%.3f ms | queries=%.0f ns each over %d (%d hits) | tick avg=%.3f ms peak=%.3f ms over %d ticks | slice=%d"),
+		Pawns.Num(), GroupsDuring, RegisterMs, UnregisterMs, QueryNs, NumQueries, Hits,
+		1000.0 * TickSeconds / NumTicks, 1000.0 * PeakTickSeconds, NumTicks,
+		CVarAICoordinatorTimeSlice.GetValueOnGameThread());
 }
 
 // ==================== Singleton ====================
@@ -251,10 +531,12 @@ void AAICombatCoordinator::RegisterNPC(APawn* NPC)
 
 	FRegisteredNPCData NewData;
 	NewData.NPC = NPC;
+	NewData.Key = NPC;
 	NewData.Role = EAICombatRole::Supporter;
 	NewData.TokenType = DetermineTokenType(NPC);
 
-	RegisteredNPCs.Add(NewData);
+	// No group yet: it joins one when UpdateNPCTargets first gives it a target
+	NPCHandles.Add(NewData.Key, RegisteredNPCs.Add(MoveTemp(NewData)));
 }
 
 void AAICombatCoordinator::UnregisterNPC(APawn* NPC)
@@ -273,10 +555,10 @@ void AAICombatCoordinator::UnregisterNPC(APawn* NPC)
 	// Release strafe slot
 	ReleaseStrafeSlot(NPC);
 
-	RegisteredNPCs.RemoveAll([NPC](const FRegisteredNPCData& Data)
+	if (const int32* Handle = NPCHandles.Find(NPC))
 	{
-		return Data.NPC.Get() == NPC;
-	});
+		RemoveNPCAt(*Handle);
+	}
 }
 
 // ==================== Attack Permission (bridges to tokens) ====================
@@ -569,7 +851,7 @@ void AAICombatCoordinator::UpdateTokenPools()
 
 void AAICombatCoordinator::GenerateBattleSlotsForGroup(FTargetGroup& Group)
 {
-	Group.BattleSlots.Empty();
+	Group.BattleSlots.Reset();
 
 	// Count only THIS group's NPCs per preferred ring. The ring around a player is sized by the
 	// enemies fighting that player, not by everyone alive on the level.
@@ -671,6 +953,65 @@ EBattleRing AAICombatCoordinator::GetPreferredRing(const FRegisteredNPCData& Dat
 	return EBattleRing::Middle;
 }
 
+int32 AAICombatCoordinator::UpdateBattleSlots(float DeltaTime, int32 MaxNPCs, double Deadline)
+{
+	for (FTargetGroup& Group : Groups)
+	{
+		Group.TimeSinceLastSlotRecalc += DeltaTime;
+	}
+
+	const int32 NumGroups = Groups.Num();
+	if (NumGroups == 0)
+	{
+		SlotGroupCursor = 0;
+		return 0;
+	}
+
+	// A group that is passed over keeps its old slots and stays due, since neither its dirty flag nor
+	// its clock is reset, so it is picked up first next tick. Members that joined it meanwhile have no
+	// slot (or keep their old group's) for that long.
+	int32 Slotted = 0;
+	const int32 Start = SlotGroupCursor % NumGroups;
+	for (int32 Step = 0; Step < NumGroups; ++Step)
+	{
+		const int32 GroupIdx = (Start + Step) % NumGroups;
+		FTargetGroup& Group = Groups[GroupIdx];
+
+		const int32 ActiveNPCCount = Group.Members.Num();
+		const bool bMembershipChanged = Group.bSlotsDirty || Group.BattleSlots.Num() == 0;
+		if (!bMembershipChanged && Group.TimeSinceLastSlotRecalc < SlotRecalculationInterval)
+		{
+			continue;
+		}
+
+		// Groups are done whole: assignment is a greedy match over the group, half of one is worse
+		// than last tick's
+		if (Slotted > 0 && (Slotted + ActiveNPCCount > MaxNPCs || FPlatformTime::Seconds() > Deadline))
+		{
+			SlotGroupCursor = GroupIdx;
+			++TotalSlotGroupsDeferred;
+			return Slotted;
+		}
+
+		if (bMembershipChanged)
+		{
+			GenerateBattleSlotsForGroup(Group);
+			Group.bSlotsDirty = false;
+		}
+		else
+		{
+			RecalculateSlotPositionsForGroup(Group);
+		}
+		AssignNPCsToSlotsForGroup(Group);
+		Group.TimeSinceLastSlotRecalc = 0.0f;
+
+		Slotted += ActiveNPCCount;
+		SlotGroupCursor = (GroupIdx + 1) % NumGroups;
+	}
+
+	return Slotted;
+}
+
 void AAICombatCoordinator::AssignNPCsToSlotsForGroup(FTargetGroup& Group)
 {
 	// Clear this group's assignments only. Touching every registered NPC here would wipe the slot
@@ -688,7 +1029,8 @@ void AAICombatCoordinator::AssignNPCsToSlotsForGroup(FTargetGroup& Group)
 	}
 
 	// Only this group's NPCs compete for this group's slots.
-	TArray<int32> UnassignedNPCIndices;
+	TArray<int32>& UnassignedNPCIndices = SlotCandidates;
+	UnassignedNPCIndices.Reset();
 	for (int32 Index : Group.Members)
 	{
 		if (RegisteredNPCs.IsValidIndex(Index) && RegisteredNPCs[Index].NPC.IsValid())
@@ -770,7 +1112,8 @@ void AAICombatCoordinator::UpdateNPCTargets(float DeltaTime)
 
 	PruneDecoys();
 
-	TArray<APawn*> Players;
+	TArray<APawn*>& Players = PlayerScratch;
+	Players.Reset();
 	CoopPlayers::GetAll(World, Players);
 	if (Players.Num() == 0)
 	{
@@ -1130,31 +1473,25 @@ void AAICombatCoordinator::AssignRoles()
 	// one group having no valid state is no reason to leave every other enemy roleless.
 	bool bHasAggressor = false;
 
-	// Calculate angles
-	for (FRegisteredNPCData& Data : RegisteredNPCs)
+	// Calculate angles, and each NPC's distance once, rather than twice per comparison in the sort
+	RoleOrder.Reset();
+	for (auto It = RegisteredNPCs.CreateIterator(); It; ++It)
 	{
+		FRegisteredNPCData& Data = *It;
 		if (!Data.NPC.IsValid()) continue;
 		Data.AngleToPlayerFacing = CalculateAngleFromPlayerFacing(Data.NPC.Get());
+		RoleOrder.Emplace(GetDistanceToTarget(Data.NPC.Get()), It.GetIndex());
 	}
 
-	// Sort by distance (closest first) using index array
-	TArray<int32> SortedIndices;
-	for (int32 i = 0; i < RegisteredNPCs.Num(); ++i)
-	{
-		if (RegisteredNPCs[i].NPC.IsValid())
-		{
-			SortedIndices.Add(i);
-		}
-	}
-	SortedIndices.Sort([this](int32 A, int32 B)
+	// Sort by distance (closest first)
+	RoleOrder.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
 	{
-		return GetDistanceToTarget(RegisteredNPCs[A].NPC.Get()) <
-			   GetDistanceToTarget(RegisteredNPCs[B].NPC.Get());
+		return A.Key < B.Key;
 	});
 
-	for (int32 Idx : SortedIndices)
+	for (const TPair<float, int32>& Entry : RoleOrder)
 	{
-		FRegisteredNPCData& Data = RegisteredNPCs[Idx];
+		FRegisteredNPCData& Data = RegisteredNPCs[Entry.Value];
 
 		// Currently attacking → Aggressor
 		if (Data.bIsCurrentlyAttacking || Data.bHasAttackPermission)
@@ -1194,11 +1531,11 @@ void AAICombatCoordinator::AssignRoles()
 	}
 
 	// Guarantee at least 1 Aggressor
-	if (!bHasAggressor && SortedIndices.Num() > 0)
+	if (!bHasAggressor && RoleOrder.Num() > 0)
 	{
-		for (int32 Idx : SortedIndices)
+		for (const TPair<float, int32>& Entry : RoleOrder)
 		{
-			FRegisteredNPCData& Data = RegisteredNPCs[Idx];
+			FRegisteredNPCData& Data = RegisteredNPCs[Entry.Value];
 			if (Data.Role != EAICombatRole::Flanker)
 			{
 				Data.Role = EAICombatRole::Aggressor;
@@ -1209,7 +1546,7 @@ void AAICombatCoordinator::AssignRoles()
 		// If all are flankers, force closest
 		if (!bHasAggressor)
 		{
-			RegisteredNPCs[SortedIndices[0]].Role = EAICombatRole::Aggressor;
+			RegisteredNPCs[RoleOrder[0].Value].Role = EAICombatRole::Aggressor;
 		}
 	}
 }
@@ -1261,41 +1598,55 @@ void AAICombatCoordinator::SetPrimaryTarget(AActor* Target)
 
 FRegisteredNPCData* AAICombatCoordinator::FindNPCData(APawn* NPC)
 {
-	for (FRegisteredNPCData& Data : RegisteredNPCs)
-	{
-		if (Data.NPC.Get() == NPC)
-		{
-			return &Data;
-		}
-	}
-	return nullptr;
+	const int32* Handle = NPC ? NPCHandles.Find(NPC) : nullptr;
+	return Handle ? &RegisteredNPCs[*Handle] : nullptr;
 }
 
 const FRegisteredNPCData* AAICombatCoordinator::FindNPCData(APawn* NPC) const
 {
-	for (const FRegisteredNPCData& Data : RegisteredNPCs)
-	{
-		if (Data.NPC.Get() == NPC)
-		{
-			return &Data;
-		}
-	}
-	return nullptr;
+	const int32* Handle = NPC ? NPCHandles.Find(NPC) : nullptr;
+	return Handle ? &RegisteredNPCs[*Handle] : nullptr;
 }
 
-void AAICombatCoordinator::UpdateAttackScores()
+int32 AAICombatCoordinator::UpdateAttackScores(int32 MaxScored, double Deadline)
 {
-	for (FRegisteredNPCData& Data : RegisteredNPCs)
+	// Walks handles, holes included: the cursor has to mean the same NPC from one tick to the next
+	const int32 MaxIndex = RegisteredNPCs.GetMaxIndex();
+	if (RegisteredNPCs.Num() == 0)
 	{
-		if (IsNPCInEngagementRange(Data.NPC.Get()))
+		ScoringCursor = 0;
+		return 0;
+	}
+
+	// Out of range is a distance check and is not counted; only a real score (and its LOS) is
+	int32 Scored = 0;
+	int32 Index = ScoringCursor % MaxIndex;
+	for (int32 Step = 0; Step < MaxIndex; ++Step)
+	{
+		if (Scored >= MaxScored || (Scored > 0 && FPlatformTime::Seconds() > Deadline))
 		{
-			Data.AttackScore = CalculateAttackScore(Data);
+			break;
 		}
-		else
+
+		if (RegisteredNPCs.IsAllocated(Index))
 		{
-			Data.AttackScore = 0.0f;
+			FRegisteredNPCData& Data = RegisteredNPCs[Index];
+			if (IsNPCInEngagementRange(Data.NPC.Get()))
+			{
+				Data.AttackScore = CalculateAttackScore(Data);
+				++Scored;
+			}
+			else
+			{
+				Data.AttackScore = 0.0f;
+			}
 		}
+
+		Index = (Index + 1) % MaxIndex;
 	}
+
+	ScoringCursor = Index;
+	return Scored;
 }
 
 float AAICombatCoordinator::CalculateAttackScore(const FRegisteredNPCData& Data) const
@@ -1323,58 +1674,94 @@ float AAICombatCoordinator::CalculateAttackScore(const FRegisteredNPCData& Data)
 
 void AAICombatCoordinator::RebuildTargetGroups()
 {
-	// Membership is rebuilt from scratch every tick; the groups themselves are not, because their
-	// token pools hold live grants. @see FTargetGroup
-	for (FTargetGroup& Group : Groups)
+	// Membership persists like the groups do; only an NPC whose target is no longer its group's moves.
+	// In a settled fight that is nobody, and this is one comparison per NPC.
+	for (auto It = RegisteredNPCs.CreateIterator(); It; ++It)
 	{
-		Group.Members.Reset();
-	}
+		FRegisteredNPCData& Data = *It;
+		AActor* Target = Data.NPC.IsValid() ? Data.Target.Get() : nullptr;
+		const AActor* Current = Groups.IsValidIndex(Data.GroupIndex) ? Groups[Data.GroupIndex].Target.Get() : nullptr;
 
-	for (int32 i = 0; i < RegisteredNPCs.Num(); ++i)
-	{
-		FRegisteredNPCData& Data = RegisteredNPCs[i];
-		Data.GroupIndex = INDEX_NONE;
-
-		AActor* Target = Data.Target.Get();
-		if (!Data.NPC.IsValid() || !Target)
+		if (Target ? Target == Current : Data.GroupIndex == INDEX_NONE)
 		{
 			continue;
 		}
 
-		int32 GroupIdx = Groups.IndexOfByPredicate([Target](const FTargetGroup& G)
+		const int32 Handle = It.GetIndex();
+		LeaveGroup(Handle);
+		if (!Target)
 		{
-			return G.Target.Get() == Target;
-		});
+			continue;
+		}
 
+		int32 GroupIdx = FindGroupIndex(Target);
 		if (GroupIdx == INDEX_NONE)
 		{
 			FTargetGroup NewGroup;
 			NewGroup.Target = Target;
 			GroupIdx = Groups.Add(MoveTemp(NewGroup));
 		}
+		JoinGroup(Handle, GroupIdx);
+	}
 
-		Groups[GroupIdx].Members.Add(i);
-		Data.GroupIndex = GroupIdx;
+	// Retire groups nobody is fighting any more. A group whose player is gone has emptied itself
+	// above, since its members' targets went with it. Swap-removed, so only the members of the group
+	// moved into the hole need their index fixed.
+	for (int32 GroupIdx = Groups.Num() - 1; GroupIdx >= 0; --GroupIdx)
+	{
+		if (Groups[GroupIdx].Members.Num() > 0)
+		{
+			continue;
+		}
+
+		Groups.RemoveAtSwap(GroupIdx, 1, EAllowShrinking::No);
+		if (Groups.IsValidIndex(GroupIdx))
+		{
+			for (int32 Member : Groups[GroupIdx].Members)
+			{
+				RegisteredNPCs[Member].GroupIndex = GroupIdx;
+			}
+		}
 	}
+}
 
-	// Retire groups nobody is fighting any more. Removing invalidates indices, so the membership
-	// pass above is redone rather than patched — it is a handful of NPCs and it runs at 10Hz.
-	const int32 Removed = Groups.RemoveAll([](const FTargetGroup& G)
+int32 AAICombatCoordinator::FindGroupIndex(const AActor* Target) const
+{
+	return Groups.IndexOfByPredicate([Target](const FTargetGroup& G)
 	{
-		return !G.Target.IsValid() || G.Members.Num() == 0;
+		return G.Target.Get() == Target;
 	});
+}
+
+void AAICombatCoordinator::JoinGroup(int32 Handle, int32 GroupIdx)
+{
+	FRegisteredNPCData& Data = RegisteredNPCs[Handle];
+	FTargetGroup& Group = Groups[GroupIdx];
+
+	Data.GroupIndex = GroupIdx;
+	Data.MemberSlot = Group.Members.Add(Handle);
+	Group.bSlotsDirty = true;
+}
 
-	if (Removed > 0)
+void AAICombatCoordinator::LeaveGroup(int32 Handle)
+{
+	FRegisteredNPCData& Data = RegisteredNPCs[Handle];
+	if (Groups.IsValidIndex(Data.GroupIndex))
 	{
-		for (int32 i = 0; i < RegisteredNPCs.Num(); ++i)
+		FTargetGroup& Group = Groups[Data.GroupIndex];
+		if (Group.Members.IsValidIndex(Data.MemberSlot))
 		{
-			FRegisteredNPCData& Data = RegisteredNPCs[i];
-			Data.GroupIndex = Groups.IndexOfByPredicate([&Data](const FTargetGroup& G)
+			Group.Members.RemoveAtSwap(Data.MemberSlot, 1, EAllowShrinking::No);
+			if (Group.Members.IsValidIndex(Data.MemberSlot))
 			{
-				return G.Target.Get() == Data.Target.Get();
-			});
+				RegisteredNPCs[Group.Members[Data.MemberSlot]].MemberSlot = Data.MemberSlot;
+			}
 		}
+		Group.bSlotsDirty = true;
 	}
+
+	Data.GroupIndex = INDEX_NONE;
+	Data.MemberSlot = INDEX_NONE;
 }
 
 FTargetGroup* AAICombatCoordinator::FindGroupFor(APawn* NPC)
@@ -1464,33 +1851,34 @@ bool AAICombatCoordinator::HasLineOfSightToTarget(APawn* NPC) const
 	AActor* Target = ResolveTargetFor(NPC);
 	if (!Target) return false;
 
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(NPC);
-
 	const FVector Start = NPC->GetPawnViewLocation();
 	const FVector End = Target->GetActorLocation();
 
-	const bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult, Start, End, ECC_Visibility, QueryParams
-	);
-
-	return !bHit || HitResult.GetActor() == Target;
+	// Not the ray the NPC's own HasLineOfSightTo traces (that starts from the body, not the view),
+	// so it is cached as a sample of its own; every coordinator question in a frame still shares it
+	return UAILineOfSightSubsystem::HasLineOfSight(NPC, Target, Start, End, UAILineOfSightSubsystem::SampleView);
 }
 
 void AAICombatCoordinator::CleanupInvalidNPCs()
 {
-	RegisteredNPCs.RemoveAll([](const FRegisteredNPCData& Data)
+	for (auto It = RegisteredNPCs.CreateIterator(); It; ++It)
 	{
-		if (!Data.NPC.IsValid()) return true;
-
-		if (AShooterNPC* ShooterNPC = Cast<AShooterNPC>(Data.NPC.Get()))
+		const AShooterNPC* ShooterNPC = Cast<AShooterNPC>(It->NPC.Get());
+		if (!It->NPC.IsValid() || (ShooterNPC && ShooterNPC->IsDead()))
 		{
-			if (ShooterNPC->IsDead()) return true;
+			// Frees the slot only; the iterator walks allocation flags and carries on past it
+			RemoveNPCAt(It.GetIndex());
 		}
+	}
+}
 
-		return false;
-	});
+void AAICombatCoordinator::RemoveNPCAt(int32 Handle)
+{
+	// An emptied group stays until RebuildTargetGroups retires it: removing it here would move
+	// another group's index under whoever is iterating Groups
+	LeaveGroup(Handle);
+	NPCHandles.Remove(RegisteredNPCs[Handle].Key);
+	RegisteredNPCs.RemoveAt(Handle);
 }
 
 void AAICombatCoordinator::UpdatePermissionTimeouts(float DeltaTime)
@@ -1887,6 +2275,10 @@ void AAICombatCoordinator::RequestStrafeSlot(APawn* Drone, float OrbitDistance,
 {
 	if (!Drone) return;
 
+	SCOPE_CYCLE_COUNTER(STAT_AICoordinator_StrafeRequests);
+	INC_DWORD_STAT(STAT_AICoordinator_StrafeRequestCount);
+	++TotalStrafeRequests;
+
 	// The drone orbits the player IT is hunting. Orbiting PrimaryTarget put every drone in a ring
 	// around the busiest player regardless of who it had actually picked.
 	AActor* Target = ResolveTargetFor(Drone);
@@ -1910,56 +2302,43 @@ void AAICombatCoordinator::RequestStrafeSlot(APawn* Drone, float OrbitDistance,
 		return Slot.AssignedDrone.Get() == Drone;
 	});
 
-	// Sample directions around player
-	TArray<float> ClearAngles;
-	TArray<float> AllAngles;
-	const float AngleStep = 360.0f / StrafeSampleDirections;
+	const int32 NumDirections = FMath::Max(StrafeSampleDirections, 1);
+	const float AngleStep = 360.0f / NumDirections;
+
+	// Which directions are open at this orbit. Normally read off the ring every drone around this
+	// target shares, so another drone asking costs nothing; with the cache off, traced here as before.
+	const FStrafeClearanceMap* Map = CVarAICoordinatorStrafeCache.GetValueOnGameThread() != 0
+		? &GetClearanceMap(Target, OrbitDistance)
+		: nullptr;
 
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(Drone);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(StrafeSlot), false, Drone);
 	QueryParams.AddIgnoredActor(Target);
 
-	for (int32 i = 0; i < StrafeSampleDirections; ++i)
+	auto IsDirectionClear = [&](int32 DirIndex) -> bool
 	{
-		const float AngleDeg = AngleStep * i;
-		const float AngleRad = FMath::DegreesToRadians(AngleDeg);
-		const FVector Dir(FMath::Cos(AngleRad), FMath::Sin(AngleRad), 0.0f);
-		const FVector SamplePos = PlayerPos + Dir * OrbitDistance;
-
-		AllAngles.Add(AngleDeg);
-
-		FHitResult Hit;
-		if (!GetWorld()->LineTraceSingleByChannel(Hit, PlayerPos, SamplePos, ECC_WorldStatic, QueryParams))
+		if (Map)
 		{
-			ClearAngles.Add(AngleDeg);
+			return Map->ClearDistance[DirIndex] >= OrbitDistance;
 		}
-	}
 
-	// If nothing is clear, use least-blocked: pick direction closest to drone's current angle
-	if (ClearAngles.Num() == 0)
-	{
-		const FVector DroneDir = (Drone->GetActorLocation() - PlayerPos);
-		const float DroneAngle = FMath::RadiansToDegrees(FMath::Atan2(DroneDir.Y, DroneDir.X));
-		float BestAngle = 0.0f;
-		float BestDist = 999.0f;
-		for (float Ang : AllAngles)
-		{
-			float Diff = FMath::Abs(FMath::FindDeltaAngleDegrees(Ang, DroneAngle));
-			if (Diff < BestDist)
-			{
-				BestDist = Diff;
-				BestAngle = Ang;
-			}
-		}
-		ClearAngles.Add(BestAngle);
-	}
+		const float AngleRad = FMath::DegreesToRadians(AngleStep * DirIndex);
+		const FVector SamplePos = PlayerPos + FVector(FMath::Cos(AngleRad), FMath::Sin(AngleRad), 0.0f) * OrbitDistance;
+
+		++TotalStrafeSyncTraces;
+		INC_DWORD_STAT(STAT_AICoordinator_StrafeTraces);
+		FHitResult Hit;
+		return !GetWorld()->LineTraceSingleByChannel(Hit, PlayerPos, SamplePos, ECC_WorldStatic, QueryParams);
+	};
 
 	// Find the clear angle with maximum angular separation from other assigned drones
-	float BestAngle = ClearAngles[0];
+	float BestAngle = 0.0f;
 	float BestMinSeparation = -1.0f;
 
-	for (float CandidateAngle : ClearAngles)
+	for (int32 i = 0; i < NumDirections; ++i)
 	{
+		if (!IsDirectionClear(i)) continue;
+
+		const float CandidateAngle = AngleStep * i;
 		float MinSeparation = 360.0f;
 
 		for (const FStrafeSlot& Slot : StrafeSlots)
@@ -1976,6 +2355,24 @@ void AAICombatCoordinator::RequestStrafeSlot(APawn* Drone, float OrbitDistance,
 		}
 	}
 
+	// If nothing is clear, use least-blocked: pick direction closest to drone's current angle
+	if (BestMinSeparation < 0.0f)
+	{
+		const FVector DroneDir = (Drone->GetActorLocation() - PlayerPos);
+		const float DroneAngle = FMath::RadiansToDegrees(FMath::Atan2(DroneDir.Y, DroneDir.X));
+		float BestDist = 999.0f;
+		for (int32 i = 0; i < NumDirections; ++i)
+		{
+			const float Ang = AngleStep * i;
+			float Diff = FMath::Abs(FMath::FindDeltaAngleDegrees(Ang, DroneAngle));
+			if (Diff < BestDist)
+			{
+				BestDist = Diff;
+				BestAngle = Ang;
+			}
+		}
+	}
+
 	// Compute center and axis
 	const float BestRad = FMath::DegreesToRadians(BestAngle);
 	const FVector Dir(FMath::Cos(BestRad), FMath::Sin(BestRad), 0.0f);
@@ -2027,6 +2424,177 @@ void AAICombatCoordinator::ReleaseStrafeSlot(APawn* Drone)
 	});
 }
 
+FStrafeClearanceMap& AAICombatCoordinator::GetClearanceMap(AActor* Target, float OrbitDistance)
+{
+	FStrafeClearanceMap* Map = ClearanceMaps.FindByPredicate([Target](const FStrafeClearanceMap& M)
+	{
+		return M.Target.Get() == Target;
+	});
+
+	if (!Map)
+	{
+		Map = &ClearanceMaps.AddDefaulted_GetRef();
+		Map->Target = Target;
+
+		// Sixteen bits of it travel through the traces as UserData
+		Map->Id = NextClearanceMapId++ & 0xFFFF;
+	}
+
+	Map->LastUsedTime = GetWorld()->GetTimeSeconds();
+
+	// A stale ring is still a good answer, the refresh is on its way. One that was never traced, is
+	// too short for this orbit, has the wrong number of directions or was traced somewhere else
+	// entirely is not, and is worth one synchronous ring: once, for every drone around this target.
+	const FVector TargetPos = Target->GetActorLocation();
+	const bool bUsable = Map->RefreshTime >= 0.0
+		&& Map->ClearDistance.Num() == FMath::Max(StrafeSampleDirections, 1)
+		&& OrbitDistance <= Map->TraceLength
+		&& FVector::DistSquared(TargetPos, Map->Origin) <= FMath::Square(StrafeClearanceMaxDrift);
+
+	if (!bUsable)
+	{
+		const float Length = FMath::Max(OrbitDistance * CombatCoordinator::StrafeClearanceLengthSlack, Map->TraceLength);
+		TraceClearanceNow(*Map, TargetPos, Length);
+	}
+
+	return *Map;
+}
+
+void AAICombatCoordinator::TraceClearanceNow(FStrafeClearanceMap& Map, const FVector& Origin, float Length)
+{
+	// Whatever refresh was in flight was traced for the old answer; its results are turned away by Batch
+	++Map.Batch;
+	Map.bPending = false;
+
+	const int32 NumDirections = FMath::Max(StrafeSampleDirections, 1);
+	const float AngleStep = 360.0f / NumDirections;
+
+	// Static geometry only, and every drone's ring in one: a drone passing through one direction
+	// would otherwise close it for all of them
+	const FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(StrafeClearance), false, Map.Target.Get());
+
+	Map.ClearDistance.SetNumUninitialized(NumDirections);
+	for (int32 i = 0; i < NumDirections; ++i)
+	{
+		const float AngleRad = FMath::DegreesToRadians(AngleStep * i);
+		const FVector End = Origin + FVector(FMath::Cos(AngleRad), FMath::Sin(AngleRad), 0.0f) * Length;
+
+		FHitResult Hit;
+		Map.ClearDistance[i] = GetWorld()->LineTraceSingleByObjectType(Hit, Origin, End, ObjectParams, QueryParams)
+			? Hit.Distance
+			: Length;
+	}
+
+	Map.Origin = Origin;
+	Map.TraceLength = Length;
+	Map.RefreshTime = GetWorld()->GetTimeSeconds();
+
+	TotalStrafeSyncTraces += NumDirections;
+	INC_DWORD_STAT_BY(STAT_AICoordinator_StrafeTraces, NumDirections);
+}
+
+void AAICombatCoordinator::RequestClearanceRefresh(FStrafeClearanceMap& Map)
+{
+	AActor* Target = Map.Target.Get();
+	if (!Target)
+	{
+		return;
+	}
+
+	if (!StrafeTraceDelegate.IsBound())
+	{
+		StrafeTraceDelegate.BindUObject(this, &AAICombatCoordinator::OnStrafeTraceCompleted);
+	}
+
+	const int32 NumDirections = FMath::Max(StrafeSampleDirections, 1);
+	const float AngleStep = 360.0f / NumDirections;
+
+	++Map.Batch;
+	Map.bPending = true;
+	Map.PendingRemaining = NumDirections;
+	Map.PendingOrigin = Target->GetActorLocation();
+	Map.PendingLength = Map.TraceLength;
+	Map.PendingDistance.Init(Map.PendingLength, NumDirections);
+
+	const FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(StrafeClearance_Async), false, Target);
+
+	for (int32 i = 0; i < NumDirections; ++i)
+	{
+		const float AngleRad = FMath::DegreesToRadians(AngleStep * i);
+		const FVector End = Map.PendingOrigin + FVector(FMath::Cos(AngleRad), FMath::Sin(AngleRad), 0.0f) * Map.PendingLength;
+
+		// Map id, batch and direction; StrafeSampleDirections is clamped well under 256
+		const uint32 UserData = (Map.Id << 16) | (static_cast<uint32>(Map.Batch) << 8) | static_cast<uint32>(i & 0xFF);
+		GetWorld()->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Map.PendingOrigin, End, ObjectParams, QueryParams,
+			&StrafeTraceDelegate, UserData);
+	}
+
+	TotalStrafeAsyncTraces += NumDirections;
+	INC_DWORD_STAT_BY(STAT_AICoordinator_StrafeTraces, NumDirections);
+}
+
+void AAICombatCoordinator::UpdateStrafeClearance()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// A refresh in flight for a dropped ring lands, finds no ring with its id, and is ignored
+	ClearanceMaps.RemoveAll([Now](const FStrafeClearanceMap& Map)
+	{
+		return !Map.Target.IsValid() || Now - Map.LastUsedTime > CombatCoordinator::StrafeClearanceExpirySeconds;
+	});
+
+	const double RefreshInterval = 1.0 / FMath::Max(StrafeClearanceRefreshRate, 0.1f);
+	const float MoveToleranceSq = FMath::Square(StrafeClearanceMoveTolerance);
+
+	for (FStrafeClearanceMap& Map : ClearanceMaps)
+	{
+		if (Map.bPending || Map.RefreshTime < 0.0)
+		{
+			continue;
+		}
+
+		const bool bMoved = FVector::DistSquared(Map.Target->GetActorLocation(), Map.Origin) > MoveToleranceSq;
+		if (bMoved || Now - Map.RefreshTime >= RefreshInterval)
+		{
+			RequestClearanceRefresh(Map);
+		}
+	}
+}
+
+void AAICombatCoordinator::OnStrafeTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const uint32 Id = Datum.UserData >> 16;
+	const uint8 Batch = static_cast<uint8>((Datum.UserData >> 8) & 0xFF);
+	const int32 DirIndex = static_cast<int32>(Datum.UserData & 0xFF);
+
+	FStrafeClearanceMap* Map = ClearanceMaps.FindByPredicate([Id](const FStrafeClearanceMap& M) { return M.Id == Id; });
+	if (!Map || !Map->bPending || Map->Batch != Batch || !Map->PendingDistance.IsValidIndex(DirIndex))
+	{
+		return;
+	}
+
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			Map->PendingDistance[DirIndex] = Hit.Distance;
+			break;
+		}
+	}
+
+	// The whole ring changes at once, never half old and half new
+	if (--Map->PendingRemaining <= 0)
+	{
+		Swap(Map->ClearDistance, Map->PendingDistance);
+		Map->Origin = Map->PendingOrigin;
+		Map->TraceLength = Map->PendingLength;
+		Map->RefreshTime = GetWorld()->GetTimeSeconds();
+		Map->bPending = false;
+	}
+}
+
 void AAICombatCoordinator::LogStateSnapshot()
 {
 	const UWorld* World = GetWorld();
@@ -5,6 +5,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
 #include "AICombatCoordinator.generated.h"
 
 // ==================== Enums ====================
@@ -71,6 +73,37 @@ struct FStrafeSlot
 	float AngleDeg = 0.0f;
 };
 
+/** How far open ground reaches from one target in each strafe sample direction, shared by every
+ *  drone orbiting it. Plain data like FTargetGroup. @see AAICombatCoordinator::RequestStrafeSlot */
+struct FStrafeClearanceMap
+{
+	TWeakObjectPtr<AActor> Target;
+
+	/** Identifies this map to its async traces, which may land after it is gone. */
+	uint32 Id = 0;
+
+	/** Where the target was when the current distances were traced. */
+	FVector Origin = FVector::ZeroVector;
+
+	/** Per sample direction (StrafeSampleDirections of them, from +X counter-clockwise): distance
+	 *  to the first static hit, or TraceLength if there was none. A slot at radius R in that
+	 *  direction is clear when this is at least R. */
+	TArray<float> ClearDistance;
+	float TraceLength = 0.0f;
+
+	/** World time the current distances landed, and the last time a drone asked. */
+	double RefreshTime = -1.0;
+	double LastUsedTime = 0.0;
+
+	/** Refresh in flight. Its results fill Pending* and replace the above once all are in. */
+	bool bPending = false;
+	uint8 Batch = 0;
+	int32 PendingRemaining = 0;
+	FVector PendingOrigin = FVector::ZeroVector;
+	float PendingLength = 0.0f;
+	TArray<float> PendingDistance;
+};
+
 /** Battle circle slot — a position around the player that an NPC is assigned to */
 USTRUCT()
 struct FBattleSlot
@@ -105,11 +138,21 @@ struct FRegisteredNPCData
 	 *  contender stops leading, so a teammate has to genuinely take over, not merely brush past. */
 	float TargetSwitchPressure = 0.0f;
 
-	/** Index into Groups, or INDEX_NONE. Rebuilt each tick alongside the membership lists; never
-	 *  trust it across a frame boundary. */
+	/** Index into Groups, or INDEX_NONE. Kept current by JoinGroup/LeaveGroup, and moved when a
+	 *  retired group's place is taken by another. */
 	int32 GroupIndex = INDEX_NONE;
 
+	/** Where this NPC sits in its group's Members, so leaving the group is a swap and not a search. */
+	int32 MemberSlot = INDEX_NONE;
+
+	/** This NPC's key in the coordinator's handle map. Kept rather than rebuilt from NPC, because
+	 *  an NPC that is cleaned up is usually one whose pawn is already gone. */
+	TObjectKey<APawn> Key;
+
 	EAICombatRole Role = EAICombatRole::Supporter;
+
+	/** Distance, LOS and wait time folded into one number for the bDrawDebug labels. Debug output
+	 *  only: nothing grants, assigns or orders by it, and it is only kept current while bDrawDebug is on. */
 	float AttackScore = 0.0f;
 	float WaitTime = 0.0f;
 	float PermissionTime = 0.0f;
@@ -150,7 +193,8 @@ struct FPlayerStateCache
  *
  *  Groups PERSIST between ticks. They cannot be rebuilt from scratch each frame because the token
  *  pools hold live grants: throwing them away would hand every enemy a fresh permission to attack
- *  sixty times a second. Membership is rebuilt each tick; the group itself is not.
+ *  sixty times a second. Membership is not rebuilt either: an NPC moves between groups only when
+ *  its target changes, and an emptied group is retired.
  *
  *  Single player is the same code with one group, which is why this can be checked without a bench. */
 struct FTargetGroup
@@ -158,13 +202,15 @@ struct FTargetGroup
 	/** The player this group forms up around. A group with no target is retired. */
 	TWeakObjectPtr<AActor> Target;
 
-	/** Indices into RegisteredNPCs. Rebuilt every tick, cheap, never persists. */
+	/** Handles into RegisteredNPCs, in no particular order. Each member's MemberSlot is its place here. */
 	TArray<int32> Members;
 
 	/** Ring of positions around Target. */
 	TArray<FBattleSlot> BattleSlots;
 	float TimeSinceLastSlotRecalc = 0.0f;
-	int32 LastSlotNPCCount = -1;
+
+	/** Somebody joined or left since the slots were last generated. */
+	bool bSlotsDirty = true;
 
 	/** How much pressure this ONE player is under. The global ceiling sits above all groups
 	 *  together; these are what stop four enemies piling onto the same person. */
@@ -207,6 +253,20 @@ struct FActiveDecoy
  * - Battle circle positioning (slot-based rings around player)
  * - Role & pressure management (dynamic roles based on player state)
  * Spawn one instance in the level or use GetCoordinator() to auto-spawn.
+ *
+ * Each tick is split into phases. Targets, groups, token pools, proximity overrides, permission
+ * timeouts and roles run for every NPC every tick: they decide who may attack, and a grant or a
+ * timeout that waits its turn is an enemy standing still. Attack scoring (with its LOS query) only
+ * feeds the bDrawDebug labels and is skipped while they are off. It and battle slot assignment
+ * only need to be roughly current, so they walk the NPCs and groups
+ * round-robin, taking up to AI.Coordinator.ScoresPerTick scores and AI.Coordinator.SlotNPCsPerTick
+ * slotted NPCs a tick, and stopping early once the tick has used AI.Coordinator.BudgetMs. Whatever
+ * they do not reach keeps last tick's answer and goes first next time. AI.Coordinator.TimeSlice 0
+ * does all of it every tick. Per-phase cost in "stat AICoordinator", totals in AI.Coordinator.Report.
+ *
+ * NPCs are held by handle (their index in a sparse array) with a pawn -> handle map in front, and
+ * groups keep their members between ticks, so every per-NPC query is a map lookup and nothing is
+ * searched or rebuilt per frame. AI.Coordinator.Stress [N] times all of it over N placeholder NPCs.
  */
 UCLASS(BlueprintType)
 class POLARITY_API AAICombatCoordinator : public AActor
@@ -366,6 +426,19 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coordination|Strafe", meta = (ClampMin = "50"))
 	float StrafeHeightStep = 100.0f;
 
+	/** How often (Hz) the clearance ring around a target is re-traced while drones use it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coordination|Strafe", meta = (ClampMin = "0.1"))
+	float StrafeClearanceRefreshRate = 2.0f;
+
+	/** The target moving this far (cm) from where its ring was traced queues a refresh early */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coordination|Strafe", meta = (ClampMin = "0"))
+	float StrafeClearanceMoveTolerance = 150.0f;
+
+	/** The target moving this far (cm) from where its ring was traced makes the ring useless: the
+	 *  next request re-traces it on the spot instead of waiting for the refresh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coordination|Strafe", meta = (ClampMin = "0"))
+	float StrafeClearanceMaxDrift = 600.0f;
+
 	// ==================== Role & Pressure ====================
 
 	/** HP percentage threshold below which pressure tactics activate */
@@ -542,7 +615,9 @@ public:
 	// --- Strafe Coordination API ---
 
 	/** Request a strafe slot for a drone. Fills OutCenter and OutAxis for lateral oscillation.
-	 *  OrbitDistance determines how far from player to sample. */
+	 *  OrbitDistance determines how far from player to sample. Which directions are open comes from a
+	 *  clearance ring shared by every drone around the same target and re-traced asynchronously in
+	 *  Tick, so more drones means more lookups, not more traces. */
 	UFUNCTION(BlueprintCallable, Category = "Coordination|Strafe")
 	void RequestStrafeSlot(APawn* Drone, float OrbitDistance, FVector& OutCenter, FVector& OutAxis);
 
@@ -557,14 +632,27 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Coordination|Cluster")
 	FVector GetEnemyClusterDirection() const { return CachedClusterDirection; }
 
+	/** Lifetime tick cost and per-phase NPC counts to the log (AI.Coordinator.Report) */
+	void ReportStats() const;
+
+	/** Register NumNPCs placeholder pawns around the fight with a throwaway coordinator of the same
+	 *  class, time registration, per-NPC queries and its ticks over them, then remove both again.
+	 *  This coordinator and its NPCs are not touched (AI.Coordinator.Stress) */
+	void RunStressTest(int32 NumNPCs);
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 private:
-	/** Registered NPCs */
-	UPROPERTY()
-	TArray<FRegisteredNPCData> RegisteredNPCs;
+	/** Registered NPCs. Sparse so an NPC's index is a handle that stays put while others come and
+	 *  go: group membership and NPCHandles both hold it. Not a UPROPERTY (UHT has no sparse arrays);
+	 *  nothing in here is a strong reference anyway. */
+	TSparseArray<FRegisteredNPCData> RegisteredNPCs;
+
+	/** Pawn -> handle into RegisteredNPCs. What makes FindNPCData, and with it every per-NPC query, O(1). */
+	TMap<TObjectKey<APawn>, int32> NPCHandles;
 
 	/** Primary target (player) */
 	TWeakObjectPtr<AActor> PrimaryTarget;
@@ -578,10 +666,15 @@ private:
 	// --- Core helpers ---
 	FRegisteredNPCData* FindNPCData(APawn* NPC);
 	const FRegisteredNPCData* FindNPCData(APawn* NPC) const;
-	void UpdateAttackScores();
+	/** Score the next NPCs from ScoringCursor on: at most MaxScored in engagement range, and none
+	 *  past Deadline once one has been scored. Returns how many were scored. */
+	int32 UpdateAttackScores(int32 MaxScored, double Deadline);
 	float CalculateAttackScore(const FRegisteredNPCData& Data) const;
 	bool HasLineOfSightToTarget(APawn* NPC) const;
 	void CleanupInvalidNPCs();
+
+	/** Take the NPC at Handle out of its group, the handle map and RegisteredNPCs. */
+	void RemoveNPCAt(int32 Handle);
 	void UpdatePermissionTimeouts(float DeltaTime);
 	int32 CountCurrentAttackers() const;
 	bool IsNPCInEngagementRange(APawn* NPC) const;
@@ -614,6 +707,31 @@ private:
 	// --- Strafe Coordination ---
 	TArray<FStrafeSlot> StrafeSlots;
 
+	/** One per target drones are strafing around. Handful at most, searched linearly. */
+	TArray<FStrafeClearanceMap> ClearanceMaps;
+	uint32 NextClearanceMapId = 1;
+	FTraceDelegate StrafeTraceDelegate;
+
+	/** The ring around Target, re-traced synchronously first if there is none yet, it is too short
+	 *  for OrbitDistance, or Target has drifted past StrafeClearanceMaxDrift from it. */
+	FStrafeClearanceMap& GetClearanceMap(AActor* Target, float OrbitDistance);
+
+	/** Trace the whole ring now, from Origin out to Length. Drops any refresh in flight. */
+	void TraceClearanceNow(FStrafeClearanceMap& Map, const FVector& Origin, float Length);
+
+	/** Queue one async trace per direction from where the target is now. */
+	void RequestClearanceRefresh(FStrafeClearanceMap& Map);
+
+	/** Per tick: refresh the rings that are due or whose target moved, forget the unused ones. */
+	void UpdateStrafeClearance();
+
+	void OnStrafeTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	// Lifetime counters for ReportStats
+	uint64 TotalStrafeRequests = 0;
+	uint64 TotalStrafeSyncTraces = 0;
+	uint64 TotalStrafeAsyncTraces = 0;
+
 	// --- Battle Circle ---
 	// Battle slots, their recalc clocks and the player state cache all moved into FTargetGroup.
 
@@ -626,6 +744,11 @@ private:
 	EBattleRing GetPreferredRing(const FRegisteredNPCData& Data) const;
 	float GetRingMidRadius(EBattleRing Ring) const;
 
+	/** Rebuild or refresh the slots of the groups that are due, from SlotGroupCursor on, until MaxNPCs
+	 *  members have been slotted or Deadline has passed. The first due group is always done. Returns
+	 *  how many NPCs were slotted. */
+	int32 UpdateBattleSlots(float DeltaTime, int32 MaxNPCs, double Deadline);
+
 	// --- Role & Pressure ---
 	// CachedPlayerState moved into FTargetGroup::State.
 
@@ -672,10 +795,17 @@ private:
 
 	AActor* ResolveTargetFor(APawn* NPC) const;
 
-	/** Bring Groups in line with the targets the NPCs currently hold: create the missing ones, retire
-	 *  the ones nobody is fighting any more, and refill the membership lists. */
+	/** Bring Groups in line with the targets the NPCs currently hold: move the NPCs whose target
+	 *  changed, create the groups that are missing and retire the ones nobody is fighting any more. */
 	void RebuildTargetGroups();
 
+	/** The group forming up around Target, or INDEX_NONE. A scan, but over groups (one per player). */
+	int32 FindGroupIndex(const AActor* Target) const;
+
+	/** Add / remove one NPC to / from a group's Members. Both mark the group's slots dirty. */
+	void JoinGroup(int32 Handle, int32 GroupIdx);
+	void LeaveGroup(int32 Handle);
+
 	FTargetGroup* FindGroupFor(APawn* NPC);
 	const FTargetGroup* FindGroupFor(APawn* NPC) const;
 
@@ -698,6 +828,29 @@ private:
 	float TimeSinceLastClusterCalc = 0.0f;
 	void UpdateEnemyClusterDirection();
 
+	// --- Time Slicing ---
+
+	/** Where scoring picks up next tick. Wraps, so RegisteredNPCs shrinking under it is harmless. */
+	int32 ScoringCursor = 0;
+
+	/** The group the slot phase tries first next tick: the one it ran out of budget on. */
+	int32 SlotGroupCursor = 0;
+
+	// Scratch kept between ticks so the per-tick phases do not allocate
+	TArray<TPair<float, int32>> RoleOrder;
+	TArray<int32> SlotCandidates;
+	TArray<APawn*> PlayerScratch;
+
+	// Lifetime counters for ReportStats
+	uint64 TotalTicks = 0;
+	uint64 TotalScored = 0;
+	uint64 TotalSlotted = 0;
+	uint64 TotalSlotGroupsDeferred = 0;
+	uint64 FirstTickFrame = 0;
+	double TotalSeconds = 0.0;
+	double PeakSeconds = 0.0;
+	int32 PeakRegistered = 0;
+
 	// --- Debug ---
 	void DrawDebugInfo();
 	void DrawBattleCircleDebug();
@@ -0,0 +1,229 @@
+// AILineOfSightSubsystem.cpp
+
+#include "AILineOfSightSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarAILOSCache(
+	TEXT("AI.LOS.Cache"),
+	1,
+	TEXT("1=AI line of sight is memoised per pair and refreshed by async traces, 0=synchronous trace per query"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAILOSRefreshRate(
+	TEXT("AI.LOS.RefreshRate"),
+	10.0f,
+	TEXT("How often (Hz) a pair that is still being asked about is re-traced"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAILOSMaxStaleness(
+	TEXT("AI.LOS.MaxStaleness"),
+	0.3f,
+	TEXT("Oldest result (seconds) still served while its refresh waits; older ones are re-traced synchronously"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAILOSMoveTolerance(
+	TEXT("AI.LOS.MoveTolerance"),
+	100.0f,
+	TEXT("Either endpoint moving further than this (cm) since the last trace queues a refresh early"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAILOSAsyncPerObserver(
+	TEXT("AI.LOS.AsyncPerObserver"),
+	2,
+	TEXT("Async refreshes one observer may queue per frame; pairs past it keep their cached result"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GAILOSReportCmd(
+	TEXT("AI.LOS.Report"),
+	TEXT("Print AI line of sight memo hit rate and traces saved since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UAILineOfSightSubsystem* LOS = World ? World->GetSubsystem<UAILineOfSightSubsystem>() : nullptr)
+		{
+			LOS->ReportStats();
+		}
+	}));
+
+DECLARE_STATS_GROUP(TEXT("AI Line of Sight"), STATGROUP_AILOS, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queries"), STAT_AILOS_Queries, STATGROUP_AILOS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Same-Frame Hits"), STAT_AILOS_FrameHits, STATGROUP_AILOS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cached Hits"), STAT_AILOS_CachedHits, STATGROUP_AILOS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sync Traces"), STAT_AILOS_SyncTraces, STATGROUP_AILOS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Traces"), STAT_AILOS_AsyncTraces, STATGROUP_AILOS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Entries"), STAT_AILOS_Entries, STATGROUP_AILOS);
+
+namespace AILineOfSight
+{
+	/** A ray no NPC has asked about for this long (target gone, NPC dead or asleep) is dropped */
+	static constexpr double EntryExpirySeconds = 2.0;
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UAILineOfSightSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UAILineOfSightSubsystem::Deinitialize()
+{
+	// Refreshes queued on the world's last frame come back with nobody to answer; unbound, they are dropped
+	TraceDelegate.Unbind();
+	Cache.Reset();
+	AsyncQueuedThisFrame.Empty();
+
+	Super::Deinitialize();
+}
+
+void UAILineOfSightSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_AILOS_Entries, Cache.Num());
+
+	// Every observer's refresh ration starts over
+	AsyncQueuedThisFrame.Reset();
+
+	Cache.Expire(GetWorld()->GetTimeSeconds(), AILineOfSight::EntryExpirySeconds);
+}
+
+TStatId UAILineOfSightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAILineOfSightSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== Queries ====================
+
+bool UAILineOfSightSubsystem::HasLineOfSight(const AActor* Observer, const AActor* Target, const FVector& From, const FVector& To, uint8 Sample)
+{
+	UWorld* World = Observer ? Observer->GetWorld() : nullptr;
+	if (!World || !Target)
+	{
+		return false;
+	}
+
+	UAILineOfSightSubsystem* LOS = CVarAILOSCache.GetValueOnGameThread() != 0 ? World->GetSubsystem<UAILineOfSightSubsystem>() : nullptr;
+	if (!LOS)
+	{
+		INC_DWORD_STAT(STAT_AILOS_SyncTraces);
+		return TraceNow(World, Observer, Target, From, To);
+	}
+
+	return LOS->Query(Observer, Target, From, To, Sample);
+}
+
+bool UAILineOfSightSubsystem::Query(const AActor* Observer, const AActor* Target, const FVector& From, const FVector& To, uint8 Sample)
+{
+	INC_DWORD_STAT(STAT_AILOS_Queries);
+	++TotalQueries;
+
+	const float RefreshRate = CVarAILOSRefreshRate.GetValueOnGameThread();
+
+	FAsyncTraceCachePolicy Policy;
+	Policy.MaxStaleness = CVarAILOSMaxStaleness.GetValueOnGameThread();
+	Policy.RefreshInterval = RefreshRate > KINDA_SMALL_NUMBER ? 1.0 / RefreshRate : 0.0;
+	Policy.MoveTolerance = CVarAILOSMoveTolerance.GetValueOnGameThread();
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const FPairKey Key{ Observer->GetUniqueID(), Target->GetUniqueID(), Sample };
+	EAsyncTraceCacheLookup Lookup;
+	FAsyncTraceCacheEntry& Entry = Cache.Lookup(Key, Now, From, To, Policy, Lookup);
+
+	switch (Lookup)
+	{
+	case EAsyncTraceCacheLookup::Miss:
+		// Nothing usable: a guess here could have an NPC firing at somebody behind a wall
+		INC_DWORD_STAT(STAT_AILOS_SyncTraces);
+		++TotalSyncTraces;
+		TAsyncTraceCache<FPairKey>::StoreResult(Entry, !TraceNow(GetWorld(), Observer, Target, From, To), Now, From, To);
+		break;
+
+	case EAsyncTraceCacheLookup::ThisFrame:
+		INC_DWORD_STAT(STAT_AILOS_FrameHits);
+		++TotalFrameHits;
+		break;
+
+	case EAsyncTraceCacheLookup::RefreshDue:
+		INC_DWORD_STAT(STAT_AILOS_CachedHits);
+		++TotalCachedHits;
+		if (ConsumeAsyncBudget(Key.Observer))
+		{
+			RequestAsyncTrace(Key, Entry, Observer, Target, From, To);
+		}
+		else
+		{
+			++TotalBudgetDeferred;
+		}
+		break;
+
+	case EAsyncTraceCacheLookup::Cached:
+		INC_DWORD_STAT(STAT_AILOS_CachedHits);
+		++TotalCachedHits;
+		break;
+	}
+
+	return !Entry.bBlocked;
+}
+
+bool UAILineOfSightSubsystem::TraceNow(UWorld* World, const AActor* Observer, const AActor* Target, const FVector& From, const FVector& To)
+{
+	FHitResult Hit;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(AI_LOS), false, Observer);
+	Params.AddIgnoredActor(Target);
+	return !World->LineTraceSingleByChannel(Hit, From, To, ECC_Visibility, Params);
+}
+
+bool UAILineOfSightSubsystem::ConsumeAsyncBudget(uint32 ObserverId)
+{
+	int32& Used = AsyncQueuedThisFrame.FindOrAdd(ObserverId);
+	if (Used >= FMath::Max(CVarAILOSAsyncPerObserver.GetValueOnGameThread(), 0))
+	{
+		return false;
+	}
+	++Used;
+	return true;
+}
+
+// ==================== Async Traces ====================
+
+void UAILineOfSightSubsystem::RequestAsyncTrace(const FPairKey& Key, FAsyncTraceCacheEntry& Entry, const AActor* Observer, const AActor* Target,
+	const FVector& From, const FVector& To)
+{
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &UAILineOfSightSubsystem::OnTraceCompleted);
+	}
+
+	// Same query as TraceNow: simple collision on ECC_Visibility, both ends left out
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(AI_LOS_Async), false, Observer);
+	Params.AddIgnoredActor(Target);
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, From, To, ECC_Visibility, Params,
+		FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, Cache.BeginAsyncTrace(Key, Entry, From, To));
+
+	INC_DWORD_STAT(STAT_AILOS_AsyncTraces);
+	++TotalAsyncTraces;
+}
+
+void UAILineOfSightSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	Cache.CompleteAsyncTrace(Datum, GetWorld()->GetTimeSeconds());
+}
+
+// ==================== Stats ====================
+
+void UAILineOfSightSubsystem::ReportStats() const
+{
+	const uint64 Hits = TotalFrameHits + TotalCachedHits;
+	const double HitRate = TotalQueries > 0 ? 100.0 * static_cast<double>(Hits) / static_cast<double>(TotalQueries) : 0.0;
+
+	// AI.LOS.Cache 0 would have traced once per query, same frame or not
+	const int64 TracesSaved = static_cast<int64>(TotalQueries) - static_cast<int64>(TotalSyncTraces + TotalAsyncTraces);
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[AI_LOS] queries=%llu hits=%llu (%.1f%%: same frame=%llu cached=%llu) sync=%llu async=%llu deferred by budget=%llu saved=%lld entries=%d"),
+		TotalQueries, Hits, HitRate, TotalFrameHits, TotalCachedHits, TotalSyncTraces, TotalAsyncTraces,
+		TotalBudgetDeferred, TracesSaved, Cache.Num());
+}
@@ -0,0 +1,121 @@
+// AILineOfSightSubsystem.h
+// Shared NPC-to-target line of sight, memoised per frame and refreshed by async traces
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "AsyncTraceCache.h"
+#include "AILineOfSightSubsystem.generated.h"
+
+/**
+ * Every AI line of sight question used to be its own synchronous LineTraceSingleByChannel: the NPC's
+ * HasLineOfSightTo, which the StateTree tasks and conditions call several times a tick, the
+ * coordinator's HasLineOfSightToTarget in scoring and token arbitration, the StateTree LOS
+ * condition. The same NPC and player were traced against each other three or four times in one
+ * frame, and again the next frame, for an answer that changes a few times a second.
+ *
+ * Now they all ask here, and the answers live in a TAsyncTraceCache keyed by (observer, target,
+ * sample), the sample naming which of the pair's rays it is. What matters for AI is the repeat
+ * within a frame: the second and later callers get the first one's answer for free. Across frames
+ * an answer is trusted for AI.LOS.MaxStaleness, shorter than the EMF shielding cache allows, because
+ * an NPC acting on it shoots at somebody. A target that just appeared is traced synchronously.
+ * Refresh traces are rationed: each observer may queue AI.LOS.AsyncPerObserver a frame, so one NPC
+ * polling many targets cannot take the frame's traces for itself; a pair over the ration keeps its
+ * answer until a later frame has room.
+ *
+ * Traces ignore both ends and run on ECC_Visibility: LOS is clear when nothing else is in the way.
+ * AI.LOS.Cache 0 traces synchronously every time. Counters in "stat AILOS" and AI.LOS.Report.
+ */
+UCLASS()
+class POLARITY_API UAILineOfSightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Cache.Num() > 0; }
+
+	// ==================== Queries ====================
+
+	/**
+	 * Can Observer see Target along From -> To? Both actors are left out of the trace.
+	 *
+	 * The cache key is (Observer, Target, Sample), not the endpoints, so every distinct ray between
+	 * the same pair needs its own Sample: two callers sharing one would be handed each other's
+	 * answers. The rays asked about today are listed below. Traces synchronously when there is no
+	 * subsystem or the cache is off, so callers can use this unconditionally.
+	 */
+	static bool HasLineOfSight(const AActor* Observer, const AActor* Target, const FVector& From, const FVector& To, uint8 Sample = 0);
+
+	/** The NPC's own HasLineOfSightTo, from wherever that NPC class looks from */
+	static constexpr uint8 SampleBody = 0;
+
+	/** The combat coordinator, from the pawn's view location */
+	static constexpr uint8 SampleView = 1;
+
+	/** The StateTree LOS condition, one sample per target height from here up */
+	static constexpr uint8 SampleHeightsFirst = 2;
+
+	/** Print lifetime hit rates and traces saved to the log (AI.LOS.Report) */
+	void ReportStats() const;
+
+private:
+
+	struct FPairKey
+	{
+		uint32 Observer = 0;
+		uint32 Target = 0;
+		uint8 Sample = 0;
+
+		bool operator==(const FPairKey& Other) const
+		{
+			return Observer == Other.Observer && Target == Other.Target && Sample == Other.Sample;
+		}
+
+		friend uint32 GetTypeHash(const FPairKey& Key)
+		{
+			return HashCombine(HashCombine(::GetTypeHash(Key.Observer), ::GetTypeHash(Key.Target)), ::GetTypeHash(Key.Sample));
+		}
+	};
+
+	bool Query(const AActor* Observer, const AActor* Target, const FVector& From, const FVector& To, uint8 Sample);
+
+	static bool TraceNow(UWorld* World, const AActor* Observer, const AActor* Target, const FVector& From, const FVector& To);
+
+	/** Take one of the observer's async refreshes for this frame; false if it has used them all */
+	bool ConsumeAsyncBudget(uint32 ObserverId);
+
+	void RequestAsyncTrace(const FPairKey& Key, FAsyncTraceCacheEntry& Entry, const AActor* Observer, const AActor* Target,
+		const FVector& From, const FVector& To);
+
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** bBlocked in an entry means not visible */
+	TAsyncTraceCache<FPairKey> Cache;
+
+	/** Async refreshes each observer has queued since the last Tick */
+	TMap<uint32, int32> AsyncQueuedThisFrame;
+
+	/** Bound on the first refresh; every AI LOS refresh trace reports back through it */
+	FTraceDelegate TraceDelegate;
+
+	// ==================== Lifetime Counters ====================
+
+	uint64 TotalQueries = 0;
+	uint64 TotalFrameHits = 0;
+	uint64 TotalCachedHits = 0;
+	uint64 TotalSyncTraces = 0;
+	uint64 TotalAsyncTraces = 0;
+	uint64 TotalBudgetDeferred = 0;
+};
@@ -23,6 +23,12 @@
 #include "Polarity/EMFPhysicsProp.h"
 #include "Polarity/Variant_Shooter/Weapons/EMFProjectile.h"
 #include "Kismet/GameplayStatics.h"
+#include "Polarity/Pooling/ActorPoolSubsystem.h"
+#include "Polarity/PolarityPerfLog.h"
+#include "Polarity/VFX/VFXPrewarmSubsystem.h"
+#include "NiagaraSystem.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
 #include "GeometryCollection/GeometryCollectionActor.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
@@ -53,6 +59,46 @@ AArenaManager::AArenaManager()
 	SetRootComponent(Root);
 }
 
+static TAutoConsoleVariable<int32> CVarArenaPrewarmPerFrame(
+	TEXT("Arena.PrewarmPerFrame"),
+	1,
+	TEXT("Prewarm items an arena creates per frame (one parked NPC or one Niagara warm-up each)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarArenaPrewarmMaxNPCsPerClass(
+	TEXT("Arena.PrewarmMaxNPCsPerClass"),
+	12,
+	TEXT("Upper bound on parked NPCs an arena prewarms per class; 0 disables NPC prewarm"),
+	ECVF_Default);
+
+/** Niagara systems a class's defaults point at, following TSubclassOf properties FollowClasses levels deep
+ *  (NPC -> weapon -> projectile). Only direct properties: systems inside structs and arrays are not found. */
+static void GatherNiagaraSystems(UClass* Class, int32 FollowClasses, TSet<UNiagaraSystem*>& OutSystems, TSet<UClass*>& Visited)
+{
+	if (!Class || Visited.Contains(Class))
+	{
+		return;
+	}
+	Visited.Add(Class);
+
+	const UObject* CDO = Class->GetDefaultObject();
+	for (TFieldIterator<FObjectPropertyBase> It(Class); It; ++It)
+	{
+		for (int32 Index = 0; Index < It->ArrayDim; ++Index)
+		{
+			UObject* Value = It->GetObjectPropertyValue_InContainer(CDO, Index);
+			if (UNiagaraSystem* System = Cast<UNiagaraSystem>(Value))
+			{
+				OutSystems.Add(System);
+			}
+			else if (FollowClasses > 0 && It->IsA<FClassProperty>())
+			{
+				GatherNiagaraSystems(Cast<UClass>(Value), FollowClasses - 1, OutSystems, Visited);
+			}
+		}
+	}
+}
+
 // ==================== Lifecycle ====================
 
 void AArenaManager::BeginPlay()
@@ -237,6 +283,9 @@ void AArenaManager::BeginPlay()
 	// Bind to antenna activation events
 	RegisterAntennas();
 
+	// After RegisterLevelEnemies: the sustain cap can depend on the enemies placed on the level
+	BuildPrewarmManifest();
+
 	UE_LOG(LogTemp, Error, TEXT("===== ArenaManager::BeginPlay DONE — AliveNPCs: %d, InitialLevelEnemyCount: %d ====="),
 		AliveNPCs.Num(), InitialLevelEnemyCount);
 }
@@ -665,19 +714,28 @@ void AArenaManager::ExecuteWaveSpawnAt(TSubclassOf<AShooterNPC> NPCClass, AArena
 
 	const FTransform SpawnTransform = ResolveSpawnTransform(SpawnPoint, NPCClass);
 
-	APawn* SpawnedPawn = UAIBlueprintHelperLibrary::SpawnAIFromClass(
-		World,
-		NPCClass,
-		nullptr,
-		SpawnTransform.GetLocation(),
-		SpawnTransform.Rotator(),
-		true
-	);
-
-	AShooterNPC* NPC = Cast<AShooterNPC>(SpawnedPawn);
+	// Prewarmed or previous waves' NPCs first; spawning is the fallback for a pool that ran short
+	AShooterNPC* NPC = TryRecycleFromPool(NPCClass, SpawnTransform.GetLocation(), SpawnTransform.Rotator());
 	if (!NPC)
 	{
-		return;
+		APawn* SpawnedPawn = UAIBlueprintHelperLibrary::SpawnAIFromClass(
+			World,
+			NPCClass,
+			nullptr,
+			SpawnTransform.GetLocation(),
+			SpawnTransform.Rotator(),
+			true
+		);
+
+		NPC = Cast<AShooterNPC>(SpawnedPawn);
+		if (!NPC)
+		{
+			return;
+		}
+		NPC->bIsPooled = NPC->bAllowArenaAutoRecovery;
+
+		// Routine until the first NPCs of this class have died and been recycled
+		UE_LOG(LogPolarityPerf, Verbose, TEXT("ArenaManager::ExecuteWaveSpawnAt — pool miss, spawned %s"), *NPCClass->GetName());
 	}
 
 	AliveNPCs.Add(NPC);
@@ -844,6 +902,14 @@ void AArenaManager::OnNPCDied(AShooterNPC* DeadNPC)
 
 	UE_LOG(LogTemp, Error, TEXT(">>> OnNPCDied: AliveNPCs after remove: %d, CurrentState: %d"), AliveNPCs.Num(), (int32)CurrentState);
 
+	// Add dead NPC to recycle pool (it will be hidden after death effects complete)
+	if (DeadNPC->bIsPooled && DeadNPC->CanRecycleThroughPool())
+	{
+		NPCPool.Add(DeadNPC);
+		UE_LOG(LogTemp, Error, TEXT(">>> OnNPCDied — Added %s to recycle pool (pool size: %d)"),
+			*DeadNPC->GetName(), NPCPool.Num());
+	}
+
 	// A scored objective owns completion; do not advance waves while its staggered kills run.
 	if (bObjectiveCompletionPending)
 	{
@@ -853,14 +919,6 @@ void AArenaManager::OnNPCDied(AShooterNPC* DeadNPC)
 
 	if (ArenaMode == EArenaMode::Sustain && CurrentState == EArenaState::Active)
 	{
-		// Add dead NPC to recycle pool (it will be hidden after death effects complete)
-		if (DeadNPC->bIsPooled)
-		{
-			NPCPool.Add(DeadNPC);
-			UE_LOG(LogTemp, Error, TEXT(">>> OnNPCDied [SUSTAIN] — Added %s to recycle pool (pool size: %d)"),
-				*DeadNPC->GetName(), NPCPool.Num());
-		}
-
 		// Check if we ran out of spawns and all enemies are dead
 		if (SustainRemainingSpawns == 0 && AliveNPCs.Num() == 0)
 		{
@@ -1118,17 +1176,27 @@ void AArenaManager::ResetArena()
 
 	UE_LOG(LogTemp, Error, TEXT("  --- ResetArena: Destroyed %d NPCs. AliveNPCs now: %d ---"), DestroyedCount, AliveNPCs.Num());
 
-	// Destroy pooled (hidden) NPCs
-	for (const TWeakObjectPtr<AShooterNPC>& NPCPtr : NPCPool)
+	// Pooled NPCs that are already parked (hidden) stay for the next attempt; bodies still mid-death go
+	int32 DestroyedPooled = 0;
+	for (int32 i = NPCPool.Num() - 1; i >= 0; --i)
 	{
-		if (AShooterNPC* NPC = NPCPtr.Get())
+		AShooterNPC* NPC = NPCPool[i].Get();
+		if (NPC && NPC->IsHidden())
+		{
+			continue;
+		}
+		if (NPC)
 		{
 			NPC->bIsPooled = false; // Allow Destroy to proceed
 			NPC->Destroy();
+			DestroyedPooled++;
 		}
+		NPCPool.RemoveAt(i);
 	}
-	UE_LOG(LogTemp, Error, TEXT("  --- ResetArena: Destroyed %d pooled NPCs ---"), NPCPool.Num());
-	NPCPool.Empty();
+	UE_LOG(LogTemp, Error, TEXT("  --- ResetArena: Destroyed %d pooled NPCs, %d stay parked ---"), DestroyedPooled, NPCPool.Num());
+
+	// Replace the ones destroyed above before the player is back
+	QueueNPCPrewarm();
 
 	// Restore camera if locked
 	if (bCameraLocked)
@@ -1512,6 +1580,221 @@ AShooterNPC* AArenaManager::TryRecycleFromPool(TSubclassOf<AShooterNPC> NPCClass
 	return nullptr;
 }
 
+// ==================== Prewarm ====================
+
+void AArenaManager::BuildPrewarmManifest()
+{
+	// Per class, the most any one wave (or the sustain roster) can want at once
+	TMap<TSubclassOf<AActor>, int32> PoolPeak;
+	auto MergePeak = [](TMap<TSubclassOf<AActor>, int32>& Peak, const TMap<TSubclassOf<AActor>, int32>& Counts)
+	{
+		for (const TPair<TSubclassOf<AActor>, int32>& Pair : Counts)
+		{
+			int32& Current = Peak.FindOrAdd(Pair.Key);
+			Current = FMath::Max(Current, Pair.Value);
+		}
+	};
+
+	NPCPrewarmTargets.Reset();
+	TSet<UClass*> NPCClasses;
+
+	if (ArenaMode == EArenaMode::Sustain)
+	{
+		float TotalWeight = 0.0f;
+		for (const FSustainSpawnEntry& Entry : SustainEnemyPool)
+		{
+			TotalWeight += Entry.NPCClass ? FMath::Max(Entry.Weight, 0.0f) : 0.0f;
+		}
+
+		const int32 MaxAlive = GetEffectiveMaxSustainEnemies();
+		TMap<TSubclassOf<AActor>, int32> Counts;
+		for (const FSustainSpawnEntry& Entry : SustainEnemyPool)
+		{
+			if (!Entry.NPCClass || TotalWeight <= 0.0f)
+			{
+				continue;
+			}
+			NPCClasses.Add(Entry.NPCClass);
+
+			// Drops follow the expected mix; NPCs have to cover an unlucky run of one class
+			const int32 Concurrent = FMath::CeilToInt(MaxAlive * FMath::Max(Entry.Weight, 0.0f) / TotalWeight);
+			Entry.NPCClass->GetDefaultObject<AShooterNPC>()->GatherPoolPrewarm(Counts, Concurrent);
+
+			int32& Target = NPCPrewarmTargets.FindOrAdd(Entry.NPCClass);
+			Target = FMath::Max(Target, MaxAlive);
+		}
+		MergePeak(PoolPeak, Counts);
+	}
+	else
+	{
+		// A wave starts a few seconds after the last one ends, when the last of its NPCs may still be
+		// mid-death and not yet back in the pool, so NPCs are sized for two consecutive waves
+		TMap<TSubclassOf<AShooterNPC>, int32> PreviousWave;
+		for (const FArenaWave& Wave : Waves)
+		{
+			TMap<TSubclassOf<AActor>, int32> Counts;
+			TMap<TSubclassOf<AShooterNPC>, int32> ThisWave;
+			for (const FArenaSpawnEntry& Entry : Wave.Entries)
+			{
+				if (Entry.NPCClass && Entry.Count > 0)
+				{
+					NPCClasses.Add(Entry.NPCClass);
+					Entry.NPCClass->GetDefaultObject<AShooterNPC>()->GatherPoolPrewarm(Counts, Entry.Count);
+					ThisWave.FindOrAdd(Entry.NPCClass) += Entry.Count;
+				}
+			}
+			MergePeak(PoolPeak, Counts);
+
+			for (const TPair<TSubclassOf<AShooterNPC>, int32>& Pair : ThisWave)
+			{
+				const int32* Previous = PreviousWave.Find(Pair.Key);
+				int32& Target = NPCPrewarmTargets.FindOrAdd(Pair.Key);
+				Target = FMath::Max(Target, Pair.Value + (Previous ? *Previous : 0));
+			}
+			PreviousWave = MoveTemp(ThisWave);
+		}
+	}
+
+	// Drones destroy themselves on death, so there is nothing to park for them
+	const int32 MaxPerClass = FMath::Max(CVarArenaPrewarmMaxNPCsPerClass.GetValueOnGameThread(), 0);
+	for (auto It = NPCPrewarmTargets.CreateIterator(); It; ++It)
+	{
+		It->Value = FMath::Min(It->Value, MaxPerClass);
+		if (It->Value <= 0 || !It->Key->GetDefaultObject<AShooterNPC>()->CanRecycleThroughPool())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Weapons, drops and pickups
+	if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+	{
+		for (const TPair<TSubclassOf<AActor>, int32>& Pair : PoolPeak)
+		{
+			Pool->RequestPrewarm(Pair.Key, Pair.Value);
+		}
+	}
+
+	// Niagara the NPCs, their weapons and projectiles, drops and pickups reference
+	TSet<UNiagaraSystem*> Systems;
+	TSet<UClass*> Visited;
+	for (UClass* NPCClass : NPCClasses)
+	{
+		GatherNiagaraSystems(NPCClass, 2, Systems, Visited);
+	}
+	for (const TPair<TSubclassOf<AActor>, int32>& Pair : PoolPeak)
+	{
+		GatherNiagaraSystems(Pair.Key, 1, Systems, Visited);
+	}
+	PendingVFXPrewarm.Reset();
+	for (UNiagaraSystem* System : Systems)
+	{
+		PendingVFXPrewarm.Add(System);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[ARENA_PREWARM] %s: %d NPC classes, %d pooled actor classes, %d Niagara systems"),
+		*GetName(), NPCPrewarmTargets.Num(), PoolPeak.Num(), PendingVFXPrewarm.Num());
+
+	QueueNPCPrewarm();
+}
+
+void AArenaManager::QueueNPCPrewarm()
+{
+	PendingNPCPrewarm.Reset();
+
+	// NPCs are server actors; clients only warm the effects
+	if (HasAuthority())
+	{
+		for (const TPair<TSubclassOf<AShooterNPC>, int32>& Pair : NPCPrewarmTargets)
+		{
+			int32 Parked = 0;
+			for (const TWeakObjectPtr<AShooterNPC>& NPCPtr : NPCPool)
+			{
+				if (AShooterNPC* NPC = NPCPtr.Get())
+				{
+					Parked += NPC->GetClass() == Pair.Key ? 1 : 0;
+				}
+			}
+			if (Parked < Pair.Value)
+			{
+				PendingNPCPrewarm.Add(Pair.Key, Pair.Value - Parked);
+			}
+		}
+	}
+
+	if ((PendingNPCPrewarm.Num() > 0 || PendingVFXPrewarm.Num() > 0)
+		&& !GetWorldTimerManager().TimerExists(PrewarmTimerHandle))
+	{
+		PrewarmTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &AArenaManager::PrewarmStep);
+	}
+}
+
+void AArenaManager::PrewarmStep()
+{
+	PrewarmTimerHandle.Invalidate();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	int32 Budget = FMath::Max(CVarArenaPrewarmPerFrame.GetValueOnGameThread(), 1);
+
+	// NPCs first: they are what a wave spawn would otherwise construct
+	while (Budget > 0 && PendingNPCPrewarm.Num() > 0)
+	{
+		auto It = PendingNPCPrewarm.CreateIterator();
+		const TSubclassOf<AShooterNPC> NPCClass = It->Key;
+		if (--It->Value <= 0)
+		{
+			It.RemoveCurrent();
+		}
+		--Budget;
+
+		APawn* SpawnedPawn = UAIBlueprintHelperLibrary::SpawnAIFromClass(
+			World,
+			NPCClass,
+			nullptr,
+			PrewarmParkingLocation,
+			FRotator::ZeroRotator,
+			true
+		);
+		if (AShooterNPC* NPC = Cast<AShooterNPC>(SpawnedPawn))
+		{
+			NPC->ParkForPool();
+			NPCPool.Add(NPC);
+		}
+	}
+
+	if (Budget > 0 && PendingVFXPrewarm.Num() > 0)
+	{
+		if (UVFXPrewarmSubsystem* VFXPrewarm = World->GetSubsystem<UVFXPrewarmSubsystem>())
+		{
+			// Starts the hand-listed set once (no-op after); later registrations warm right away
+			VFXPrewarm->PrewarmAllSystems();
+			while (Budget > 0 && PendingVFXPrewarm.Num() > 0)
+			{
+				VFXPrewarm->RegisterSystemForPrewarm(PendingVFXPrewarm.Pop(EAllowShrinking::No));
+				--Budget;
+			}
+		}
+		else
+		{
+			PendingVFXPrewarm.Reset();
+		}
+	}
+
+	if (PendingNPCPrewarm.Num() > 0 || PendingVFXPrewarm.Num() > 0)
+	{
+		PrewarmTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &AArenaManager::PrewarmStep);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ARENA_PREWARM] %s: done, %d NPCs parked"), *GetName(), NPCPool.Num());
+	}
+}
+
 void AArenaManager::SpawnSustainEnemy()
 {
 	UE_LOG(LogTemp, Warning, TEXT("ArenaManager::SpawnSustainEnemy — START"));
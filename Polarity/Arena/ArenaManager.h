@@ -524,9 +524,9 @@ private:
 	/** How many consecutive stuck checks each NPC has failed (not moving) */
 	TMap<TWeakObjectPtr<AShooterNPC>, int32> NPCStuckCounter;
 
-	// ==================== NPC Pool (Sustain Mode) ====================
+	// ==================== NPC Pool ====================
 
-	/** Dead NPCs waiting to be recycled (sustain mode only) */
+	/** Dead (or prewarmed) NPCs waiting to be recycled by a wave or sustain spawn */
 	UPROPERTY()
 	TArray<TWeakObjectPtr<AShooterNPC>> NPCPool;
 
@@ -534,6 +534,34 @@ private:
 	 *  Returns the recycled NPC (already reset + teleported), or nullptr if no match. */
 	AShooterNPC* TryRecycleFromPool(TSubclassOf<AShooterNPC> NPCClass, const FVector& Location, const FRotator& Rotation);
 
+	// ==================== Prewarm ====================
+
+	/** Work out everything the waves (or the sustain roster) can have in play at once: weapons, drops
+	 *  and pickups go to UActorPoolSubsystem right away, NPCs and Niagara warm-ups are queued for PrewarmStep */
+	void BuildPrewarmManifest();
+
+	/** Queue whatever NPCPool is short of NPCPrewarmTargets (after BuildPrewarmManifest, and after a reset destroyed some) */
+	void QueueNPCPrewarm();
+
+	/** Create the next few queued NPCs and Niagara warm-ups; reschedules itself while any are left */
+	void PrewarmStep();
+
+	/** Parked NPCs per class the manifest wants in NPCPool */
+	TMap<TSubclassOf<AShooterNPC>, int32> NPCPrewarmTargets;
+
+	/** NPCs still to spawn and park, per class */
+	TMap<TSubclassOf<AShooterNPC>, int32> PendingNPCPrewarm;
+
+	/** Niagara systems the manifest's classes reference, not yet warmed */
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraSystem>> PendingVFXPrewarm;
+
+	/** Next-tick timer for PrewarmStep, so a top-up does not schedule it twice */
+	FTimerHandle PrewarmTimerHandle;
+
+	/** Where prewarmed NPCs are spawned and parked, out of sight and out of everybody's way */
+	FVector PrewarmParkingLocation = FVector(0.0f, 0.0f, -100000.0f);
+
 	// ==================== Auto-Indexed Props ====================
 
 	/** Register auto-found props: bind death, cache transforms */
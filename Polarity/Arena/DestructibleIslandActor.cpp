@@ -11,6 +11,7 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Engine/DamageEvents.h"
 #include "DestroyedIslandsSubsystem.h"
+#include "Polarity/Variant_Shooter/AI/FlightFieldSubsystem.h"
 
 ADestructibleIslandActor::ADestructibleIslandActor()
 {
@@ -43,6 +44,10 @@ void ADestructibleIslandActor::BeginPlay()
 				bIsDestroyed = true;
 				IslandMesh->SetVisibility(false);
 				IslandMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+				if (UFlightFieldSubsystem* FlightField = GetWorld()->GetSubsystem<UFlightFieldSubsystem>())
+				{
+					FlightField->Invalidate(IslandMesh->Bounds.GetBox());
+				}
 				UE_LOG(LogTemp, Log, TEXT("DestructibleIsland [%s]: Already destroyed — hiding on BeginPlay"), *IslandID.ToString());
 				return;
 			}
@@ -186,6 +191,12 @@ void ADestructibleIslandActor::DestroyIsland(AActor* Destroyer)
 	IslandMesh->SetVisibility(false);
 	IslandMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+	// Flying NPCs stop treating the island's space as solid once the field rebuilds it
+	if (UFlightFieldSubsystem* FlightField = GetWorld()->GetSubsystem<UFlightFieldSubsystem>())
+	{
+		FlightField->Invalidate(IslandMesh->Bounds.GetBox());
+	}
+
 	// Spawn VFX/debris actor
 	if (DestroyedEffectClass)
 	{
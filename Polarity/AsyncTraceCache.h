@@ -0,0 +1,185 @@
+// AsyncTraceCache.h
+// Line trace results kept per key and refreshed in the background by async traces
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+
+/** The last answer for one key */
+struct FAsyncTraceCacheEntry
+{
+	/** Endpoints of the trace the answer came from */
+	FVector From = FVector::ZeroVector;
+	FVector To = FVector::ZeroVector;
+
+	/** World time the answer was traced or landed, and the last Lookup of the key */
+	double ResultTime = -1.0;
+	double LastUsedTime = 0.0;
+
+	/** The trace had a blocking hit */
+	bool bBlocked = false;
+	bool bHasResult = false;
+
+	/** An async trace for the key is out; no second one is issued until it lands */
+	bool bPending = false;
+};
+
+/** What Lookup makes of a key's entry */
+enum class EAsyncTraceCacheLookup : uint8
+{
+	/** No answer, or one older than MaxStaleness: trace synchronously and StoreResult it */
+	Miss,
+
+	/** Traced or landed at the current world time */
+	ThisFrame,
+
+	/** Older, still within MaxStaleness, refresh not due yet (or already out) */
+	Cached,
+
+	/** As Cached, but past RefreshInterval or an end moved past MoveTolerance: worth a BeginAsyncTrace */
+	RefreshDue
+};
+
+/** When an answer is served, refreshed, or thrown away; filled from the owner's CVars per lookup */
+struct FAsyncTraceCachePolicy
+{
+	double MaxStaleness = 0.0;
+	double RefreshInterval = 0.0;
+	float MoveTolerance = 0.0f;
+};
+
+/**
+ * Blocking-hit answers of line traces, one per caller-defined key, with the async refresh
+ * bookkeeping around them. The owner keeps the tracing itself, since only it knows the channel and
+ * what to leave out: on RefreshDue it calls BeginAsyncTrace and passes the returned UserData to its
+ * AsyncLineTrace, and its FTraceDelegate hands the datum to CompleteAsyncTrace.
+ *
+ * Pending traces sit in slots recycled on completion; the slot index is the UserData. A key that
+ * expires with a trace out stays until the trace lands, so a completion always finds its entry
+ * unless Reset ran in between.
+ *
+ * Owned by UEMFLOSCacheSubsystem (receiver and source) and UAILineOfSightSubsystem (observer,
+ * target and sample). KeyType needs GetTypeHash and operator==.
+ */
+template<typename KeyType>
+class TAsyncTraceCache
+{
+public:
+
+	/** Entry for Key, added empty if there is none, marked used at Now and classified for a ray From -> To */
+	FAsyncTraceCacheEntry& Lookup(const KeyType& Key, double Now, const FVector& From, const FVector& To,
+		const FAsyncTraceCachePolicy& Policy, EAsyncTraceCacheLookup& OutLookup)
+	{
+		FAsyncTraceCacheEntry& Entry = Entries.FindOrAdd(Key);
+		Entry.LastUsedTime = Now;
+
+		const double Age = Now - Entry.ResultTime;
+		if (!Entry.bHasResult || Age > FMath::Max(Policy.MaxStaleness, 0.0))
+		{
+			OutLookup = EAsyncTraceCacheLookup::Miss;
+		}
+		else if (Age <= 0.0)
+		{
+			OutLookup = EAsyncTraceCacheLookup::ThisFrame;
+		}
+		else
+		{
+			const float MoveToleranceSq = FMath::Square(Policy.MoveTolerance);
+			const bool bMoved = FVector::DistSquared(From, Entry.From) > MoveToleranceSq
+				|| FVector::DistSquared(To, Entry.To) > MoveToleranceSq;
+
+			OutLookup = (!Entry.bPending && (Age >= Policy.RefreshInterval || bMoved))
+				? EAsyncTraceCacheLookup::RefreshDue
+				: EAsyncTraceCacheLookup::Cached;
+		}
+		return Entry;
+	}
+
+	/** Record a synchronous answer */
+	static void StoreResult(FAsyncTraceCacheEntry& Entry, bool bBlocked, double Now, const FVector& From, const FVector& To)
+	{
+		Entry.bBlocked = bBlocked;
+		Entry.bHasResult = true;
+		Entry.ResultTime = Now;
+		Entry.From = From;
+		Entry.To = To;
+	}
+
+	/** Mark Entry's refresh as out and return the UserData its async trace must carry */
+	uint32 BeginAsyncTrace(const KeyType& Key, FAsyncTraceCacheEntry& Entry, const FVector& From, const FVector& To)
+	{
+		const int32 Slot = FreePendingSlots.Num() > 0 ? FreePendingSlots.Pop(EAllowShrinking::No) : PendingTraces.AddDefaulted();
+
+		FPendingTrace& Pending = PendingTraces[Slot];
+		Pending.Key = Key;
+		Pending.From = From;
+		Pending.To = To;
+		Pending.bInUse = true;
+		Entry.bPending = true;
+
+		return static_cast<uint32>(Slot);
+	}
+
+	/** Store a landed async trace against its key; null if the slot is unknown (Reset since) */
+	const FAsyncTraceCacheEntry* CompleteAsyncTrace(const FTraceDatum& Datum, double Now)
+	{
+		const int32 Slot = static_cast<int32>(Datum.UserData);
+		if (!PendingTraces.IsValidIndex(Slot) || !PendingTraces[Slot].bInUse)
+		{
+			return nullptr;
+		}
+
+		FPendingTrace& Pending = PendingTraces[Slot];
+		Pending.bInUse = false;
+		FreePendingSlots.Add(Slot);
+
+		FAsyncTraceCacheEntry* Entry = Entries.Find(Pending.Key);
+		if (!Entry)
+		{
+			return nullptr;
+		}
+
+		Entry->bPending = false;
+		StoreResult(*Entry, Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; }),
+			Now, Pending.From, Pending.To);
+		return Entry;
+	}
+
+	/** Drop keys not looked up for UnusedSeconds, except those with a trace out */
+	void Expire(double Now, double UnusedSeconds)
+	{
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (!It->Value.bPending && Now - It->Value.LastUsedTime > UnusedSeconds)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	/** Forget everything; traces still out complete into nothing */
+	void Reset()
+	{
+		Entries.Empty();
+		PendingTraces.Empty();
+		FreePendingSlots.Empty();
+	}
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+
+	struct FPendingTrace
+	{
+		KeyType Key{};
+		FVector From = FVector::ZeroVector;
+		FVector To = FVector::ZeroVector;
+		bool bInUse = false;
+	};
+
+	TMap<KeyType, FAsyncTraceCacheEntry> Entries;
+
+	TArray<FPendingTrace> PendingTraces;
+	TArray<int32> FreePendingSlots;
+};
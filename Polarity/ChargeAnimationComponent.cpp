@@ -19,6 +19,7 @@
 #include "PhysicsEngine/PhysicsHandleComponent.h"
 #include "ShooterWeapon.h"
 #include "EMF_FieldComponent.h"
+#include "EMFSourceIndexSubsystem.h"
 #include "EMFPhysicsProp.h"
 #include "EMFAcceleratorPlate.h"
 #include "Variant_Shooter/Weapons/DroppedMeleeWeapon.h"
@@ -2406,11 +2407,7 @@ void UChargeAnimationComponent::BeginLaunch()
 void UChargeAnimationComponent::EnterFinishingAnimation()
 {
 	// Re-enable player's EMF field
-	if (CachedFieldComponent && bFieldWasRegistered)
-	{
-		CachedFieldComponent->RegisterWithRegistry();
-		bFieldWasRegistered = false;
-	}
+	RestorePlayerField();
 
 	// Resume montage playback
 	if (MeleeMesh && CurrentMontage)
@@ -2482,11 +2479,7 @@ void UChargeAnimationComponent::CleanupChanneling()
 	}
 
 	// Re-register player field if it was unregistered
-	if (CachedFieldComponent && bFieldWasRegistered)
-	{
-		CachedFieldComponent->RegisterWithRegistry();
-		bFieldWasRegistered = false;
-	}
+	RestorePlayerField();
 
 	// Restore left hand IK
 	if (ShooterCharacter)
@@ -2504,6 +2497,22 @@ void UChargeAnimationComponent::CleanupChanneling()
 	}
 }
 
+void UChargeAnimationComponent::RestorePlayerField()
+{
+	if (!CachedFieldComponent || !bFieldWasRegistered)
+	{
+		return;
+	}
+
+	CachedFieldComponent->RegisterWithRegistry();
+	bFieldWasRegistered = false;
+
+	if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+	{
+		SourceIndex->RegisterFieldComponent(CachedFieldComponent);
+	}
+}
+
 // ==================== Mesh Transition ====================
 
 void UChargeAnimationComponent::BeginHideWeapon()
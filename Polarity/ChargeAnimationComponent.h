@@ -928,4 +928,8 @@ protected:
 
 	/** Cleanup all channeling state (safety — called on EndPlay/cancel) */
 	void CleanupChanneling();
+
+	/** Put the player's field back in the registry if channeling took it out, and make sure the
+	 *  source index knows it (a moving source it does not know gets a new id every frame) */
+	void RestorePlayerField();
 };
@@ -0,0 +1,373 @@
+// EMFBenchmarkSubsystem.cpp
+
+#include "EMFBenchmarkSubsystem.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "EMFVelocityModifier.h"
+#include "EMFPhysicsProp.h"
+#include "Variant_Shooter/AI/ShooterNPC.h"
+#include "Variant_Shooter/Weapons/EMFProjectile.h"
+#include "GameFramework/PlayerStart.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "HAL/IConsoleManager.h"
+
+namespace EMFBenchmark
+{
+	/** Layout, in cm around the centre */
+	static constexpr float NPCRingRadius = 1200.0f;
+	static constexpr float NPCRingSpacing = 350.0f;
+	static constexpr int32 NPCsPerRing = 12;
+	static constexpr float PropSpacing = 250.0f;
+	static constexpr float ProjectileLaunchRadius = 3000.0f;
+
+	static TSubclassOf<AActor> LoadClassArg(const TCHAR* Switch)
+	{
+		FString Path;
+		if (!FParse::Value(FCommandLine::Get(), Switch, Path))
+		{
+			return nullptr;
+		}
+
+		UClass* Class = LoadClass<AActor>(nullptr, *Path);
+		if (!Class)
+		{
+			UE_LOG(LogEMF, Warning, TEXT("[EMF_BENCH] %s%s: class not found, using the default"), Switch, *Path);
+		}
+		return Class;
+	}
+
+	static uint64 GetMallocCalls()
+	{
+#if STATS && !UE_BUILD_SHIPPING
+		return FMalloc::TotalMallocCalls;
+#else
+		return 0;
+#endif
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFBenchmarkStartCmd(
+	TEXT("EMF.Benchmark.Start"),
+	TEXT("Spawn the EMF benchmark layout and capture a per-frame CSV. Args: [NPCs=20] [Props=40] [Projectiles=20] [Frames=600]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UEMFBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<UEMFBenchmarkSubsystem>() : nullptr;
+		if (!Benchmark)
+		{
+			return;
+		}
+
+		FEMFBenchmarkConfig Config;
+		if (Args.Num() > 0) { Config.NumNPCs = FMath::Max(FCString::Atoi(*Args[0]), 0); }
+		if (Args.Num() > 1) { Config.NumProps = FMath::Max(FCString::Atoi(*Args[1]), 0); }
+		if (Args.Num() > 2) { Config.NumProjectiles = FMath::Max(FCString::Atoi(*Args[2]), 0); }
+		if (Args.Num() > 3) { Config.NumFrames = FMath::Max(FCString::Atoi(*Args[3]), 1); }
+		Benchmark->StartRun(Config);
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFBenchmarkStopCmd(
+	TEXT("EMF.Benchmark.Stop"),
+	TEXT("End the running EMF benchmark now and write what was captured"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UEMFBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<UEMFBenchmarkSubsystem>() : nullptr)
+		{
+			Benchmark->StopRun();
+		}
+	}));
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FEMFBenchmarkConfig CommandLineConfig;
+	if (ParseCommandLine(CommandLineConfig))
+	{
+		StartRun(CommandLineConfig);
+	}
+}
+
+void UEMFBenchmarkSubsystem::Deinitialize()
+{
+	StopRun();
+
+	Super::Deinitialize();
+}
+
+TStatId UEMFBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEMFBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+bool UEMFBenchmarkSubsystem::ParseCommandLine(FEMFBenchmarkConfig& OutConfig)
+{
+	FString Spec;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("EMFBenchmark="), Spec))
+	{
+		return false;
+	}
+
+	// NPCs,Props,Projectiles,Frames; missing fields keep their defaults
+	TArray<FString> Fields;
+	Spec.ParseIntoArray(Fields, TEXT(","));
+	if (Fields.Num() > 0) { OutConfig.NumNPCs = FMath::Max(FCString::Atoi(*Fields[0]), 0); }
+	if (Fields.Num() > 1) { OutConfig.NumProps = FMath::Max(FCString::Atoi(*Fields[1]), 0); }
+	if (Fields.Num() > 2) { OutConfig.NumProjectiles = FMath::Max(FCString::Atoi(*Fields[2]), 0); }
+	if (Fields.Num() > 3) { OutConfig.NumFrames = FMath::Max(FCString::Atoi(*Fields[3]), 1); }
+
+	int32 Seed = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("EMFBenchmarkSeed="), Seed))
+	{
+		OutConfig.Seed = static_cast<uint32>(Seed);
+	}
+	FParse::Value(FCommandLine::Get(), TEXT("EMFBenchmarkWarmup="), OutConfig.WarmupFrames);
+
+	OutConfig.bQuitWhenDone = FParse::Param(FCommandLine::Get(), TEXT("EMFBenchmarkQuit"));
+	OutConfig.NPCClass = EMFBenchmark::LoadClassArg(TEXT("EMFBenchmarkNPC="));
+	OutConfig.PropClass = EMFBenchmark::LoadClassArg(TEXT("EMFBenchmarkProp="));
+	OutConfig.ProjectileClass = EMFBenchmark::LoadClassArg(TEXT("EMFBenchmarkProjectile="));
+	return true;
+}
+
+// ==================== Run ====================
+
+bool UEMFBenchmarkSubsystem::StartRun(const FEMFBenchmarkConfig& InConfig)
+{
+	if (bRunning)
+	{
+		UE_LOG(LogEMF, Warning, TEXT("[EMF_BENCH] A run is already in progress"));
+		return false;
+	}
+
+	Config = InConfig;
+	if (!Config.NPCClass) { Config.NPCClass = AShooterNPC::StaticClass(); }
+	if (!Config.PropClass) { Config.PropClass = AEMFPhysicsProp::StaticClass(); }
+	if (!Config.ProjectileClass) { Config.ProjectileClass = AEMFProjectile::StaticClass(); }
+
+	// Same simulated time every frame, whatever the machine
+	bSavedUseFixedTimeStep = FApp::UseFixedTimeStep();
+	SavedFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(Config.FixedDeltaTime);
+
+	Center = FVector::ZeroVector;
+	for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
+	{
+		Center = It->GetActorLocation();
+		break;
+	}
+
+	SpawnLayout();
+
+	bRunning = true;
+	bCapturing = false;
+	FrameIndex = 0;
+
+	UE_LOG(LogEMF, Log, TEXT("[EMF_BENCH] Started: %d NPCs, %d props, %d projectiles, %d frames after %d warm-up, seed %u"),
+		Config.NumNPCs, Config.NumProps, Config.NumProjectiles, Config.NumFrames, Config.WarmupFrames, Config.Seed);
+	return true;
+}
+
+void UEMFBenchmarkSubsystem::StopRun()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+#if CSV_PROFILER
+	if (bCapturing && FCsvProfiler::Get()->IsCapturing())
+	{
+		FCsvProfiler::Get()->EndCapture();
+	}
+#endif
+
+	bRunning = false;
+	bCapturing = false;
+
+	DestroyLayout();
+	FApp::SetUseFixedTimeStep(bSavedUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(SavedFixedDeltaTime);
+
+	UE_LOG(LogEMF, Log, TEXT("[EMF_BENCH] Finished after %d captured frames"), FMath::Max(FrameIndex - Config.WarmupFrames, 0));
+
+	if (Config.bQuitWhenDone)
+	{
+		// The capture is written on a background thread; a normal exit waits for it
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void UEMFBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	// Keep the projectile count constant: a dead one is refired from its own slot
+	for (int32 i = 0; i < Projectiles.Num(); ++i)
+	{
+		if (!Projectiles[i].IsValid())
+		{
+			FireProjectile(i);
+		}
+	}
+
+	if (FrameIndex == Config.WarmupFrames)
+	{
+#if CSV_PROFILER
+		CSV_METADATA(TEXT("EMFBenchmarkNPCs"), *FString::FromInt(Config.NumNPCs));
+		CSV_METADATA(TEXT("EMFBenchmarkProps"), *FString::FromInt(Config.NumProps));
+		CSV_METADATA(TEXT("EMFBenchmarkProjectiles"), *FString::FromInt(Config.NumProjectiles));
+		CSV_METADATA(TEXT("EMFBenchmarkSeed"), *FString::Printf(TEXT("%u"), Config.Seed));
+
+		const FString Filename = FString::Printf(TEXT("EMFBenchmark_%d_%d_%d_%s.csv"),
+			Config.NumNPCs, Config.NumProps, Config.NumProjectiles, *FDateTime::Now().ToString());
+		FCsvProfiler::Get()->BeginCapture(Config.NumFrames, FPaths::ProfilingDir() / TEXT("CSV") / TEXT("EMFBenchmark"), Filename);
+		bCapturing = true;
+#else
+		UE_LOG(LogEMF, Warning, TEXT("[EMF_BENCH] This build has no CSV profiler; nothing will be written"));
+#endif
+		LastMallocCalls = EMFBenchmark::GetMallocCalls();
+	}
+
+	if (bCapturing)
+	{
+		const uint64 MallocCalls = EMFBenchmark::GetMallocCalls();
+		CSV_CUSTOM_STAT(EMF, Mallocs, static_cast<int32>(MallocCalls - LastMallocCalls), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(EMF, LiveProjectiles, Projectiles.Num(), ECsvCustomStatOp::Set);
+		LastMallocCalls = MallocCalls;
+	}
+
+	++FrameIndex;
+	if (FrameIndex >= Config.WarmupFrames + Config.NumFrames)
+	{
+		StopRun();
+	}
+}
+
+// ==================== Layout ====================
+
+void UEMFBenchmarkSubsystem::SpawnLayout()
+{
+	UWorld* World = GetWorld();
+	FRandomStream Rng(Config.Seed);
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// NPCs: concentric rings, alternating charge sign
+	for (int32 i = 0; i < Config.NumNPCs; ++i)
+	{
+		const int32 Ring = i / EMFBenchmark::NPCsPerRing;
+		const float Angle = 2.0f * PI * (i % EMFBenchmark::NPCsPerRing) / EMFBenchmark::NPCsPerRing + Ring * 0.3f;
+		const float Radius = EMFBenchmark::NPCRingRadius + Ring * EMFBenchmark::NPCRingSpacing;
+		const FVector Location = Center + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 100.0f);
+
+		AActor* NPC = World->SpawnActor<AActor>(Config.NPCClass, Location, (Center - Location).Rotation(), Params);
+		if (!NPC)
+		{
+			continue;
+		}
+
+		if (APawn* Pawn = Cast<APawn>(NPC); Pawn && !Pawn->GetController())
+		{
+			Pawn->SpawnDefaultController();
+		}
+		if (UEMFVelocityModifier* Modifier = NPC->FindComponentByClass<UEMFVelocityModifier>())
+		{
+			Modifier->SetCharge(Rng.FRandRange(10.0f, 40.0f) * ((i & 1) ? -1.0f : 1.0f));
+		}
+		SpawnedActors.Add(NPC);
+	}
+
+	// Props: square grid inside the NPC rings
+	const int32 Side = FMath::Max(FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Config.NumProps))), 1);
+	for (int32 i = 0; i < Config.NumProps; ++i)
+	{
+		const FVector Offset(
+			((i % Side) - (Side - 1) * 0.5f) * EMFBenchmark::PropSpacing,
+			((i / Side) - (Side - 1) * 0.5f) * EMFBenchmark::PropSpacing,
+			50.0f);
+
+		AActor* Prop = World->SpawnActor<AActor>(Config.PropClass, Center + Offset, FRotator::ZeroRotator, Params);
+		if (!Prop)
+		{
+			continue;
+		}
+
+		if (AEMFPhysicsProp* EMFProp = Cast<AEMFPhysicsProp>(Prop))
+		{
+			EMFProp->SetCharge(Rng.FRandRange(5.0f, 20.0f) * (Rng.FRand() < 0.5f ? -1.0f : 1.0f));
+		}
+		SpawnedActors.Add(Prop);
+	}
+
+	// Projectiles: fixed launch points on a circle, aimed through the middle
+	Projectiles.SetNum(Config.NumProjectiles);
+	ProjectileCharges.SetNum(Config.NumProjectiles);
+	for (int32 i = 0; i < Config.NumProjectiles; ++i)
+	{
+		ProjectileCharges[i] = Rng.FRandRange(5.0f, 15.0f) * ((i % 3 == 0) ? -1.0f : 1.0f);
+		FireProjectile(i);
+	}
+}
+
+void UEMFBenchmarkSubsystem::FireProjectile(int32 Index)
+{
+	const float Angle = 2.0f * PI * Index / FMath::Max(Config.NumProjectiles, 1);
+	const FVector Launch = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * EMFBenchmark::ProjectileLaunchRadius + FVector(0.0f, 0.0f, 150.0f);
+
+	// Aim slightly off centre, so they cross the layout instead of all meeting at one point
+	const FVector Target = Center + FVector(FMath::Sin(Angle), -FMath::Cos(Angle), 0.0f) * 400.0f + FVector(0.0f, 0.0f, 150.0f);
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Projectile = GetWorld()->SpawnActor<AActor>(Config.ProjectileClass, Launch, (Target - Launch).Rotation(), Params);
+	if (AEMFProjectile* EMFProjectile = Cast<AEMFProjectile>(Projectile))
+	{
+		EMFProjectile->SetProjectileCharge(ProjectileCharges[Index]);
+	}
+	Projectiles[Index] = Projectile;
+}
+
+void UEMFBenchmarkSubsystem::DestroyLayout()
+{
+	for (const TWeakObjectPtr<AActor>& Actor : SpawnedActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+	for (const TWeakObjectPtr<AActor>& Actor : Projectiles)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+
+	SpawnedActors.Reset();
+	Projectiles.Reset();
+	ProjectileCharges.Reset();
+}
@@ -0,0 +1,106 @@
+// EMFBenchmarkSubsystem.h
+// Headless EMF benchmark: fixed layout of charged actors, N frames, per-frame CSV
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EMFBenchmarkSubsystem.generated.h"
+
+/** What one benchmark run spawns and for how long */
+struct FEMFBenchmarkConfig
+{
+	int32 NumNPCs = 20;
+	int32 NumProps = 40;
+	int32 NumProjectiles = 20;
+
+	/** Frames captured to CSV, after WarmupFrames uncaptured ones */
+	int32 NumFrames = 600;
+	int32 WarmupFrames = 60;
+
+	/** Fixed step for the run, so every run simulates the same thing */
+	float FixedDeltaTime = 1.0f / 60.0f;
+
+	uint32 Seed = 1;
+
+	/** Ask the engine to exit once the CSV is written (command-line runs) */
+	bool bQuitWhenDone = false;
+
+	/** Spawned classes; null means the C++ base (AShooterNPC, AEMFPhysicsProp, AEMFProjectile) */
+	TSubclassOf<AActor> NPCClass;
+	TSubclassOf<AActor> PropClass;
+	TSubclassOf<AActor> ProjectileClass;
+};
+
+/**
+ * Measures what the EMF path costs with a known number of receivers, without anybody playing.
+ *
+ * A run spawns charged NPCs on rings, props on a grid and projectiles fired across the middle,
+ * all around the first player start (or the origin), with charges from a seeded stream. The
+ * engine is put on a fixed time step, and after a warm-up the CSV profiler captures NumFrames
+ * frames. Projectiles that die are refired from the same slot, so the count holds.
+ *
+ * The CSV has the engine's own columns (FrameTime, GameThreadTime, ...) plus the EMF category:
+ * timers for receiver updates and the solver, LOS trace counts, and Mallocs (allocator calls in
+ * the whole frame, non-shipping builds). It lands in Saved/Profiling/CSV/EMFBenchmark.
+ *
+ * From the command line (see Tools/EMFBenchmark/run_emf_benchmark.sh):
+ *   -nullrhi -benchmark -EMFBenchmark=NPCs,Props,Projectiles,Frames -EMFBenchmarkQuit
+ * optionally with -EMFBenchmarkNPC=/Game/...BP_X.BP_X_C (and ...Prop=, ...Projectile=).
+ * In a running game: EMF.Benchmark.Start [NPCs] [Props] [Projectiles] [Frames].
+ */
+UCLASS()
+class POLARITY_API UEMFBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return bRunning; }
+
+	// ==================== API ====================
+
+	/** Spawn the layout and start counting frames. False if a run is already going. */
+	bool StartRun(const FEMFBenchmarkConfig& InConfig);
+
+	/** Stop early; whatever was captured is still written */
+	void StopRun();
+
+	bool IsRunning() const { return bRunning; }
+
+	/** Config from -EMFBenchmark= and friends; false if the switch is absent */
+	static bool ParseCommandLine(FEMFBenchmarkConfig& OutConfig);
+
+private:
+	void SpawnLayout();
+	void DestroyLayout();
+
+	/** Fire (or refire) projectile slot Index from its fixed start */
+	void FireProjectile(int32 Index);
+
+	FVector Center = FVector::ZeroVector;
+	FEMFBenchmarkConfig Config;
+
+	bool bRunning = false;
+	bool bCapturing = false;
+	int32 FrameIndex = 0;
+
+	/** Time step settings to put back afterwards */
+	bool bSavedUseFixedTimeStep = false;
+	double SavedFixedDeltaTime = 0.0;
+
+	/** Allocator call count at the previous frame */
+	uint64 LastMallocCalls = 0;
+
+	TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+	TArray<TWeakObjectPtr<AActor>> Projectiles;
+	TArray<float> ProjectileCharges;
+};
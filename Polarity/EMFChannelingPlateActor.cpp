@@ -2,6 +2,7 @@
 
 #include "EMFChannelingPlateActor.h"
 #include "EMF_FieldComponent.h"
+#include "EMFSourceIndexSubsystem.h"
 #include "EMF_PluginBPLibrary.h"
 #include "DrawDebugHelpers.h"
 
@@ -47,6 +48,12 @@ void AEMFChannelingPlateActor::BeginPlay()
 	if (PlateFieldComponent)
 	{
 		PlateFieldComponent->RegisterWithRegistry();
+
+		// The plate follows the camera every frame; known to the index, it keeps one source id for the LOS cache
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(PlateFieldComponent);
+		}
 	}
 }
 
@@ -56,6 +63,11 @@ void AEMFChannelingPlateActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (PlateFieldComponent)
 	{
 		PlateFieldComponent->UnregisterFromRegistry();
+
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->UnregisterFieldComponent(PlateFieldComponent);
+		}
 	}
 
 	Super::EndPlay(EndPlayReason);
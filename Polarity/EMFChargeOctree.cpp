@@ -0,0 +1,285 @@
+// EMFChargeOctree.cpp
+
+#include "EMFChargeOctree.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFBarnesHutBenchmarkCmd(
+	TEXT("EMF.BarnesHut.Benchmark"),
+	TEXT("Compare Barnes-Hut against exact evaluation on a synthetic swarm. Args: [Charges=500] [Receivers=200] [Seed=1]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumCharges = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+		const int32 NumReceivers = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 200;
+		FRandomStream Rng(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 1);
+
+		// Swarms: clusters of ~25 charges a few metres across, spread over an arena-sized area
+		TArray<FEMSourceDescription> Sources;
+		Sources.Reserve(NumCharges);
+		const int32 NumClusters = FMath::Max(NumCharges / 25, 1);
+		TArray<FVector> ClusterCenters;
+		for (int32 c = 0; c < NumClusters; ++c)
+		{
+			ClusterCenters.Add(FVector(Rng.FRandRange(-10000.0f, 10000.0f), Rng.FRandRange(-10000.0f, 10000.0f), Rng.FRandRange(0.0f, 2000.0f)));
+		}
+		for (int32 i = 0; i < NumCharges; ++i)
+		{
+			FEMSourceDescription Source;
+			Source.SourceType = EEMSourceType::PointCharge;
+			Source.OwnerType = (i & 1) ? EEMSourceOwnerType::Projectile : EEMSourceOwnerType::NPC;
+			Source.bIsStatic = false;
+			Source.Position = ClusterCenters[i % NumClusters] + Rng.GetUnitVector() * Rng.FRandRange(0.0f, 600.0f);
+			Source.PointChargeParams.Charge = Rng.FRandRange(5.0f, 20.0f) * (Rng.FRand() < 0.7f ? 1.0f : -1.0f);
+			Sources.Add(Source);
+		}
+
+		TArray<FVector> Receivers;
+		for (int32 r = 0; r < NumReceivers; ++r)
+		{
+			Receivers.Add(FVector(Rng.FRandRange(-10000.0f, 10000.0f), Rng.FRandRange(-10000.0f, 10000.0f), Rng.FRandRange(0.0f, 2000.0f)));
+		}
+
+		FEMFForceFilter Filter;
+		Filter.MaxSourceDistance = 40000.0f;
+
+		double BuildStart = FPlatformTime::Seconds();
+		FEMFChargeOctree Tree;
+		Tree.Build(Sources);
+		const double BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+
+		FEMFForceKernel Kernel;
+		FEMFForceResult Result;
+		TArray<const FEMSourceDescription*> Gathered;
+		TArray<FEMSourceDescription> Aggregates;
+		TArray<FVector> ExactForces;
+		double ExactMs = 0.0;
+
+		UE_LOG(LogEMF, Log, TEXT("[EMF_BH] %d charges in %d clusters, %d receivers, tree %d nodes built in %.3f ms"),
+			NumCharges, NumClusters, NumReceivers, Tree.NumNodes(), BuildMs);
+
+		const float Thetas[] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+		for (const float Theta : Thetas)
+		{
+			double ErrorSum = 0.0;
+			double ErrorMax = 0.0;
+			int64 Terms = 0;
+
+			const double Start = FPlatformTime::Seconds();
+			for (int32 r = 0; r < NumReceivers; ++r)
+			{
+				Gathered.Reset();
+				Aggregates.Reset();
+				Tree.Traverse(Receivers[r], Filter.MaxSourceDistance, Theta, INDEX_NONE,
+					[&Gathered, &Sources](int32 SourceIndex) { Gathered.Add(&Sources[SourceIndex]); },
+					[&Aggregates, &Sources](int32 Template, const FVector& Position, float Charge)
+					{
+						Aggregates.Add(FEMFChargeOctree::MakeAggregate(Sources[Template], Position, Charge));
+					});
+				for (const FEMSourceDescription& Aggregate : Aggregates)
+				{
+					Gathered.Add(&Aggregate);
+				}
+				Terms += Gathered.Num();
+
+				Kernel.Evaluate(Receivers[r], FVector::ZeroVector, 1.0f, Filter, Gathered, Result);
+
+				if (Theta == 0.0f)
+				{
+					ExactForces.Add(Result.Force);
+					continue;
+				}
+
+				const double Error = (Result.Force - ExactForces[r]).Size() / FMath::Max(ExactForces[r].Size(), UE_SMALL_NUMBER);
+				ErrorSum += Error;
+				ErrorMax = FMath::Max(ErrorMax, Error);
+			}
+			const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+			if (Theta == 0.0f)
+			{
+				ExactMs = Ms;
+				UE_LOG(LogEMF, Log, TEXT("[EMF_BH] exact:      %8.3f ms, %6.1f sources/receiver"),
+					Ms, static_cast<double>(Terms) / NumReceivers);
+				continue;
+			}
+
+			UE_LOG(LogEMF, Log, TEXT("[EMF_BH] theta %.2f: %8.3f ms (%5.2fx), %6.1f terms/receiver, error mean %.4f%% max %.4f%%"),
+				Theta, Ms, ExactMs / FMath::Max(Ms, UE_SMALL_NUMBER), static_cast<double>(Terms) / NumReceivers,
+				100.0 * ErrorSum / NumReceivers, 100.0 * ErrorMax);
+		}
+	}));
+
+// ==================== Build ====================
+
+bool FEMFChargeOctree::IsAggregatable(const FEMSourceDescription& Source)
+{
+	return Source.SourceType == EEMSourceType::PointCharge
+		&& !Source.bIsStatic
+		&& !FEMFForceKernel::IsSourceEffectivelyZero(Source);
+}
+
+void FEMFChargeOctree::Reset()
+{
+	BuiltSources = TConstArrayView<FEMSourceDescription>();
+	Nodes.Reset();
+	Entries.Reset();
+	SourceSlots.Reset();
+}
+
+void FEMFChargeOctree::Build(TConstArrayView<FEMSourceDescription> Sources)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EMF_BarnesHutBuild);
+
+	Reset();
+	BuiltSources = Sources;
+
+	FBox Box(ForceInit);
+	for (int32 i = 0; i < Sources.Num(); ++i)
+	{
+		if (IsAggregatable(Sources[i]))
+		{
+			Entries.Add(i);
+			Box += Sources[i].Position;
+		}
+	}
+
+	if (Entries.Num() == 0)
+	{
+		SET_DWORD_STAT(STAT_EMF_BarnesHutNodes, 0);
+		return;
+	}
+
+	FNode& Root = Nodes.AddDefaulted_GetRef();
+	Root.Begin = 0;
+	Root.End = Entries.Num();
+	BuildNode(0, Box.GetCenter(), FMath::Max(Box.GetExtent().GetMax(), 1.0), 0);
+
+	SourceSlots.Init(INDEX_NONE, Sources.Num());
+	for (int32 Slot = 0; Slot < Entries.Num(); ++Slot)
+	{
+		SourceSlots[Entries[Slot]] = Slot;
+	}
+
+	SET_DWORD_STAT(STAT_EMF_BarnesHutNodes, Nodes.Num());
+}
+
+void FEMFChargeOctree::BuildNode(int32 NodeIndex, const FVector& CellCenter, float HalfSize, int32 Depth)
+{
+	// Nodes grows below this point, so only ever reach it by index
+	const int32 Begin = Nodes[NodeIndex].Begin;
+	const int32 End = Nodes[NodeIndex].End;
+
+	FBox Bounds(ForceInit);
+	for (int32 Slot = Begin; Slot < End; ++Slot)
+	{
+		Bounds += BuiltSources[Entries[Slot]].Position;
+	}
+	Nodes[NodeIndex].Bounds = Bounds;
+
+	if (End - Begin <= MaxLeafEntries || Depth >= MaxDepth)
+	{
+		for (int32 Slot = Begin; Slot < End; ++Slot)
+		{
+			const FEMSourceDescription& Source = BuiltSources[Entries[Slot]];
+			const float Charge = Source.PointChargeParams.Charge;
+
+			FAggregate Member;
+			Member.WeightedPosition = Source.Position * FMath::Abs(Charge);
+			Member.Charge = Charge;
+			Member.Template = Entries[Slot];
+			Nodes[NodeIndex].Aggregates[EMFForce::OwnerTypeIndex(Source.OwnerType)][Charge < 0.0f ? 1 : 0].Add(Member);
+		}
+		return;
+	}
+
+	// Counting sort of the contents into octants
+	auto Octant = [this, &CellCenter](int32 Slot)
+	{
+		const FVector& P = BuiltSources[Entries[Slot]].Position;
+		return (P.X >= CellCenter.X ? 1 : 0) | (P.Y >= CellCenter.Y ? 2 : 0) | (P.Z >= CellCenter.Z ? 4 : 0);
+	};
+
+	int32 Counts[8] = {};
+	for (int32 Slot = Begin; Slot < End; ++Slot)
+	{
+		++Counts[Octant(Slot)];
+	}
+
+	int32 Cursor[8];
+	int32 Running = 0;
+	int32 NumChildren = 0;
+	for (int32 o = 0; o < 8; ++o)
+	{
+		Cursor[o] = Running;
+		Running += Counts[o];
+		NumChildren += Counts[o] > 0 ? 1 : 0;
+	}
+
+	Scratch.SetNumUninitialized(End - Begin, EAllowShrinking::No);
+	for (int32 Slot = Begin; Slot < End; ++Slot)
+	{
+		Scratch[Cursor[Octant(Slot)]++] = Entries[Slot];
+	}
+	FMemory::Memcpy(Entries.GetData() + Begin, Scratch.GetData(), (End - Begin) * sizeof(int32));
+
+	const int32 FirstChild = Nodes.Num();
+	Nodes.AddDefaulted(NumChildren);
+	Nodes[NodeIndex].FirstChild = FirstChild;
+	Nodes[NodeIndex].NumChildren = NumChildren;
+
+	int32 Child = FirstChild;
+	int32 ChildBegin = Begin;
+	const float ChildHalf = HalfSize * 0.5f;
+	for (int32 o = 0; o < 8; ++o)
+	{
+		if (Counts[o] == 0)
+		{
+			continue;
+		}
+
+		Nodes[Child].Begin = ChildBegin;
+		Nodes[Child].End = ChildBegin + Counts[o];
+		ChildBegin += Counts[o];
+
+		const FVector ChildCenter = CellCenter + FVector(
+			(o & 1) ? ChildHalf : -ChildHalf,
+			(o & 2) ? ChildHalf : -ChildHalf,
+			(o & 4) ? ChildHalf : -ChildHalf);
+		BuildNode(Child++, ChildCenter, ChildHalf, Depth + 1);
+	}
+
+	for (Child = FirstChild; Child < FirstChild + NumChildren; ++Child)
+	{
+		for (int32 Owner = 0; Owner < EMFForce::NumOwnerTypes; ++Owner)
+		{
+			for (int32 Sign = 0; Sign < 2; ++Sign)
+			{
+				Nodes[NodeIndex].Aggregates[Owner][Sign].Add(Nodes[Child].Aggregates[Owner][Sign]);
+			}
+		}
+	}
+}
+
+void FEMFChargeOctree::FAggregate::Add(const FAggregate& Other)
+{
+	if (Other.Template == INDEX_NONE)
+	{
+		return;
+	}
+
+	WeightedPosition += Other.WeightedPosition;
+	Charge += Other.Charge;
+	if (Template == INDEX_NONE)
+	{
+		Template = Other.Template;
+	}
+}
+
+FEMSourceDescription FEMFChargeOctree::MakeAggregate(const FEMSourceDescription& Template, const FVector& Position, float Charge)
+{
+	FEMSourceDescription Aggregate = Template;
+	Aggregate.Position = Position;
+	Aggregate.PointChargeParams.Charge = Charge;
+	return Aggregate;
+}
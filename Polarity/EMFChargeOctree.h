@@ -0,0 +1,173 @@
+// EMFChargeOctree.h
+// Barnes-Hut octree over moving point charges, so distant clusters act as one charge
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EMF_PluginBPLibrary.h"
+#include "EMFForceKernel.h"
+
+/**
+ * A swarm of kamikaze drones, flying drones and charged projectiles is N charges acting on N
+ * receivers: N^2 plugin terms a frame. Seen from far enough away a cluster of them is
+ * indistinguishable from a single charge at its centre, which is what this tree provides.
+ *
+ * Built once per frame by UEMFSourceIndexSubsystem over the moving point charges in its snapshot.
+ * Every node keeps the summed charge and charge-weighted centre of its contents, separately per
+ * source owner type (so owner multipliers still apply) and per sign (so a mixed cluster does not
+ * collapse to a meaningless dipole centre). A query opens a node unless it is small compared with
+ * its distance (size / distance < Theta), entirely inside the query radius and free of the
+ * receiver's own entry; an unopened node is handed back as one aggregate charge per bucket.
+ *
+ * Aggregates are monopoles and carry no velocity: the electric field of the cluster is preserved
+ * to first order, any magnetic contribution of the members is not. Theta 0 opens every node and
+ * gives back exactly the sources the plain sphere query would.
+ *
+ * EMF.BarnesHut.Benchmark compares the two paths on a synthetic swarm.
+ */
+class POLARITY_API FEMFChargeOctree
+{
+public:
+	/** Moving point charges: the only sources whose far field is a plain charge */
+	static bool IsAggregatable(const FEMSourceDescription& Source);
+
+	/** Build over the aggregatable entries of Sources. Indices handed back by Traverse refer to Sources. */
+	void Build(TConstArrayView<FEMSourceDescription> Sources);
+
+	void Reset();
+
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+	int32 NumNodes() const { return Nodes.Num(); }
+
+	/** True if the source at this index went into the tree (and so comes back through Traverse, not the plain query) */
+	bool Contains(int32 SourceIndex) const { return SourceSlots.IsValidIndex(SourceIndex) && SourceSlots[SourceIndex] != INDEX_NONE; }
+
+	/**
+	 * Everything within Radius of Center except ExcludeSource: OnExact(SourceIndex) for sources in
+	 * opened leaves, OnAggregate(TemplateIndex, Position, Charge) for each bucket of an unopened node.
+	 * The aggregate is a copy of the template source moved to Position with the summed Charge.
+	 */
+	template <typename ExactFn, typename AggregateFn>
+	void Traverse(const FVector& Center, float Radius, float Theta, int32 ExcludeSource,
+		ExactFn&& OnExact, AggregateFn&& OnAggregate) const;
+
+	/** Description of an aggregate as the kernel expects it */
+	static FEMSourceDescription MakeAggregate(const FEMSourceDescription& Template, const FVector& Position, float Charge);
+
+private:
+	/** Summed charge of one (owner type, sign) bucket */
+	struct FAggregate
+	{
+		/** Sum of |q| * position; divided by |Charge| for the centre */
+		FVector WeightedPosition = FVector::ZeroVector;
+		float Charge = 0.0f;
+		/** A member, whose description the aggregate is stamped from; INDEX_NONE if the bucket is empty */
+		int32 Template = INDEX_NONE;
+
+		void Add(const FAggregate& Other);
+	};
+
+	struct FNode
+	{
+		/** Tight bounds of the contents */
+		FBox Bounds = FBox(ForceInit);
+
+		/** Contents: Entries[Begin .. End) */
+		int32 Begin = 0;
+		int32 End = 0;
+
+		/** Children are contiguous in Nodes; none for a leaf */
+		int32 FirstChild = INDEX_NONE;
+		int32 NumChildren = 0;
+
+		FAggregate Aggregates[EMFForce::NumOwnerTypes][2];
+	};
+
+	static constexpr int32 MaxLeafEntries = 4;
+	static constexpr int32 MaxDepth = 16;
+
+	void BuildNode(int32 NodeIndex, const FVector& CellCenter, float HalfSize, int32 Depth);
+
+	TConstArrayView<FEMSourceDescription> BuiltSources;
+	TArray<FNode> Nodes;
+
+	/** Source indices, ordered so every node's contents are contiguous */
+	TArray<int32> Entries;
+
+	/** Source index -> position in Entries, INDEX_NONE if not in the tree */
+	TArray<int32> SourceSlots;
+
+	/** Build scratch */
+	TArray<int32> Scratch;
+};
+
+template <typename ExactFn, typename AggregateFn>
+void FEMFChargeOctree::Traverse(const FVector& Center, float Radius, float Theta, int32 ExcludeSource,
+	ExactFn&& OnExact, AggregateFn&& OnAggregate) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 ExcludeSlot = SourceSlots.IsValidIndex(ExcludeSource) ? SourceSlots[ExcludeSource] : INDEX_NONE;
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	const double ThetaSq = FMath::Square(static_cast<double>(Theta));
+
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+
+		// Wholly out of range
+		if (Node.Bounds.ComputeSquaredDistanceToPoint(Center) > RadiusSq)
+		{
+			continue;
+		}
+
+		const bool bHoldsSelf = ExcludeSlot >= Node.Begin && ExcludeSlot < Node.End;
+		if (!bHoldsSelf && Node.End - Node.Begin > 1 && ThetaSq > 0.0)
+		{
+			const FVector Extent = Node.Bounds.GetExtent();
+			const FVector Far = (Center - Node.Bounds.GetCenter()).GetAbs() + Extent;
+			const double SizeSq = FMath::Square(2.0 * Extent.GetMax());
+			const double DistSq = FVector::DistSquared(Center, Node.Bounds.GetCenter());
+
+			// Far enough to stand in for its contents, and none of them would have been culled by distance
+			if (!Node.Bounds.IsInsideOrOn(Center) && SizeSq < ThetaSq * DistSq && Far.SizeSquared() <= RadiusSq)
+			{
+				for (int32 Owner = 0; Owner < EMFForce::NumOwnerTypes; ++Owner)
+				{
+					for (int32 Sign = 0; Sign < 2; ++Sign)
+					{
+						const FAggregate& Aggregate = Node.Aggregates[Owner][Sign];
+						if (Aggregate.Template != INDEX_NONE)
+						{
+							OnAggregate(Aggregate.Template, Aggregate.WeightedPosition / FMath::Abs(Aggregate.Charge), Aggregate.Charge);
+						}
+					}
+				}
+				continue;
+			}
+		}
+
+		if (Node.NumChildren == 0)
+		{
+			for (int32 Slot = Node.Begin; Slot < Node.End; ++Slot)
+			{
+				const int32 SourceIndex = Entries[Slot];
+				if (Slot != ExcludeSlot && FVector::DistSquared(Center, BuiltSources[SourceIndex].Position) <= RadiusSq)
+				{
+					OnExact(SourceIndex);
+				}
+			}
+			continue;
+		}
+
+		for (int32 Child = 0; Child < Node.NumChildren; ++Child)
+		{
+			Stack.Add(Node.FirstChild + Child);
+		}
+	}
+}
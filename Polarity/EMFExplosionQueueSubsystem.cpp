@@ -0,0 +1,237 @@
+// EMFExplosionQueueSubsystem.cpp
+
+#include "EMFExplosionQueueSubsystem.h"
+#include "EMFPhysicsProp.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "ShooterCharacter.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/UpperBound.h"
+
+static TAutoConsoleVariable<int32> CVarEMFExplosionQueueEnable(
+	TEXT("EMF.ExplosionQueue.Enable"),
+	1,
+	TEXT("1=prop detonations are queued and resolved in waves under a frame budget, 0=each resolves inside the call that set it off"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFExplosionQueueBudgetMs(
+	TEXT("EMF.ExplosionQueue.BudgetMs"),
+	2.0f,
+	TEXT("Game-thread milliseconds per frame spent resolving queued detonations (at least one always resolves)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFExplosionQueueMaxDeferFrames(
+	TEXT("EMF.ExplosionQueue.MaxDeferFrames"),
+	6,
+	TEXT("A detonation queued this many frames ago resolves regardless of budget"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFExplosionQueueChainWindow(
+	TEXT("EMF.ExplosionQueue.ChainWindow"),
+	1.5f,
+	TEXT("Seconds after a blast reaches a prop during which that prop detonating counts as the blast's chain reaction"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFExplosionQueueReportCmd(
+	TEXT("EMF.ExplosionQueue.Report"),
+	TEXT("Print detonations resolved, deferred and forced, deepest queue and longest chain since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UEMFExplosionQueueSubsystem* Queue = World ? World->GetSubsystem<UEMFExplosionQueueSubsystem>() : nullptr)
+		{
+			Queue->ReportStats();
+		}
+	}));
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFExplosionQueueSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFExplosionQueueSubsystem::Deinitialize()
+{
+	Pending.Empty();
+	ChainLinks.Empty();
+	Resolving = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UEMFExplosionQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEMFExplosionQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UEMFExplosionQueueSubsystem::Tick(float DeltaTime)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (auto It = ChainLinks.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || It.Value().ExpireTime < Now)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_EMF_ExplosionQueueTick);
+
+	const double BudgetSeconds = FMath::Max(CVarEMFExplosionQueueBudgetMs.GetValueOnGameThread(), 0.0f) / 1000.0;
+	const uint64 MaxDeferFrames = static_cast<uint64>(FMath::Max(CVarEMFExplosionQueueMaxDeferFrames.GetValueOnGameThread(), 0));
+	const double Start = FPlatformTime::Seconds();
+
+	int32 NumResolved = 0;
+	while (Pending.Num() > 0)
+	{
+		int32 Next = 0;
+		const bool bBudgetLeft = NumResolved == 0 || FPlatformTime::Seconds() - Start < BudgetSeconds;
+		if (!bBudgetLeft)
+		{
+			// Out of budget: only overdue detonations still go, and the front of the wave order is not
+			// necessarily the one that has waited longest (a late wave 0 sorts ahead of old children)
+			for (int32 i = 1; i < Pending.Num(); ++i)
+			{
+				if (Pending[i].EnqueueFrame < Pending[Next].EnqueueFrame)
+				{
+					Next = i;
+				}
+			}
+			if (Pending[Next].EnqueueFrame + MaxDeferFrames > GFrameCounter)
+			{
+				break;
+			}
+			++TotalForced;
+		}
+
+		// Resolving can queue more (children sort in after it), so take it out first
+		const FEMFQueuedExplosion Explosion = Pending[Next];
+		Pending.RemoveAt(Next, EAllowShrinking::No);
+
+		Resolve(Explosion);
+		++NumResolved;
+	}
+
+	const double FrameMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+	MaxFrameMs = FMath::Max(MaxFrameMs, FrameMs);
+
+	// Whatever is left waits for the next frame
+	TotalDeferred += Pending.Num();
+	INC_DWORD_STAT_BY(STAT_EMF_ExplosionsDeferred, Pending.Num());
+	SET_DWORD_STAT(STAT_EMF_ExplosionQueueDepth, Pending.Num());
+	CSV_CUSTOM_STAT(EMF, ExplosionQueueDepth, Pending.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(EMF, ExplosionsDeferred, Pending.Num(), ECsvCustomStatOp::Set);
+
+	if (Pending.Num() > 0)
+	{
+		EMF_LOG(Verbose, TEXT("[EMF_BLAST] resolved %d in %.2f ms, %d carried over (front wave %d, %llu frames old)"),
+			NumResolved, FrameMs, Pending.Num(), Pending[0].Wave, GFrameCounter - Pending[0].EnqueueFrame);
+	}
+}
+
+// ==================== API ====================
+
+void UEMFExplosionQueueSubsystem::LinkToCause(FEMFQueuedExplosion& Explosion) const
+{
+	// Set off from inside another blast's resolution: damage killed a chain-enabled prop
+	if (Resolving && Resolving->Prop != Explosion.Prop)
+	{
+		Explosion.Wave = Resolving->Wave + 1;
+		Explosion.CauseProp = Resolving->Prop;
+		Explosion.RootInstigator = Resolving->RootInstigator;
+		return;
+	}
+
+	// Set off shortly after a blast reached it: thrown into something, or charged past its threshold
+	if (const FChainLink* Link = ChainLinks.Find(Explosion.Prop))
+	{
+		Explosion.Wave = Link->Wave + 1;
+		Explosion.CauseProp = Link->CauseProp;
+		Explosion.RootInstigator = Link->RootInstigator;
+		return;
+	}
+
+	Explosion.Wave = 0;
+	Explosion.CauseProp = nullptr;
+	if (const AEMFPhysicsProp* Prop = Explosion.Prop.Get())
+	{
+		Explosion.RootInstigator = Prop->GetSpendingCharacter();
+	}
+}
+
+bool UEMFExplosionQueueSubsystem::Enqueue(const FEMFQueuedExplosion& InExplosion)
+{
+	if (!CVarEMFExplosionQueueEnable.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	FEMFQueuedExplosion Explosion = InExplosion;
+	Explosion.Sequence = NextSequence++;
+	Explosion.EnqueueFrame = GFrameCounter;
+
+	const int32 InsertAt = Algo::UpperBound(Pending, Explosion,
+		[](const FEMFQueuedExplosion& A, const FEMFQueuedExplosion& B)
+		{
+			return A.Wave != B.Wave ? A.Wave < B.Wave : A.Sequence < B.Sequence;
+		});
+	Pending.Insert(MoveTemp(Explosion), InsertAt);
+
+	MaxDepth = FMath::Max(MaxDepth, Pending.Num());
+	SET_DWORD_STAT(STAT_EMF_ExplosionQueueDepth, Pending.Num());
+	return true;
+}
+
+void UEMFExplosionQueueSubsystem::Resolve(const FEMFQueuedExplosion& Explosion)
+{
+	AEMFPhysicsProp* Prop = Explosion.Prop.Get();
+	if (!Prop)
+	{
+		return;
+	}
+
+	const FEMFQueuedExplosion* Outer = Resolving;
+	Resolving = &Explosion;
+	Prop->ResolveExplosion(Explosion);
+	Resolving = Outer;
+
+	ChainLinks.Remove(Explosion.Prop);
+
+	++TotalResolved;
+	MaxWave = FMath::Max(MaxWave, Explosion.Wave);
+	INC_DWORD_STAT(STAT_EMF_ExplosionsResolved);
+}
+
+void UEMFExplosionQueueSubsystem::NoteBlastReached(AEMFPhysicsProp* Prop, const FEMFQueuedExplosion& Blast)
+{
+	if (!Prop || Prop == Blast.Prop.Get())
+	{
+		return;
+	}
+
+	// First blast to reach it keeps it; a later one would only lengthen the chain it belongs to
+	FChainLink& Link = ChainLinks.FindOrAdd(Prop);
+	if (!Link.CauseProp.IsValid())
+	{
+		Link.CauseProp = Blast.Prop;
+		Link.RootInstigator = Blast.RootInstigator;
+		Link.Wave = Blast.Wave;
+	}
+	Link.ExpireTime = GetWorld()->GetTimeSeconds() + CVarEMFExplosionQueueChainWindow.GetValueOnGameThread();
+}
+
+void UEMFExplosionQueueSubsystem::ReportStats() const
+{
+	UE_LOG(LogEMF, Log, TEXT("[EMF_BLAST] resolved=%llu deferred=%llu (detonation-frames) forced=%llu max depth=%d longest chain=%d waves worst frame=%.2f ms pending=%d"),
+		TotalResolved, TotalDeferred, TotalForced, MaxDepth, MaxWave + 1, MaxFrameMs, Pending.Num());
+}
@@ -0,0 +1,131 @@
+// EMFExplosionQueueSubsystem.h
+// Prop detonations resolved in causal waves under a per-frame time budget
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EMFExplosionQueueSubsystem.generated.h"
+
+class AEMFPhysicsProp;
+class AShooterCharacter;
+
+/** One detonation waiting for (or going through) resolution */
+struct FEMFQueuedExplosion
+{
+	TWeakObjectPtr<AEMFPhysicsProp> Prop;
+
+	/** The prop's detonation serial when it detonated. A reset or checkpoint restore bumps the prop's,
+	 *  and an entry that no longer matches belongs to a life the prop has left behind. */
+	uint32 DetonationSerial = 0;
+
+	float DamageMultiplier = 1.0f;
+	float RadiusMultiplier = 1.0f;
+	float VFXScaleMultiplier = 1.0f;
+
+	/** Where the prop was and what it carried when it detonated; the blast uses these even if it rolls on or is recharged meanwhile */
+	FVector Location = FVector::ZeroVector;
+	float Charge = 0.0f;
+
+	/** 0 for a detonation nothing else caused, parent's wave + 1 for a chained one */
+	int32 Wave = 0;
+
+	/** Arrival order, ties broken within a wave */
+	uint64 Sequence = 0;
+	uint64 EnqueueFrame = 0;
+
+	/** The prop whose blast set this one off; killer of this one. Null for wave 0. */
+	TWeakObjectPtr<AEMFPhysicsProp> CauseProp;
+
+	/** Whoever spent the prop at the root of the chain; credited when this prop has no spender of its own */
+	TWeakObjectPtr<AShooterCharacter> RootInstigator;
+};
+
+/**
+ * A prop explosion used to do all of its work inside the call that detonated it. A chain-enabled
+ * prop killed by that blast exploded from inside its TakeDamage, a prop the blast threw into a wall
+ * exploded on the next physics hit, and in a destruction-heavy arena a single shot could put thirty
+ * to sixty milliseconds of blasts into one frame.
+ *
+ * AEMFPhysicsProp::Explode now runs its gates, marks the prop exploded and hands the detonation to
+ * this queue. The queue resolves detonations in wave order (everything a blast set off after the
+ * blast itself, oldest first within a wave) until the frame's budget is spent and carries the rest
+ * over. One detonation is always resolved per frame, and once the budget is spent anything queued
+ * for MaxDeferFrames is still resolved, oldest first, so a long chain slows down rather than stalls.
+ * A detonation whose prop died some other way, was reset or was restored from a checkpoint while it
+ * waited is dropped when its turn comes.
+ *
+ * Causality is tracked two ways. A detonation queued while another is resolving (damage killed a
+ * chain-enabled prop) is that one's child. A prop a blast reached (pushed or charged) and that
+ * detonates within ChainWindow seconds is also its child, which catches the physics-driven chains.
+ * A child carries its parent as killer and its chain root's spender as the character credited with
+ * the damage, so deferring a blast never changes who it is credited to.
+ *
+ * EMF.ExplosionQueue.Enable 0 resolves every detonation immediately, as before.
+ */
+UCLASS()
+class POLARITY_API UEMFExplosionQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Pending.Num() > 0 || ChainLinks.Num() > 0; }
+
+	// ==================== API ====================
+
+	/**
+	 * Fill in the chain fields of Explosion (wave, cause, root instigator) from whatever set it off.
+	 * Called for every detonation, queued or not, so attribution is the same either way.
+	 */
+	void LinkToCause(FEMFQueuedExplosion& Explosion) const;
+
+	/** Queue a linked detonation. False if queueing is disabled; the caller resolves it on the spot. */
+	bool Enqueue(const FEMFQueuedExplosion& Explosion);
+
+	/** Resolve one detonation now, with it as the cause of anything queued meanwhile */
+	void Resolve(const FEMFQueuedExplosion& Explosion);
+
+	/** A blast reached this prop: if it detonates within ChainWindow, it is the blast's child */
+	void NoteBlastReached(AEMFPhysicsProp* Prop, const FEMFQueuedExplosion& Blast);
+
+	int32 GetQueueDepth() const { return Pending.Num(); }
+
+	/** Lifetime counters to the log (EMF.ExplosionQueue.Report) */
+	void ReportStats() const;
+
+private:
+	/** Parent of a prop a blast reached, until ChainWindow runs out */
+	struct FChainLink
+	{
+		TWeakObjectPtr<AEMFPhysicsProp> CauseProp;
+		TWeakObjectPtr<AShooterCharacter> RootInstigator;
+		int32 Wave = 0;
+		double ExpireTime = 0.0;
+	};
+
+	/** Sorted by (Wave, Sequence) */
+	TArray<FEMFQueuedExplosion> Pending;
+
+	TMap<TWeakObjectPtr<AEMFPhysicsProp>, FChainLink> ChainLinks;
+
+	/** The detonation being resolved right now, null outside Resolve */
+	const FEMFQueuedExplosion* Resolving = nullptr;
+
+	uint64 NextSequence = 0;
+
+	// Lifetime counters for ReportStats
+	uint64 TotalResolved = 0;
+	uint64 TotalDeferred = 0;
+	uint64 TotalForced = 0;
+	int32 MaxDepth = 0;
+	int32 MaxWave = 0;
+	double MaxFrameMs = 0.0;
+};
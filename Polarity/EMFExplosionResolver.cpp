@@ -0,0 +1,112 @@
+// EMFExplosionResolver.cpp
+
+#include "EMFExplosionResolver.h"
+#include "EMFPhysicsProp.h"
+#include "EMFVelocityModifier.h"
+#include "EMFStats.h"
+#include "Variant_Shooter/AI/ShooterNPC.h"
+#include "GameFramework/Character.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+
+void FEMFExplosionResolver::Gather(UWorld* InWorld, const FVector& InOrigin, float Radius, AActor* Ignored)
+{
+	EMF_SCOPE_CYCLE_COUNTER(ExplosionResolve);
+
+	World = InWorld;
+	Origin = InOrigin;
+	IgnoredActor = Ignored;
+	NumLOSTraces = 0;
+	Targets.Reset();
+
+	if (!World || Radius <= 0.0f)
+	{
+		return;
+	}
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(Ignored);
+
+	// Every object type, then the channel responses per component below: a Pawn or WorldDynamic
+	// channel overlap returns precisely the components that do not ignore that channel.
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(
+		Overlaps, Origin, FQuat::Identity,
+		FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllObjects),
+		FCollisionShape::MakeSphere(Radius), QueryParams);
+
+	// Actor -> index in Targets; overlaps of one actor's components arrive in any order
+	TMap<AActor*, int32, TInlineSetAllocator<32>> TargetIndices;
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		UPrimitiveComponent* Component = Overlap.GetComponent();
+		if (!Actor || !Component)
+		{
+			continue;
+		}
+
+		const bool bPawnChannel = Component->GetCollisionResponseToChannel(ECC_Pawn) != ECR_Ignore;
+		const bool bDynamicChannel = Component->GetCollisionResponseToChannel(ECC_WorldDynamic) != ECR_Ignore;
+		if (!bPawnChannel && !bDynamicChannel)
+		{
+			continue;
+		}
+
+		int32* ExistingIndex = TargetIndices.Find(Actor);
+		if (!ExistingIndex)
+		{
+			FEMFExplosionTarget& NewTarget = Targets.AddDefaulted_GetRef();
+			NewTarget.Actor = Actor;
+			NewTarget.Character = Cast<ACharacter>(Actor);
+			NewTarget.NPC = Cast<AShooterNPC>(Actor);
+			NewTarget.Prop = Cast<AEMFPhysicsProp>(Actor);
+			NewTarget.NPCModifier = NewTarget.NPC ? NewTarget.NPC->FindComponentByClass<UEMFVelocityModifier>() : nullptr;
+			NewTarget.Location = Actor->GetActorLocation();
+			NewTarget.Distance = FVector::Dist(Origin, NewTarget.Location);
+			ExistingIndex = &TargetIndices.Add(Actor, Targets.Num() - 1);
+		}
+
+		FEMFExplosionTarget& Target = Targets[*ExistingIndex];
+		if (bPawnChannel && !Target.PawnComponent)
+		{
+			Target.PawnComponent = Component;
+		}
+		if (bDynamicChannel && !Target.DynamicComponent)
+		{
+			Target.DynamicComponent = Component;
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_EMF_ExplosionTargets, Targets.Num());
+}
+
+bool FEMFExplosionResolver::HasLineOfSight(FEMFExplosionTarget& Target)
+{
+	if (Target.LOSState >= 0)
+	{
+		return Target.LOSState == 1;
+	}
+
+	if (!World || !IsValid(Target.Actor))
+	{
+		return false;
+	}
+
+	FCollisionQueryParams LOSParams;
+	LOSParams.AddIgnoredActor(IgnoredActor);
+	LOSParams.bTraceComplex = false;
+
+	FHitResult LOSHit;
+	const bool bBlocked = World->LineTraceSingleByChannel(
+		LOSHit, Origin, Target.Location, ECC_Visibility, LOSParams);
+
+	++NumLOSTraces;
+	INC_DWORD_STAT(STAT_EMF_ExplosionLOSTraces);
+
+	// Not blocked, or the trace hit the target itself = has LOS
+	Target.LOSState = (!bBlocked || LOSHit.GetActor() == Target.Actor) ? 1 : 0;
+	return Target.LOSState == 1;
+}
@@ -0,0 +1,85 @@
+// EMFExplosionResolver.h
+// One overlap and one LOS trace per target for everything a prop explosion does
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class ACharacter;
+class AShooterNPC;
+class AEMFPhysicsProp;
+class UPrimitiveComponent;
+class UEMFVelocityModifier;
+
+/** One actor inside the blast sphere, classified once */
+struct FEMFExplosionTarget
+{
+	AActor* Actor = nullptr;
+
+	/** First overlapping component that answers the Pawn channel (damage, stun, charge to NPCs) */
+	UPrimitiveComponent* PawnComponent = nullptr;
+
+	/** First overlapping component that answers the WorldDynamic channel (physics push, charge to props) */
+	UPrimitiveComponent* DynamicComponent = nullptr;
+
+	/** Casts of Actor, done once here instead of in every stage */
+	ACharacter* Character = nullptr;
+	AShooterNPC* NPC = nullptr;
+	AEMFPhysicsProp* Prop = nullptr;
+	UEMFVelocityModifier* NPCModifier = nullptr;
+
+	/** Actor location at gather time, and its distance from the origin */
+	FVector Location = FVector::ZeroVector;
+	float Distance = 0.0f;
+
+	bool IsOnPawnChannel() const { return PawnComponent != nullptr; }
+	bool IsOnDynamicChannel() const { return DynamicComponent != nullptr; }
+
+	/** The component the old Pawn-then-WorldDynamic impulse query would have met first */
+	UPrimitiveComponent* GetImpulseComponent() const { return PawnComponent ? PawnComponent : DynamicComponent; }
+
+private:
+	friend class FEMFExplosionResolver;
+
+	/** -1 not traced yet, 0 blocked, 1 visible */
+	int8 LOSState = -1;
+};
+
+/**
+ * AEMFPhysicsProp::Explode used to run the same sphere up to six times: Pawn for damage, Pawn and
+ * WorldDynamic for the push, Pawn for stun, WorldDynamic and Pawn for charge transfer, with a fresh
+ * LOS trace per target per stage on top. A chain reaction in a prop-heavy room multiplied all of it.
+ *
+ * The resolver runs one overlap over every object type, and keeps per component whether it answers
+ * the Pawn and WorldDynamic channels, which is exactly what the separate channel queries used to
+ * select. Each actor becomes one target with its casts done, and its LOS is traced the first time a
+ * stage asks and remembered for the rest of the explosion.
+ *
+ * Lives on the stack for the length of one Explode. Targets hold raw pointers: an earlier stage can
+ * kill or destroy an actor, so stages check IsValid before touching one.
+ */
+class POLARITY_API FEMFExplosionResolver
+{
+public:
+	/** Overlap a sphere of Radius at Origin, leaving Ignored (the exploding prop) out of it and of the LOS traces */
+	void Gather(UWorld* InWorld, const FVector& InOrigin, float Radius, AActor* Ignored);
+
+	TArrayView<FEMFExplosionTarget> GetTargets() { return Targets; }
+
+	/** Unblocked line from the origin to the target on Visibility, against static geometry or the target itself */
+	bool HasLineOfSight(FEMFExplosionTarget& Target);
+
+	const FVector& GetOrigin() const { return Origin; }
+
+	/** LOS traces actually issued, for logging */
+	int32 GetNumLOSTraces() const { return NumLOSTraces; }
+
+private:
+	UWorld* World = nullptr;
+	FVector Origin = FVector::ZeroVector;
+	AActor* IgnoredActor = nullptr;
+	int32 NumLOSTraces = 0;
+
+	TArray<FEMFExplosionTarget> Targets;
+};
@@ -0,0 +1,495 @@
+// EMFForceKernel.cpp
+
+#include "EMFForceKernel.h"
+#include "EMFSourceIndexSubsystem.h"
+#include "EMFLOSCacheSubsystem.h"
+#include "EMFStaticFieldSubsystem.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "EMF_FieldComponent.h"
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFForceKernelBatched(
+	TEXT("EMF.ForceKernel.Batched"),
+	1,
+	TEXT("1=superpose sources per owner type in one plugin call, 0=one plugin call per source (reference)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFForceKernelCheckLinearity(
+	TEXT("EMF.ForceKernel.CheckLinearity"),
+	0,
+	TEXT("1=also evaluate every batched bin one source at a time and log to LogEMF where the sum differs from the batched call (development builds)"),
+	ECVF_Default);
+
+namespace EMFForce
+{
+	/** Bin index used for channeling plates, after the owner-type bins */
+	static constexpr int32 PlateBin = NumOwnerTypes;
+}
+
+// ==================== Result / Batch ====================
+
+void FEMFForceResult::Reset()
+{
+	Force = FVector::ZeroVector;
+	PlateForce = FVector::ZeroVector;
+	for (FVector& OwnerForce : OwnerForces)
+	{
+		OwnerForce = FVector::ZeroVector;
+	}
+	bInsideCutoff = false;
+	bPlateContributed = false;
+	NumContributing = 0;
+}
+
+void FEMFForceBatch::Reset()
+{
+	Positions.Reset();
+	Velocities.Reset();
+	Charges.Reset();
+	FilterIndices.Reset();
+	SourceOffsets.Reset();
+	Filters.Reset();
+	Sources.Reset();
+	Results.Reset();
+}
+
+int32 FEMFForceBatch::AddReceiver(const FVector& Position, const FVector& Velocity, float Charge, int32 FilterIndex)
+{
+	SourceOffsets.Add(Sources.Num());
+	FilterIndices.Add(FilterIndex);
+	Charges.Add(Charge);
+	Velocities.Add(Velocity);
+	return Positions.Add(Position);
+}
+
+void FEMFForceBatch::Finalize()
+{
+	SourceOffsets.Add(Sources.Num());
+	Results.SetNum(Positions.Num(), EAllowShrinking::No);
+}
+
+// ==================== Kernel ====================
+
+FEMFForceKernel& FEMFForceKernel::GetGameThreadKernel()
+{
+	check(IsInGameThread());
+	static FEMFForceKernel Kernel;
+	return Kernel;
+}
+
+TConstArrayView<const FEMSourceDescription*> FEMFForceKernel::GatherSources(UEMF_FieldComponent* Self, const FVector& Center, float Radius,
+	bool bAllowApproximation)
+{
+	UEMFSourceIndexSubsystem::GatherSources(Self, Center, Radius, GatherStorage, Gathered,
+		bAllowApproximation ? &GatheredBakedField : nullptr);
+	if (!bAllowApproximation)
+	{
+		GatheredBakedField = nullptr;
+	}
+	return Gathered;
+}
+
+bool FEMFForceKernel::IsGatherTransient() const
+{
+	if (Gathered.Num() == 0 || GatherStorage.Num() == 0)
+	{
+		return false;
+	}
+
+	// Brute force puts everything in storage; Barnes-Hut appends its aggregates there after the indexed entries
+	const FEMSourceDescription* Begin = GatherStorage.GetData();
+	const FEMSourceDescription* End = Begin + GatherStorage.Num();
+	return (Gathered[0] >= Begin && Gathered[0] < End) || (Gathered.Last() >= Begin && Gathered.Last() < End);
+}
+
+void FEMFForceKernel::EvaluateQuery(const FEMFForceQuery& Query, FEMFForceResult& OutResult)
+{
+	// Neither a grid nor an aggregate has a position to trace to for the sources it holds, so
+	// shielded receivers always see the sources themselves
+	if (!Query.bLOSShielding)
+	{
+		const TConstArrayView<const FEMSourceDescription*> Sources = GatherSources(Query.Self, Query.Position, Query.Filter.MaxSourceDistance, true);
+
+		FEMFForceFilter Filter = Query.Filter;
+		Filter.BakedField = GatheredBakedField;
+		Evaluate(Query.Position, Query.Velocity, Query.Charge, Filter, Sources, OutResult);
+		return;
+	}
+
+	const TConstArrayView<const FEMSourceDescription*> Sources = GatherSources(Query.Self, Query.Position, Query.Filter.MaxSourceDistance);
+
+	Evaluate(Query.Position, Query.Velocity, Query.Charge, Query.Filter, Sources, OutResult,
+		[&Query](const FEMSourceDescription& Source) { return IsSourceShielded(Query, Source); });
+}
+
+bool FEMFForceKernel::IsSourceShielded(const FEMFForceQuery& Query, const FEMSourceDescription& Source)
+{
+	UWorld* World = Query.Self ? Query.Self->GetWorld() : nullptr;
+
+	// Cached per (receiver, source) and refreshed asynchronously; see UEMFLOSCacheSubsystem
+	const bool bBlocked = UEMFLOSCacheSubsystem::IsSourceBlocked(
+		World, Query.Receiver, Source, Query.Position, Query.LOSChannel, Query.IgnoreActor);
+
+	if (EMF_SHOULD_DRAW(Query.bDrawLOSDebug) && World)
+	{
+		DrawDebugLine(World, Query.Position, Source.Position,
+			bBlocked ? FColor::Red : FColor::Green, false, -1.0f, 0, 0.5f);
+	}
+
+	return bBlocked;
+}
+
+void FEMFForceKernel::Evaluate(const FVector& Position, const FVector& Velocity, float Charge, const FEMFForceFilter& Filter,
+	TConstArrayView<const FEMSourceDescription*> Sources, FEMFForceResult& OutResult)
+{
+	EvaluateImpl(Position, Velocity, Charge, Filter, Sources, OutResult, [](const FEMSourceDescription&) { return false; });
+}
+
+void FEMFForceKernel::Evaluate(const FVector& Position, const FVector& Velocity, float Charge, const FEMFForceFilter& Filter,
+	TConstArrayView<const FEMSourceDescription*> Sources, FEMFForceResult& OutResult, FShieldTest IsShielded)
+{
+	EvaluateImpl(Position, Velocity, Charge, Filter, Sources, OutResult, IsShielded);
+}
+
+void FEMFForceKernel::Solve(FEMFForceBatch& Batch)
+{
+	Solve(Batch, [](int32, const FEMSourceDescription&) { return false; });
+}
+
+void FEMFForceKernel::Solve(FEMFForceBatch& Batch, FBatchShieldTest IsShielded)
+{
+	checkf(Batch.SourceOffsets.Num() == Batch.Num() + 1, TEXT("FEMFForceBatch::Finalize was not called"));
+
+	for (int32 i = 0; i < Batch.Num(); ++i)
+	{
+		const int32 Start = Batch.SourceOffsets[i];
+		const TConstArrayView<const FEMSourceDescription*> ReceiverSources(Batch.Sources.GetData() + Start, Batch.SourceOffsets[i + 1] - Start);
+
+		EvaluateImpl(Batch.Positions[i], Batch.Velocities[i], Batch.Charges[i], Batch.Filters[Batch.FilterIndices[i]],
+			ReceiverSources, Batch.Results[i],
+			[&IsShielded, i](const FEMSourceDescription& Source) { return IsShielded(i, Source); });
+	}
+}
+
+void FEMFForceKernel::SolveOne(const FEMFForceBatch& Batch, int32 Index, FEMFForceResult& OutResult)
+{
+	const int32 Start = Batch.SourceOffsets[Index];
+	const TConstArrayView<const FEMSourceDescription*> ReceiverSources(Batch.Sources.GetData() + Start, Batch.SourceOffsets[Index + 1] - Start);
+
+	EvaluateImpl(Batch.Positions[Index], Batch.Velocities[Index], Batch.Charges[Index], Batch.Filters[Batch.FilterIndices[Index]],
+		ReceiverSources, OutResult, [](const FEMSourceDescription&) { return false; });
+}
+
+EEMFSourceVerdict FEMFForceKernel::ClassifySource(const FVector& Position, int32 ReceiverChargeSign,
+	const FEMFForceFilter& Filter, const FEMSourceDescription& Source)
+{
+	if (IsSourceEffectivelyZero(Source))
+	{
+		return EEMFSourceVerdict::Reject;
+	}
+
+	const float DistSq = FVector::DistSquared(Position, Source.Position);
+	if (DistSq > Filter.MaxSourceDistance * Filter.MaxSourceDistance)
+	{
+		return EEMFSourceVerdict::Reject;
+	}
+
+	// Close-range cutoff against the 1/r^2 singularity; sign-independent, see AEMFPhysicsProp::ApplyEMForces
+	if (DistSq < Filter.CutoffDistance * Filter.CutoffDistance
+		&& GetSourceEffectiveChargeSign(Source) != 0 && ReceiverChargeSign != 0)
+	{
+		return EEMFSourceVerdict::InsideCutoff;
+	}
+
+	if (Filter.PlateHandling == EEMFPlateHandling::Skip && IsChannelingPlate(Source))
+	{
+		return EEMFSourceVerdict::Reject;
+	}
+
+	if (FMath::IsNearlyZero(Filter.GetMultiplier(Source.OwnerType)))
+	{
+		return EEMFSourceVerdict::Reject;
+	}
+
+	return EEMFSourceVerdict::Accept;
+}
+
+template <typename ShieldFn>
+void FEMFForceKernel::EvaluateImpl(const FVector& Position, const FVector& Velocity, float Charge, const FEMFForceFilter& Filter,
+	TConstArrayView<const FEMSourceDescription*> Sources, FEMFForceResult& OutResult, ShieldFn&& IsShielded)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EMF_ForceKernel);
+
+	OutResult.Reset();
+
+	const bool bBatched = CVarEMFForceKernelBatched.GetValueOnAnyThread() != 0;
+	const int32 MyChargeSign = GetChargeSign(Charge);
+	int32 PluginCalls = 0;
+
+	for (TArray<FEMSourceDescription>& Bin : Bins)
+	{
+		Bin.Reset();
+	}
+
+	// ===== Filter stage =====
+	// The old loops tested zero source, distance, cutoff, LOS, then plate and multiplier. LOS moves
+	// to the end here: every test only drops the source, so the surviving set is the same, and the
+	// sources the cheap tests reject are no longer traced.
+	for (const FEMSourceDescription* SourcePtr : Sources)
+	{
+		const FEMSourceDescription& Source = *SourcePtr;
+
+		const EEMFSourceVerdict Verdict = ClassifySource(Position, MyChargeSign, Filter, Source);
+		if (Verdict == EEMFSourceVerdict::InsideCutoff)
+		{
+			OutResult.bInsideCutoff = true;
+			continue;
+		}
+		if (Verdict == EEMFSourceVerdict::Reject)
+		{
+			continue;
+		}
+
+		const bool bIsPlate = IsChannelingPlate(Source);
+		const float Multiplier = Filter.GetMultiplier(Source.OwnerType);
+
+		// Traces last: they are by far the most expensive test
+		if (IsShielded(Source))
+		{
+			continue;
+		}
+
+		++OutResult.NumContributing;
+
+		if (!bBatched || IsPassiveSource(Source))
+		{
+			Single.Reset();
+			Single.Add(Source);
+			const FVector SourceForce = CallPlugin(Charge, Position, Velocity, Single) * Multiplier;
+			++PluginCalls;
+
+			OutResult.OwnerForces[EMFForce::OwnerTypeIndex(Source.OwnerType)] += SourceForce;
+			if (bIsPlate)
+			{
+				OutResult.PlateForce += SourceForce;
+				OutResult.bPlateContributed = true;
+			}
+			if (!bIsPlate || Filter.PlateHandling != EEMFPlateHandling::Separate)
+			{
+				OutResult.Force += SourceForce;
+			}
+			continue;
+		}
+
+		Bins[bIsPlate ? EMFForce::PlateBin : EMFForce::OwnerTypeIndex(Source.OwnerType)].Add(Source);
+	}
+
+	// ===== Accumulate stage: one plugin call per non-empty bin =====
+	// Relies on CalculateLorentzForceComplete being linear in its sources (the force from several
+	// active sources is the sum of their separate forces), which holds for the superposed E and B it
+	// computes. Passive sources break that and were kept out of the bins above.
+	// EMF.ForceKernel.CheckLinearity verifies it at runtime.
+	for (int32 BinIndex = 0; BinIndex < EMFForce::NumOwnerTypes; ++BinIndex)
+	{
+		if (Bins[BinIndex].Num() == 0)
+		{
+			continue;
+		}
+
+		const FVector BinForce = CallPlugin(Charge, Position, Velocity, Bins[BinIndex]) * Filter.OwnerMultipliers[BinIndex];
+		++PluginCalls;
+		CheckLinearity(Charge, Position, Velocity, Bins[BinIndex], BinForce, Filter.OwnerMultipliers[BinIndex]);
+
+		OutResult.OwnerForces[BinIndex] += BinForce;
+		OutResult.Force += BinForce;
+	}
+
+	TArray<FEMSourceDescription>& PlateBin = Bins[EMFForce::PlateBin];
+	if (PlateBin.Num() > 0)
+	{
+		const FVector PlateForce = CallPlugin(Charge, Position, Velocity, PlateBin) * Filter.GetMultiplier(EEMSourceOwnerType::Player);
+		++PluginCalls;
+		CheckLinearity(Charge, Position, Velocity, PlateBin, PlateForce, Filter.GetMultiplier(EEMSourceOwnerType::Player));
+
+		OutResult.OwnerForces[EMFForce::OwnerTypeIndex(EEMSourceOwnerType::Player)] += PlateForce;
+		OutResult.PlateForce += PlateForce;
+		OutResult.bPlateContributed = true;
+		if (Filter.PlateHandling != EEMFPlateHandling::Separate)
+		{
+			OutResult.Force += PlateForce;
+		}
+	}
+
+	// ===== Baked static field: F = q(E + v x B), the same thing the plugin returns for those sources =====
+	const float EnvironmentMultiplier = Filter.GetMultiplier(EEMSourceOwnerType::Environment);
+	if (Filter.BakedField && !FMath::IsNearlyZero(EnvironmentMultiplier))
+	{
+		FVector E, B;
+		Filter.BakedField->Sample(Position, E, B);
+		const FVector BakedForce = Charge * (E + FVector::CrossProduct(Velocity, B)) * EnvironmentMultiplier;
+
+		OutResult.OwnerForces[EMFForce::OwnerTypeIndex(EEMSourceOwnerType::Environment)] += BakedForce;
+		OutResult.Force += BakedForce;
+		++OutResult.NumContributing;
+		INC_DWORD_STAT(STAT_EMF_StaticFieldSamples);
+	}
+
+	INC_DWORD_STAT_BY(STAT_EMF_PluginCalls, PluginCalls);
+}
+
+FVector FEMFForceKernel::CallPlugin(float Charge, const FVector& Position, const FVector& Velocity, const TArray<FEMSourceDescription>& Bin)
+{
+	return UEMF_PluginBPLibrary::CalculateLorentzForceComplete(
+		Charge,
+		Position,
+		Velocity,
+		Bin,
+		true  // Include magnetic component
+	);
+}
+
+void FEMFForceKernel::CheckLinearity(float Charge, const FVector& Position, const FVector& Velocity,
+	const TArray<FEMSourceDescription>& Bin, const FVector& BatchedForce, float Multiplier)
+{
+#if EMF_DEBUG_DIAGNOSTICS
+	if (Bin.Num() < 2 || CVarEMFForceKernelCheckLinearity.GetValueOnAnyThread() == 0)
+	{
+		return;
+	}
+
+	FVector SumForce = FVector::ZeroVector;
+	for (const FEMSourceDescription& Source : Bin)
+	{
+		Single.Reset();
+		Single.Add(Source);
+		SumForce += CallPlugin(Charge, Position, Velocity, Single) * Multiplier;
+	}
+
+	const double Tolerance = FMath::Max(1.0e-3 * SumForce.Size(), 1.0e-2);
+	if (!BatchedForce.Equals(SumForce, Tolerance))
+	{
+		EMF_LOG(Warning, TEXT("[EMF_KERNEL] Batched force (%s) differs from per-source sum (%s) over %d sources of owner type %d"),
+			*BatchedForce.ToCompactString(), *SumForce.ToCompactString(), Bin.Num(), static_cast<int32>(Bin[0].OwnerType));
+	}
+#endif
+}
+
+// ==================== Source Classification ====================
+
+bool FEMFForceKernel::IsSourceEffectivelyZero(const FEMSourceDescription& Source)
+{
+	// Check based on source type - different types store "strength" differently
+	switch (Source.SourceType)
+	{
+	case EEMSourceType::PointCharge:
+		return FMath::IsNearlyZero(Source.PointChargeParams.Charge);
+
+	case EEMSourceType::LineCharge:
+		return FMath::IsNearlyZero(Source.LineChargeParams.LinearChargeDensity);
+
+	case EEMSourceType::ChargedRing:
+		return FMath::IsNearlyZero(Source.RingParams.TotalCharge);
+
+	case EEMSourceType::ChargedSphere:
+		return FMath::IsNearlyZero(Source.SphereParams.TotalCharge);
+
+	case EEMSourceType::ChargedBall:
+		return FMath::IsNearlyZero(Source.BallParams.TotalCharge);
+
+	case EEMSourceType::InfinitePlate:
+	case EEMSourceType::FinitePlate:
+		return FMath::IsNearlyZero(Source.PlateParams.SurfaceChargeDensity);
+
+	case EEMSourceType::Dipole:
+		return Source.DipoleParams.DipoleMoment.IsNearlyZero();
+
+	case EEMSourceType::CurrentWire:
+		return FMath::IsNearlyZero(Source.WireParams.Current);
+
+	case EEMSourceType::CurrentLoop:
+		return FMath::IsNearlyZero(Source.LoopParams.Current);
+
+	case EEMSourceType::Solenoid:
+		return FMath::IsNearlyZero(Source.SolenoidParams.Current);
+
+	case EEMSourceType::MagneticDipole:
+		return Source.MagneticDipoleParams.MagneticMoment.IsNearlyZero();
+
+	case EEMSourceType::SectorMagnet:
+		return FMath::IsNearlyZero(Source.SectorMagnetParams.FieldStrength);
+
+	case EEMSourceType::PlateMagnet:
+		return FMath::IsNearlyZero(Source.PlateMagnetParams.FieldStrength);
+
+	// Passive sources (dielectrics, grounded conductors) - they modify fields, not create them
+	// But they still need external sources to work, so skip them if no permittivity effect
+	case EEMSourceType::DielectricSphere:
+		return FMath::IsNearlyEqual(Source.DielectricSphereParams.RelativePermittivity, 1.0f);
+
+	case EEMSourceType::DielectricSlab:
+		return FMath::IsNearlyEqual(Source.DielectricSlabParams.RelativePermittivity, 1.0f);
+
+	case EEMSourceType::GroundedConductor:
+	case EEMSourceType::GroundedPlate:
+		// Grounded conductors always affect fields if present
+		return false;
+
+	case EEMSourceType::Antenna:
+	case EEMSourceType::WaveGuide:
+	case EEMSourceType::Custom:
+	default:
+		// For unknown/custom types, check legacy Charge field as fallback
+		return FMath::IsNearlyZero(Source.PointChargeParams.Charge);
+	}
+}
+
+int32 FEMFForceKernel::GetSourceEffectiveChargeSign(const FEMSourceDescription& Source)
+{
+	float EffectiveCharge = 0.0f;
+
+	switch (Source.SourceType)
+	{
+	case EEMSourceType::PointCharge:
+		EffectiveCharge = Source.PointChargeParams.Charge;
+		break;
+	case EEMSourceType::LineCharge:
+		EffectiveCharge = Source.LineChargeParams.LinearChargeDensity;
+		break;
+	case EEMSourceType::ChargedRing:
+		EffectiveCharge = Source.RingParams.TotalCharge;
+		break;
+	case EEMSourceType::ChargedSphere:
+		EffectiveCharge = Source.SphereParams.TotalCharge;
+		break;
+	case EEMSourceType::ChargedBall:
+		EffectiveCharge = Source.BallParams.TotalCharge;
+		break;
+	case EEMSourceType::InfinitePlate:
+	case EEMSourceType::FinitePlate:
+		EffectiveCharge = Source.PlateParams.SurfaceChargeDensity;
+		break;
+	default:
+		// Magnetic sources, dielectrics, grounded conductors — no charge sign concept
+		return 0;
+	}
+
+	if (EffectiveCharge > KINDA_SMALL_NUMBER) return 1;
+	if (EffectiveCharge < -KINDA_SMALL_NUMBER) return -1;
+	return 0;
+}
+
+bool FEMFForceKernel::IsPassiveSource(const FEMSourceDescription& Source)
+{
+	switch (Source.SourceType)
+	{
+	case EEMSourceType::DielectricSphere:
+	case EEMSourceType::DielectricSlab:
+	case EEMSourceType::GroundedConductor:
+	case EEMSourceType::GroundedPlate:
+		return true;
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,269 @@
+// EMFForceKernel.h
+// Shared Lorentz force evaluation for every EMF receiver (velocity modifier, physics props)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "EMF_PluginBPLibrary.h"
+
+class UEMF_FieldComponent;
+struct FEMFBakedField;
+
+namespace EMFForce
+{
+	/** Entries in EEMSourceOwnerType (None, Player, NPC, Projectile, Environment, PhysicsProp). */
+	static constexpr int32 NumOwnerTypes = 6;
+
+	FORCEINLINE int32 OwnerTypeIndex(EEMSourceOwnerType OwnerType)
+	{
+		const int32 Index = static_cast<int32>(OwnerType);
+		return (Index >= 0 && Index < NumOwnerTypes) ? Index : 0;
+	}
+}
+
+/** What happens to player channeling plates (a FinitePlate owned by the Player) for this receiver. */
+enum class EEMFPlateHandling : uint8
+{
+	/** Plate force goes into the total like any other source */
+	Include,
+	/** Plate is ignored entirely (uncaptured targets that must not feel it) */
+	Skip,
+	/** Plate force is reported in PlateForce only, never in Force (the capturing target decides later) */
+	Separate
+};
+
+/**
+ * Per-receiver filter settings. Everything the old per-source loops checked before calling the
+ * plugin, minus line of sight, which stays with the receiver because it needs the world.
+ */
+struct FEMFForceFilter
+{
+	/** Sources further than this contribute nothing */
+	float MaxSourceDistance = 10000.0f;
+
+	/** Charged sources closer than this are dropped and flag bInsideCutoff instead. 0 disables. */
+	float CutoffDistance = 0.0f;
+
+	/** Force multiplier per source owner type, indexed by EMFForce::OwnerTypeIndex. A zero skips the type. */
+	float OwnerMultipliers[EMFForce::NumOwnerTypes] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+
+	EEMFPlateHandling PlateHandling = EEMFPlateHandling::Include;
+
+	/** Static field grid standing in for sources the gather left out (see UEMFStaticFieldSubsystem).
+	 *  Sampled at the receiver and added as environment force. */
+	const FEMFBakedField* BakedField = nullptr;
+
+	void SetMultiplier(EEMSourceOwnerType OwnerType, float Multiplier) { OwnerMultipliers[EMFForce::OwnerTypeIndex(OwnerType)] = Multiplier; }
+	float GetMultiplier(EEMSourceOwnerType OwnerType) const { return OwnerMultipliers[EMFForce::OwnerTypeIndex(OwnerType)]; }
+};
+
+/** Outcome of the cheap per-source checks, before line of sight. */
+enum class EEMFSourceVerdict : uint8
+{
+	Reject,
+	/** Charged source inside the cutoff radius: contributes no force but asks for proximity damping */
+	InsideCutoff,
+	Accept
+};
+
+/**
+ * Everything needed to evaluate one receiver, whoever ends up running it: the receiver's own tick,
+ * or UEMFSolverSubsystem ahead of it. Receivers fill one of these and never talk to the kernel's
+ * internals directly.
+ */
+struct FEMFForceQuery
+{
+	/** Field component the sources are gathered for (and excluded from them) */
+	UEMF_FieldComponent* Self = nullptr;
+
+	/** Identity of the receiver in the LOS cache */
+	const UObject* Receiver = nullptr;
+
+	/** Left out of LOS traces (the receiver's own collision) */
+	const AActor* IgnoreActor = nullptr;
+
+	FVector Position = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+	float Charge = 0.0f;
+
+	FEMFForceFilter Filter;
+
+	bool bLOSShielding = false;
+	bool bDrawLOSDebug = false;
+	TEnumAsByte<ECollisionChannel> LOSChannel = ECC_Visibility;
+};
+
+/** Output of one receiver evaluation. All forces already carry their owner-type multiplier. */
+struct FEMFForceResult
+{
+	/** Net force, excluding channeling plates when PlateHandling is Separate */
+	FVector Force = FVector::ZeroVector;
+
+	/** Contribution of channeling plates alone (also part of Force unless Separate) */
+	FVector PlateForce = FVector::ZeroVector;
+
+	/** Contribution per source owner type, plates included. For diagnostics. */
+	FVector OwnerForces[EMFForce::NumOwnerTypes];
+
+	/** A charged source was inside the cutoff radius (caller applies proximity damping) */
+	bool bInsideCutoff = false;
+
+	/** At least one channeling plate contributed */
+	bool bPlateContributed = false;
+
+	/** Sources that made it past every filter */
+	int32 NumContributing = 0;
+
+	FEMFForceResult() { Reset(); }
+
+	void Reset();
+};
+
+/**
+ * Many receivers at once, structure-of-arrays. Receiver i reads Sources[SourceOffsets[i] ..
+ * SourceOffsets[i + 1]) and Filters[FilterIndices[i]], and writes Results[i]. Reset() keeps
+ * capacity, so a batch that lives across frames stops allocating once it has seen its peak size.
+ */
+struct POLARITY_API FEMFForceBatch
+{
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> Charges;
+	TArray<int32> FilterIndices;
+	TArray<int32> SourceOffsets;
+
+	TArray<FEMFForceFilter> Filters;
+	TArray<const FEMSourceDescription*> Sources;
+
+	TArray<FEMFForceResult> Results;
+
+	void Reset();
+
+	int32 Num() const { return Positions.Num(); }
+
+	/** Append a receiver; its sources are whatever gets added to Sources before the next AddReceiver. */
+	int32 AddReceiver(const FVector& Position, const FVector& Velocity, float Charge, int32 FilterIndex);
+
+	/** Close the source list of the last receiver. Call once after the final AddReceiver's sources. */
+	void Finalize();
+};
+
+/**
+ * The force backend receivers call instead of looping CalculateLorentzForceComplete one source at a
+ * time.
+ *
+ * The plugin's force function takes a source array and superposes the fields in it, so there was
+ * never a need to wrap every source in its own temporary TArray (one heap allocation per source per
+ * receiver per tick). Sources are filtered here and binned by owner type into reusable scratch
+ * arrays, and the plugin is called once per non-empty bin; the per-type multiplier is applied to
+ * the bin result, which is the same thing by linearity. Passive sources (dielectrics, grounded
+ * conductors) are the exception: what they do depends on what else is in the array, so each is
+ * still evaluated on its own, exactly as before.
+ *
+ * The kernel owns all its scratch memory and never shrinks it, so after the first few frames a
+ * receiver evaluation does no heap allocation at all. One kernel per thread: the game thread has
+ * its own (GetGameThreadKernel), anything running receivers elsewhere creates its own.
+ *
+ * Binning assumes the plugin is linear in its active sources; EMF.ForceKernel.CheckLinearity 1
+ * re-evaluates each bin per source and logs any difference. EMF.ForceKernel.Batched 0 goes back to
+ * one plugin call per source, for comparing against.
+ */
+class POLARITY_API FEMFForceKernel
+{
+public:
+	/** Return true to drop the source (line of sight shielding). */
+	using FShieldTest = TFunctionRef<bool(const FEMSourceDescription& Source)>;
+	using FBatchShieldTest = TFunctionRef<bool(int32 ReceiverIndex, const FEMSourceDescription& Source)>;
+
+	/** The kernel every game-thread receiver shares. */
+	static FEMFForceKernel& GetGameThreadKernel();
+
+	/** Sources within Radius of Center, excluding Self, through the source index. The view stays
+	 *  valid until the next GatherSources on this kernel. With bAllowApproximation, static sources a
+	 *  baked grid covers may be left out (GetGatheredBakedField then returns that grid) and distant
+	 *  charge clusters may come back as Barnes-Hut aggregates. Not for LOS-shielded receivers. */
+	TConstArrayView<const FEMSourceDescription*> GatherSources(UEMF_FieldComponent* Self, const FVector& Center, float Radius,
+		bool bAllowApproximation = false);
+
+	/** Grid the last GatherSources substituted for some of its sources, or null. Goes into FEMFForceFilter::BakedField. */
+	const FEMFBakedField* GetGatheredBakedField() const { return GatheredBakedField; }
+
+	/** Net force on one receiver. */
+	void Evaluate(const FVector& Position, const FVector& Velocity, float Charge, const FEMFForceFilter& Filter,
+		TConstArrayView<const FEMSourceDescription*> Sources, FEMFForceResult& OutResult);
+
+	void Evaluate(const FVector& Position, const FVector& Velocity, float Charge, const FEMFForceFilter& Filter,
+		TConstArrayView<const FEMSourceDescription*> Sources, FEMFForceResult& OutResult, FShieldTest IsShielded);
+
+	/** Gather, LOS and evaluate in one go: the whole force pass of a receiver that runs on its own. */
+	void EvaluateQuery(const FEMFForceQuery& Query, FEMFForceResult& OutResult);
+
+	/** Every receiver in the batch, results into Batch.Results. */
+	void Solve(FEMFForceBatch& Batch);
+	void Solve(FEMFForceBatch& Batch, FBatchShieldTest IsShielded);
+
+	/** Receiver Index of the batch only. Batches whose sources were already LOS-filtered can be
+	 *  split across threads this way, one kernel per thread. */
+	void SolveOne(const FEMFForceBatch& Batch, int32 Index, FEMFForceResult& OutResult);
+
+	/** True if the last GatherSources result points into this kernel's own storage (brute-force
+	 *  mode, or Barnes-Hut aggregates), i.e. it does not survive the next gather. Indexed results
+	 *  live until the next frame. */
+	bool IsGatherTransient() const;
+
+	// ==================== Source Filtering ====================
+
+	/** The checks every source goes through before line of sight: zero strength, distance, close-range
+	 *  cutoff, plate handling, owner multiplier. */
+	static EEMFSourceVerdict ClassifySource(const FVector& Position, int32 ReceiverChargeSign,
+		const FEMFForceFilter& Filter, const FEMSourceDescription& Source);
+
+	/** LOS shielding for a query, through the LOS cache, with the query's debug line if asked for. */
+	static bool IsSourceShielded(const FEMFForceQuery& Query, const FEMSourceDescription& Source);
+
+	static int32 GetChargeSign(float Charge)
+	{
+		return (Charge > KINDA_SMALL_NUMBER) ? 1 : ((Charge < -KINDA_SMALL_NUMBER) ? -1 : 0);
+	}
+
+	// ==================== Source Classification ====================
+
+	/** True if the source produces no force (zero charge/current/field strength, per source type) */
+	static bool IsSourceEffectivelyZero(const FEMSourceDescription& Source);
+
+	/** Effective charge sign of a source (+1, -1, or 0 for magnetic/neutral) */
+	static int32 GetSourceEffectiveChargeSign(const FEMSourceDescription& Source);
+
+	/** Player-owned finite plate, i.e. a channeling plate */
+	static bool IsChannelingPlate(const FEMSourceDescription& Source)
+	{
+		return Source.SourceType == EEMSourceType::FinitePlate && Source.OwnerType == EEMSourceOwnerType::Player;
+	}
+
+	/** Passive sources only reshape other fields; they cannot share a plugin call with anything */
+	static bool IsPassiveSource(const FEMSourceDescription& Source);
+
+private:
+	template <typename ShieldFn>
+	void EvaluateImpl(const FVector& Position, const FVector& Velocity, float Charge, const FEMFForceFilter& Filter,
+		TConstArrayView<const FEMSourceDescription*> Sources, FEMFForceResult& OutResult, ShieldFn&& IsShielded);
+
+	/** One plugin call over a scratch bin */
+	static FVector CallPlugin(float Charge, const FVector& Position, const FVector& Velocity, const TArray<FEMSourceDescription>& Bin);
+
+	/** EMF.ForceKernel.CheckLinearity: redo a batched bin one source at a time and log if the sum differs */
+	void CheckLinearity(float Charge, const FVector& Position, const FVector& Velocity,
+		const TArray<FEMSourceDescription>& Bin, const FVector& BatchedForce, float Multiplier);
+
+	/** Per owner type, plus one for channeling plates */
+	TArray<FEMSourceDescription> Bins[EMFForce::NumOwnerTypes + 1];
+
+	/** Single-source array for passive sources and the unbatched reference path */
+	TArray<FEMSourceDescription> Single;
+
+	/** GatherSources output */
+	TArray<FEMSourceDescription> GatherStorage;
+	TArray<const FEMSourceDescription*> Gathered;
+	const FEMFBakedField* GatheredBakedField = nullptr;
+};
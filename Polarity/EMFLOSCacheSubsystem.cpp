@@ -0,0 +1,190 @@
+// EMFLOSCacheSubsystem.cpp
+
+#include "EMFLOSCacheSubsystem.h"
+#include "EMFSourceIndexSubsystem.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "EMF_PluginBPLibrary.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFLOSCacheEnable(
+	TEXT("EMF.LOSCache.Enable"),
+	1,
+	TEXT("1=EMF LOS shielding reads cached results refreshed by async traces, 0=synchronous trace per source per tick"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLOSCacheRefreshRate(
+	TEXT("EMF.LOSCache.RefreshRate"),
+	10.0f,
+	TEXT("How often (Hz) each receiver/source pair is re-traced"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLOSCacheMaxStaleness(
+	TEXT("EMF.LOSCache.MaxStaleness"),
+	0.5f,
+	TEXT("Oldest result (seconds) still used while its refresh is in flight; older ones are re-traced synchronously"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLOSCacheMoveTolerance(
+	TEXT("EMF.LOSCache.MoveTolerance"),
+	200.0f,
+	TEXT("Either endpoint moving further than this (cm) since the last trace queues a refresh early"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFLOSCacheReportCmd(
+	TEXT("EMF.LOSCache.Report"),
+	TEXT("Print EMF LOS cache hit rate and traces saved since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UEMFLOSCacheSubsystem* Cache = World ? World->GetSubsystem<UEMFLOSCacheSubsystem>() : nullptr)
+		{
+			Cache->ReportStats();
+		}
+	}));
+
+namespace EMFLOSCache
+{
+	/** A receiver/source pair not evaluated for this long (source out of range, receiver asleep) is dropped */
+	static constexpr double EntryExpirySeconds = 2.0;
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFLOSCacheSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFLOSCacheSubsystem::Deinitialize()
+{
+	// Shielding traces issued on the last frame land after the world is gone; with nothing bound they are dropped
+	TraceDelegate.Unbind();
+	Cache.Reset();
+
+	Super::Deinitialize();
+}
+
+void UEMFLOSCacheSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_EMF_LOSCacheEntries, Cache.Num());
+
+	Cache.Expire(GetWorld()->GetTimeSeconds(), EMFLOSCache::EntryExpirySeconds);
+}
+
+TStatId UEMFLOSCacheSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEMFLOSCacheSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== Queries ====================
+
+bool UEMFLOSCacheSubsystem::IsSourceBlocked(UWorld* World, const UObject* Receiver, const FEMSourceDescription& Source,
+	const FVector& From, ECollisionChannel Channel, const AActor* IgnoreActor)
+{
+	if (!World)
+	{
+		return false;
+	}
+
+	UEMFLOSCacheSubsystem* Cache = CVarEMFLOSCacheEnable.GetValueOnGameThread() != 0 ? World->GetSubsystem<UEMFLOSCacheSubsystem>() : nullptr;
+	if (!Cache || !Receiver)
+	{
+		EMF_INC_DWORD_STAT(LOSSyncTraces);
+		return TraceNow(World, From, Source.Position, Channel, IgnoreActor);
+	}
+
+	const uint32 SourceId = UEMFSourceIndexSubsystem::GetSourceIdFor(World, Source);
+	return Cache->IsBlocked(Receiver, SourceId, From, Source.Position, Channel, IgnoreActor);
+}
+
+bool UEMFLOSCacheSubsystem::IsBlocked(const UObject* Receiver, uint32 SourceId, const FVector& From, const FVector& To,
+	ECollisionChannel Channel, const AActor* IgnoreActor)
+{
+	INC_DWORD_STAT(STAT_EMF_LOSQueries);
+	++TotalQueries;
+
+	const float RefreshRate = CVarEMFLOSCacheRefreshRate.GetValueOnGameThread();
+
+	FAsyncTraceCachePolicy Policy;
+	Policy.MaxStaleness = CVarEMFLOSCacheMaxStaleness.GetValueOnGameThread();
+	Policy.RefreshInterval = RefreshRate > KINDA_SMALL_NUMBER ? 1.0 / RefreshRate : 0.0;
+	Policy.MoveTolerance = CVarEMFLOSCacheMoveTolerance.GetValueOnGameThread();
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const uint64 Key = MakeKey(Receiver, SourceId);
+	EAsyncTraceCacheLookup Lookup;
+	FAsyncTraceCacheEntry& Entry = Cache.Lookup(Key, Now, From, To, Policy, Lookup);
+
+	// First time this source is evaluated for this receiver, or the answer outlived MaxStaleness
+	if (Lookup == EAsyncTraceCacheLookup::Miss)
+	{
+		EMF_INC_DWORD_STAT(LOSSyncTraces);
+		++TotalSyncTraces;
+
+		TAsyncTraceCache<uint64>::StoreResult(Entry, TraceNow(GetWorld(), From, To, Channel, IgnoreActor), Now, From, To);
+		return Entry.bBlocked;
+	}
+
+	INC_DWORD_STAT(STAT_EMF_LOSCacheHits);
+	++TotalHits;
+
+	if (Lookup == EAsyncTraceCacheLookup::RefreshDue)
+	{
+		RequestAsyncTrace(Key, Entry, From, To, Channel, IgnoreActor);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_EMF_LOSTracesSaved);
+	}
+
+	return Entry.bBlocked;
+}
+
+bool UEMFLOSCacheSubsystem::TraceNow(UWorld* World, const FVector& From, const FVector& To, ECollisionChannel Channel, const AActor* IgnoreActor)
+{
+	FHitResult LOSHit;
+	FCollisionQueryParams LOSParams(SCENE_QUERY_STAT(EMF_LOS), true, IgnoreActor);
+	return World->LineTraceSingleByChannel(LOSHit, From, To, Channel, LOSParams);
+}
+
+// ==================== Async Traces ====================
+
+void UEMFLOSCacheSubsystem::RequestAsyncTrace(uint64 Key, FAsyncTraceCacheEntry& Entry, const FVector& From, const FVector& To,
+	ECollisionChannel Channel, const AActor* IgnoreActor)
+{
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &UEMFLOSCacheSubsystem::OnTraceCompleted);
+	}
+
+	// Same query as TraceNow, so a refreshed answer agrees with a synchronous one
+	FCollisionQueryParams LOSParams(SCENE_QUERY_STAT(EMF_LOS_Async), true, IgnoreActor);
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, From, To, Channel, LOSParams,
+		FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, Cache.BeginAsyncTrace(Key, Entry, From, To));
+
+	EMF_INC_DWORD_STAT(LOSAsyncTraces);
+	++TotalAsyncTraces;
+}
+
+void UEMFLOSCacheSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	Cache.CompleteAsyncTrace(Datum, GetWorld()->GetTimeSeconds());
+}
+
+// ==================== Stats ====================
+
+void UEMFLOSCacheSubsystem::ReportStats() const
+{
+	const double HitRate = TotalQueries > 0 ? 100.0 * static_cast<double>(TotalHits) / static_cast<double>(TotalQueries) : 0.0;
+
+	// EMF.LOSCache.Enable 0 would have traced once per query
+	const int64 TracesSaved = static_cast<int64>(TotalQueries) - static_cast<int64>(TotalSyncTraces + TotalAsyncTraces);
+
+	UE_LOG(LogEMF, Log, TEXT("[EMF_LOS] queries=%llu hits=%llu (%.1f%%) sync=%llu async=%llu saved=%lld entries=%d"),
+		TotalQueries, TotalHits, HitRate, TotalSyncTraces, TotalAsyncTraces, TracesSaved, Cache.Num());
+}
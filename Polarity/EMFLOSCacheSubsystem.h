@@ -0,0 +1,89 @@
+// EMFLOSCacheSubsystem.h
+// Line-of-sight shielding results for EMF forces, refreshed by async traces
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "AsyncTraceCache.h"
+#include "EMFLOSCacheSubsystem.generated.h"
+
+struct FEMSourceDescription;
+
+/**
+ * LOS shielding used to cost one synchronous LineTraceSingleByChannel per receiver per in-range
+ * source per tick: with twenty charged things in a room that is hundreds of game-thread traces a
+ * frame, for an answer that changes a few times a second at most.
+ *
+ * Results are kept in a TAsyncTraceCache keyed by receiver and source id, the id coming from
+ * UEMFSourceIndexSubsystem, so a source has to keep its id from frame to frame for its pairs to hit.
+ * Force evaluation only wants "shielded or not" for the next few frames, so a stale answer is fine
+ * for longer than it would be for aiming: EMF.LOSCache.MaxStaleness is the limit, past which the
+ * pair is traced synchronously because a source just coming into range must not push through a wall.
+ * There is no per-receiver refresh budget; a receiver asks once per source per tick at most.
+ *
+ * Traces are complex, on the receiver's channel, and leave out the receiver's own actor, so thin
+ * shielding geometry counts. EMF.LOSCache.Enable 0 traces every time.
+ */
+UCLASS()
+class POLARITY_API UEMFLOSCacheSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Cache.Num() > 0; }
+
+	// ==================== Queries ====================
+
+	/**
+	 * Is Source shielded from a receiver at From? Receiver identifies the pair together with the
+	 * source's id; IgnoreActor is left out of the trace (the receiver's own collision).
+	 *
+	 * Goes through the cache when there is one and it is enabled, otherwise traces synchronously,
+	 * so receivers can call this unconditionally.
+	 */
+	static bool IsSourceBlocked(UWorld* World, const UObject* Receiver, const FEMSourceDescription& Source,
+		const FVector& From, ECollisionChannel Channel, const AActor* IgnoreActor);
+
+	/** Print lifetime hit rate and traces saved to the log (EMF.LOSCache.Report). */
+	void ReportStats() const;
+
+private:
+	bool IsBlocked(const UObject* Receiver, uint32 SourceId, const FVector& From, const FVector& To,
+		ECollisionChannel Channel, const AActor* IgnoreActor);
+
+	static bool TraceNow(UWorld* World, const FVector& From, const FVector& To, ECollisionChannel Channel, const AActor* IgnoreActor);
+
+	void RequestAsyncTrace(uint64 Key, FAsyncTraceCacheEntry& Entry, const FVector& From, const FVector& To,
+		ECollisionChannel Channel, const AActor* IgnoreActor);
+
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Receiver's object id in the high half, source id in the low */
+	static uint64 MakeKey(const UObject* Receiver, uint32 SourceId)
+	{
+		return (static_cast<uint64>(Receiver->GetUniqueID()) << 32) | SourceId;
+	}
+
+	TAsyncTraceCache<uint64> Cache;
+
+	/** Bound on the first async trace; every refresh trace reports back through it */
+	FTraceDelegate TraceDelegate;
+
+	// ==================== Lifetime Counters ====================
+
+	uint64 TotalQueries = 0;
+	uint64 TotalHits = 0;
+	uint64 TotalSyncTraces = 0;
+	uint64 TotalAsyncTraces = 0;
+};
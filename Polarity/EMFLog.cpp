@@ -0,0 +1,18 @@
+// EMFLog.cpp
+
+#include "EMFLog.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogEMF);
+
+static TAutoConsoleVariable<int32> CVarEMFDebugDraw(
+	TEXT("EMF.DebugDraw"),
+	1,
+	TEXT("EMF force debug drawing: 0=off, 1=receivers with their debug flag set, 2=every receiver"),
+	ECVF_Cheat);
+
+bool EMFDebug::ShouldDraw(bool bInstanceFlag)
+{
+	const int32 Mode = CVarEMFDebugDraw.GetValueOnGameThread();
+	return Mode >= 2 || (Mode == 1 && bInstanceFlag);
+}
@@ -0,0 +1,39 @@
+// EMFLog.h
+// Log category and compile-out diagnostics for the EMF force path
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogEMF, Log, All);
+
+/**
+ * EMF diagnostics that cost nothing in Shipping and Test.
+ *
+ * The force path runs for every receiver every frame, so anything it logs or draws must be free
+ * when nobody is looking. EMF_LOG compiles to nothing outside development builds; in them, per-frame
+ * messages go out at Verbose and are only formatted after "log LogEMF Verbose". Debug draws go
+ * through EMF_SHOULD_DRAW, which is constant false without ENABLE_DRAW_DEBUG and otherwise obeys
+ * EMF.DebugDraw (0 none, 1 per-instance flags, 2 every receiver).
+ */
+#define EMF_DEBUG_DIAGNOSTICS (!(UE_BUILD_SHIPPING || UE_BUILD_TEST))
+
+#if EMF_DEBUG_DIAGNOSTICS
+	#define EMF_LOG(Verbosity, Format, ...) UE_LOG(LogEMF, Verbosity, Format, ##__VA_ARGS__)
+	#define EMF_LOG_ACTIVE(Verbosity) UE_LOG_ACTIVE(LogEMF, Verbosity)
+#else
+	#define EMF_LOG(Verbosity, Format, ...) do {} while (0)
+	#define EMF_LOG_ACTIVE(Verbosity) false
+#endif
+
+#if EMF_DEBUG_DIAGNOSTICS && ENABLE_DRAW_DEBUG
+	#define EMF_SHOULD_DRAW(bInstanceFlag) EMFDebug::ShouldDraw(bInstanceFlag)
+#else
+	#define EMF_SHOULD_DRAW(bInstanceFlag) false
+#endif
+
+namespace EMFDebug
+{
+	/** EMF.DebugDraw applied to a receiver's own debug flag */
+	POLARITY_API bool ShouldDraw(bool bInstanceFlag);
+}
@@ -8,6 +8,12 @@
 #include "EMFChannelingPlateActor.h"
 #include "EMF_FieldComponent.h"
 #include "EMF_PluginBPLibrary.h"
+#include "EMFSourceIndexSubsystem.h"
+#include "EMFForceKernel.h"
+#include "EMFSolverSubsystem.h"
+#include "EMFReceiverLODSubsystem.h"
+#include "EMFLog.h"
+#include "EMFStats.h"
 #include "Variant_Shooter/AI/ShooterNPC.h"
 #include "Variant_Shooter/AI/Boss/BossCharacter.h"
 #include "Variant_Shooter/DamageTypes/DamageType_Wallslam.h"
@@ -25,11 +31,15 @@
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Variant_Shooter/UI/EMFChargeWidgetSubsystem.h"
 #include "Variant_Shooter/ShooterDoor.h"
+#include "Variant_Shooter/ShooterDoorRegistry.h"
+#include "EMFExplosionResolver.h"
+#include "EMFExplosionQueueSubsystem.h"
 #include "ShooterCharacter.h"
 #include "GeometryCollection/GeometryCollectionActor.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
-#include "Field/FieldSystemObjects.h"
+#include "VFX/GibPoolSubsystem.h"
+#include "VFX/VFXManagerSubsystem.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Checkpoint/CheckpointSubsystem.h"
 #include "AI/Coordination/AICombatCoordinator.h"
@@ -182,6 +192,15 @@ void AEMFPhysicsProp::BeginPlay()
 		}
 	}
 
+	// Gib actors for this collection exist before anything dies
+	if (PropGeometryCollection)
+	{
+		if (UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>())
+		{
+			GibPool->Prewarm(PropGeometryCollection);
+		}
+	}
+
 	CurrentHP = MaxHP;
 
 	// Initialize EMF field component
@@ -193,6 +212,21 @@ void AEMFPhysicsProp::BeginPlay()
 		// OwnerType is NOT overridden here — use whatever is set on the FieldComponent
 		// (defaults to PhysicsProp in C++ constructor, but can be changed per-instance in editor)
 		FieldComponent->SetSourceDescription(Desc);
+
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(FieldComponent);
+		}
+
+		if (UEMFSolverSubsystem* Solver = GetWorld()->GetSubsystem<UEMFSolverSubsystem>())
+		{
+			Solver->RegisterProp(this);
+		}
+
+		if (UEMFReceiverLODSubsystem* LOD = GetWorld()->GetSubsystem<UEMFReceiverLODSubsystem>())
+		{
+			LOD->RegisterProp(this);
+		}
 	}
 
 	// Sync physics body mass with EMF mass + collision setup
@@ -242,7 +276,6 @@ void AEMFPhysicsProp::BeginPlay()
 
 void AEMFPhysicsProp::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	GetWorld()->GetTimerManager().ClearTimer(GCFreezeTimer);
 	GetWorld()->GetTimerManager().ClearTimer(GCCleanupTimer);
 
 	// A decoy leaving the world has to hand its enemies back while its pointer is still valid: after
@@ -254,6 +287,21 @@ void AEMFPhysicsProp::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		WidgetSub->UnregisterProp(this);
 	}
 
+	if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+	{
+		SourceIndex->UnregisterFieldComponent(FieldComponent);
+	}
+
+	if (UEMFSolverSubsystem* Solver = GetWorld()->GetSubsystem<UEMFSolverSubsystem>())
+	{
+		Solver->UnregisterProp(this);
+	}
+
+	if (UEMFReceiverLODSubsystem* LOD = GetWorld()->GetSubsystem<UEMFReceiverLODSubsystem>())
+	{
+		LOD->UnregisterProp(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -266,14 +314,7 @@ void AEMFPhysicsProp::Tick(float DeltaTime)
 		return;
 	}
 
-	// Air Mail: while the prop is flying back to the player or has been kicked, EMF forces are
-	// suppressed entirely — the player's field otherwise sucks the returning prop onto them,
-	// ruining both the incoming flight and the kick geometry.
-	const bool bAirMailFlightActive =
-		ActorHasTag(UUpgrade_AirKick::TAG_AirMailIncoming) ||
-		ActorHasTag(UUpgrade_AirKick::TAG_AirMailKicked);
-
-	if (bAffectedByExternalFields && !bAirMailFlightActive && FieldComponent && PropMesh && PropMesh->IsSimulatingPhysics())
+	if (IsAffectedByEMForcesNow() && UEMFReceiverLODSubsystem::GetLOD(this) != EEMFReceiverLOD::Dormant)
 	{
 		ApplyEMForces(DeltaTime);
 	}
@@ -351,7 +392,7 @@ void AEMFPhysicsProp::Tick(float DeltaTime)
 	}
 
 	// Debug: always-visible capture range sphere around this prop
-	if (bDrawDebugForces && bCanBeCaptured)
+	if (EMF_SHOULD_DRAW(bDrawDebugForces) && bCanBeCaptured)
 	{
 		DrawDebugSphere(GetWorld(), GetActorLocation(), CalculateCaptureRange(), 32, FColor::Cyan, false, -1.0f, 0, 1.5f);
 	}
@@ -361,108 +402,60 @@ void AEMFPhysicsProp::Tick(float DeltaTime)
 
 void AEMFPhysicsProp::ApplyEMForces(float DeltaTime)
 {
+	EMF_SCOPE_CYCLE_COUNTER(ReceiverUpdate);
+
 	const float Charge = GetCharge();
 	if (FMath::IsNearlyZero(Charge))
 	{
 		return;
 	}
 
-	TArray<FEMSourceDescription> OtherSources = FieldComponent->GetAllOtherSources();
-	if (OtherSources.Num() == 0)
+	// Alone in the registry: nothing can act on the prop
+	if (!UEMFSourceIndexSubsystem::HasOtherSources(FieldComponent))
 	{
 		return;
 	}
 
-	const FVector Position = GetActorLocation();
-	const FVector Velocity = PropMesh->GetPhysicsLinearVelocity();
-	const float MaxDistSq = MaxSourceDistance * MaxSourceDistance;
-	const float OppositeChargeMinDistSq = OppositeChargeMinDistance * OppositeChargeMinDistance;
-	const int32 MyChargeSign = (Charge > KINDA_SMALL_NUMBER) ? 1 : ((Charge < -KINDA_SMALL_NUMBER) ? -1 : 0);
-
-	FVector TotalForce = FVector::ZeroVector;
-	bool bShouldApplyProximityDamping = false;
-
-	// Pre-allocate once, reuse in loop (avoids heap allocation per source per tick)
-	TArray<FEMSourceDescription> SingleSource;
-	SingleSource.Reserve(1);
-
-	for (const FEMSourceDescription& Source : OtherSources)
+	FEMFForceQuery Query;
+	if (!BuildForceQuery(Query))
 	{
-		if (IsSourceEffectivelyZero(Source))
-		{
-			continue;
-		}
-
-		const float DistSq = FVector::DistSquared(Position, Source.Position);
-
-		if (DistSq > MaxDistSq)
-		{
-			continue;
-		}
+		return;
+	}
 
-		// Close-range cutoff: skip any charged source inside the cutoff radius to prevent the Coulomb
-		// 1/r^2 singularity.
-		//
-		// This used to fire only when the signs DIFFERED, though the singularity it exists to prevent
-		// does not care about sign at all. Same-sign pairs therefore kept the full force at contact
-		// range, and once the weapons started driving both props and enemies to the same polarity, an
-		// enemy brushing past a prop launched it across the level. Only MaxEMForce stood between the
-		// two, and that ceiling is far above what a light prop can absorb.
-		if (bEnableOppositeChargeDistanceCutoff && DistSq < OppositeChargeMinDistSq)
+	// Far from every player the LOD hands back a blend of recent results instead
+	FEMFForceResult ForceResult;
+	if (UEMFReceiverLODSubsystem::ShouldEvaluate(this, ForceResult))
+	{
+		if (UsesFixedStepIntegration())
 		{
-			const int32 SourceChargeSign = GetSourceEffectiveChargeSign(Source);
-			if (SourceChargeSign != 0 && MyChargeSign != 0)
-			{
-				bShouldApplyProximityDamping = true;
-				continue;
-			}
+			FEMFSubstepIntegrator::Integrate(FEMFForceKernel::GetGameThreadKernel(), Query, PropMesh->GetMass(), MaxEMForce,
+				DeltaTime, SubstepState, ForceResult);
 		}
-
-		// LOS Shielding: skip sources blocked by geometry
-		if (bEnableLOSShielding)
+		else if (UEMFSolverSubsystem::TryGetResult(this, ForceResult))
 		{
-			FHitResult LOSHit;
-			FCollisionQueryParams LOSParams(SCENE_QUERY_STAT(EMF_LOS), true, this);
-			bool bBlocked = GetWorld()->LineTraceSingleByChannel(
-				LOSHit, Position, Source.Position, LOSTraceChannel, LOSParams);
-
-			if (bDrawLOSDebug)
-			{
-				DrawDebugLine(GetWorld(), Position, Source.Position,
-					bBlocked ? FColor::Red : FColor::Green, false, -1.0f, 0, 0.5f);
-			}
-
-			if (bBlocked)
+			if (UEMFSolverSubsystem::IsValidating())
 			{
-				continue;
+				UEMFSolverSubsystem::ValidateResult(this, Query, ForceResult);
 			}
 		}
-
-		const float Multiplier = GetForceMultiplierForOwnerType(Source.OwnerType);
-		if (FMath::IsNearlyZero(Multiplier))
-		{
-			continue;
-		}
-
-		// Skip channeling plate forces entirely for capturable props:
-		// - If captured: UpdateCaptureForces handles positioning (spring + damping)
-		// - If NOT captured: prevent uncaptured props from being attracted by plate's EM field
-		//   (mirrors NPC logic in EMFVelocityModifier where non-captured NPCs skip plate forces)
-		if (bCanBeCaptured &&
-			Source.SourceType == EEMSourceType::FinitePlate &&
-			Source.OwnerType == EEMSourceOwnerType::Player)
+		else
 		{
-			continue;
+			FEMFForceKernel::GetGameThreadKernel().EvaluateQuery(Query, ForceResult);
 		}
+		UEMFReceiverLODSubsystem::SubmitResult(this, ForceResult);
+	}
 
-		SingleSource.Reset();
-		SingleSource.Add(Source);
+	// Nothing in range contributing leaves nothing to apply
+	if (ForceResult.NumContributing == 0 && !ForceResult.bInsideCutoff)
+	{
+		return;
+	}
 
-		const FVector SourceForce = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(
-			Charge, Position, Velocity, SingleSource, true);
+	const FVector& Position = Query.Position;
+	const FVector& Velocity = Query.Velocity;
 
-		TotalForce += SourceForce * Multiplier;
-	}
+	FVector TotalForce = ForceResult.Force;
+	const bool bShouldApplyProximityDamping = ForceResult.bInsideCutoff;
 
 	// Suppress all EM forces when captured in normal mode (spring + damping handle positioning)
 	// In reverse flight: let other forces through with launched multipliers
@@ -514,7 +507,7 @@ void AEMFPhysicsProp::ApplyEMForces(float DeltaTime)
 				TotalForce -= TangentForce.GetSafeNormal() * FrictionMag;
 			}
 
-			if (bDrawDebugForces && FrictionMag > 0.0f)
+			if (EMF_SHOULD_DRAW(bDrawDebugForces) && FrictionMag > 0.0f)
 			{
 				const FVector FrictionDir = TangentMag > KINDA_SMALL_NUMBER ? -TangentForce.GetSafeNormal() : FVector::ZeroVector;
 				DrawDebugDirectionalArrow(
@@ -539,7 +532,7 @@ void AEMFPhysicsProp::ApplyEMForces(float DeltaTime)
 		const FVector DampingForce = -Velocity * OppositeChargeProximityDamping * PhysMass;
 		PropMesh->AddForce(DampingForce);
 
-		if (bDrawDebugForces)
+		if (EMF_SHOULD_DRAW(bDrawDebugForces))
 		{
 			DrawDebugDirectionalArrow(
 				GetWorld(), Position,
@@ -549,7 +542,7 @@ void AEMFPhysicsProp::ApplyEMForces(float DeltaTime)
 	}
 
 	// Debug
-	if (bDrawDebugForces && !TotalForce.IsNearlyZero())
+	if (EMF_SHOULD_DRAW(bDrawDebugForces) && !TotalForce.IsNearlyZero())
 	{
 		DrawDebugDirectionalArrow(
 			GetWorld(), Position,
@@ -559,9 +552,109 @@ void AEMFPhysicsProp::ApplyEMForces(float DeltaTime)
 
 	if (bLogEMForces && !TotalForce.IsNearlyZero())
 	{
-		UE_LOG(LogTemp, Log, TEXT("EMFPhysicsProp %s: Charge=%.2f Force=(%.0f, %.0f, %.0f) Sources=%d"),
-			*GetName(), Charge, TotalForce.X, TotalForce.Y, TotalForce.Z, OtherSources.Num());
+		EMF_LOG(Log, TEXT("EMFPhysicsProp %s: Charge=%.2f Force=(%.0f, %.0f, %.0f) Sources=%d"),
+			*GetName(), Charge, TotalForce.X, TotalForce.Y, TotalForce.Z, ForceResult.NumContributing);
+	}
+}
+
+bool AEMFPhysicsProp::IsAffectedByEMForcesNow() const
+{
+	// Air Mail: while the prop is flying back to the player or has been kicked, EMF forces are
+	// suppressed entirely — the player's field otherwise sucks the returning prop onto them,
+	// ruining both the incoming flight and the kick geometry.
+	const bool bAirMailFlightActive =
+		ActorHasTag(UUpgrade_AirKick::TAG_AirMailIncoming) ||
+		ActorHasTag(UUpgrade_AirKick::TAG_AirMailKicked);
+
+	return !bIsDead && bAffectedByExternalFields && !bAirMailFlightActive && FieldComponent && PropMesh && PropMesh->IsSimulatingPhysics();
+}
+
+bool AEMFPhysicsProp::IsEMFDormantCandidate() const
+{
+	if (CapturingPlate.IsValid() || bLocallyHeld || bIsInReverseFlight || !PropMesh)
+	{
+		return false;
+	}
+
+	// Still moving: let it finish whatever the field started
+	if (PropMesh->IsSimulatingPhysics() && PropMesh->GetPhysicsLinearVelocity().SizeSquared() > FMath::Square(5.0f))
+	{
+		return false;
+	}
+
+	// Uncharged or otherwise not taking forces: nothing to wake up for yet
+	FEMFForceQuery Query;
+	if (!BuildForceQuery(Query))
+	{
+		return true;
+	}
+
+	FEMFForceKernel& Kernel = FEMFForceKernel::GetGameThreadKernel();
+	const TConstArrayView<const FEMSourceDescription*> Gathered = Kernel.GatherSources(Query.Self, Query.Position, Query.Filter.MaxSourceDistance,
+		!Query.bLOSShielding);
+
+	// Inside a baked static field: its sources are in range by construction
+	if (Kernel.GetGatheredBakedField())
+	{
+		return false;
+	}
+
+	const int32 ChargeSign = FEMFForceKernel::GetChargeSign(Query.Charge);
+	for (const FEMSourceDescription* Source : Gathered)
+	{
+		if (FEMFForceKernel::ClassifySource(Query.Position, ChargeSign, Query.Filter, *Source) != EEMFSourceVerdict::Reject)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool AEMFPhysicsProp::BuildForceQuery(FEMFForceQuery& OutQuery) const
+{
+	const float Charge = GetCharge();
+	if (FMath::IsNearlyZero(Charge) || !IsAffectedByEMForcesNow())
+	{
+		return false;
+	}
+
+	OutQuery.Self = FieldComponent;
+	OutQuery.Receiver = this;
+	OutQuery.IgnoreActor = this;
+	OutQuery.Position = GetActorLocation();
+	OutQuery.Velocity = PropMesh->GetPhysicsLinearVelocity();
+	OutQuery.Charge = Charge;
+	OutQuery.Filter.MaxSourceDistance = MaxSourceDistance;
+
+	// Close-range cutoff: skip any charged source inside the cutoff radius to prevent the Coulomb
+	// 1/r^2 singularity.
+	//
+	// This used to fire only when the signs DIFFERED, though the singularity it exists to prevent
+	// does not care about sign at all. Same-sign pairs therefore kept the full force at contact
+	// range, and once the weapons started driving both props and enemies to the same polarity, an
+	// enemy brushing past a prop launched it across the level. Only MaxEMForce stood between the
+	// two, and that ceiling is far above what a light prop can absorb.
+	OutQuery.Filter.CutoffDistance = bEnableOppositeChargeDistanceCutoff ? OppositeChargeMinDistance : 0.0f;
+
+	for (int32 OwnerIndex = 0; OwnerIndex < EMFForce::NumOwnerTypes; ++OwnerIndex)
+	{
+		OutQuery.Filter.OwnerMultipliers[OwnerIndex] = GetForceMultiplierForOwnerType(static_cast<EEMSourceOwnerType>(OwnerIndex));
+	}
+
+	// Skip channeling plate forces entirely for capturable props:
+	// - If captured: UpdateCaptureForces handles positioning (spring + damping)
+	// - If NOT captured: prevent uncaptured props from being attracted by plate's EM field
+	//   (mirrors NPC logic in EMFVelocityModifier where non-captured NPCs skip plate forces)
+	if (bCanBeCaptured)
+	{
+		OutQuery.Filter.PlateHandling = EEMFPlateHandling::Skip;
 	}
+
+	// LOS Shielding: skip sources blocked by geometry
+	OutQuery.bLOSShielding = bEnableLOSShielding;
+	OutQuery.bDrawLOSDebug = bDrawLOSDebug;
+	OutQuery.LOSChannel = LOSTraceChannel;
+	return true;
 }
 
 // ==================== Channeling Capture ====================
@@ -643,10 +736,10 @@ void AEMFPhysicsProp::Multicast_PlayExplosionEffects_Implementation(FVector Expl
 {
 	if (ExplosionVFX)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(), ExplosionVFX, ExplosionLocation,
+		UVFXManagerSubsystem::SpawnSystemAtLocation(
+			this, ExplosionVFX, ExplosionLocation,
 			FRotator::ZeroRotator, FVector(VFXScale),
-			true, true, ENCPoolMethod::None);
+			true, EVFXSignificance::High);
 	}
 
 	if (ExplosionSound)
@@ -1671,10 +1764,10 @@ void AEMFPhysicsProp::OnPropOverlap(UPrimitiveComponent* OverlappedComp, AActor*
 		// EMF discharge VFX
 		if (EMFDischargeVFX)
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(), EMFDischargeVFX, ImpactPoint,
+			UVFXManagerSubsystem::SpawnSystemAtLocation(
+				this, EMFDischargeVFX, ImpactPoint,
 				FRotator::ZeroRotator, FVector(EMFDischargeVFXScale),
-				true, true, ENCPoolMethod::None);
+				true, EVFXSignificance::Medium);
 		}
 	}
 
@@ -1776,10 +1869,10 @@ void AEMFPhysicsProp::ApplyWeakImpactToNPC(AShooterNPC* HitNPC, const FVector& I
 	// 6. Effects (reuse the existing impact assets)
 	if (EMFDischargeVFX)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(), EMFDischargeVFX, ImpactPoint,
+		UVFXManagerSubsystem::SpawnSystemAtLocation(
+			this, EMFDischargeVFX, ImpactPoint,
 			FRotator::ZeroRotator, FVector(EMFDischargeVFXScale),
-			true, true, ENCPoolMethod::None);
+			true, EVFXSignificance::Medium);
 	}
 	if (ImpactSound)
 	{
@@ -1794,7 +1887,7 @@ void AEMFPhysicsProp::ApplyWeakImpactToNPC(AShooterNPC* HitNPC, const FVector& I
 float AEMFPhysicsProp::TakeDamage(float Damage, FDamageEvent const& DamageEvent,
 	AController* EventInstigator, AActor* DamageCauser)
 {
-	if (bIsDead)
+	if (bIsDead || bDetonationPending)
 	{
 		return 0.0f;
 	}
@@ -1891,7 +1984,7 @@ float AEMFPhysicsProp::TakeDamage(float Damage, FDamageEvent const& DamageEvent,
 
 void AEMFPhysicsProp::Die(AActor* Killer)
 {
-	if (bIsDead)
+	if (bIsDead || bDetonationPending)
 	{
 		return;
 	}
@@ -1953,91 +2046,46 @@ void AEMFPhysicsProp::SpawnDestructionGC(const FVector& DestructionOrigin)
 		return;
 	}
 
-	// Spawn GC actor at PropMesh's exact world transform
-	const FTransform MeshTransform = PropMesh->GetComponentTransform();
-	const FVector Origin = MeshTransform.GetLocation();
-
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AGeometryCollectionActor* GCActor = GetWorld()->SpawnActor<AGeometryCollectionActor>(
-		Origin, MeshTransform.GetRotation().Rotator(), SpawnParams);
-
-	if (!GCActor)
-	{
-		return;
-	}
-
-	UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
-	if (!GCComp)
+	UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>();
+	if (!GibPool)
 	{
-		GCActor->Destroy();
 		return;
 	}
 
+	// Gibs at PropMesh's exact world transform.
 	// Note: GC geometry is at native mesh scale from AppendStaticMesh.
 	// Actor scale is (1,1,1) — no additional scaling needed.
+	const FTransform MeshTransform = PropMesh->GetComponentTransform();
 
-	// Collision: gibs should not push pawns or block camera
-	GCComp->SetCollisionProfileName(GibCollisionProfile);
-	GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
-
-	// Assign GC asset and initialize physics
-	GCComp->SetRestCollection(PropGeometryCollection);
+	FGibSpawnParams Gibs;
+	Gibs.RestCollection = PropGeometryCollection;
+	Gibs.Transform = FTransform(MeshTransform.GetRotation(), MeshTransform.GetLocation());
+	Gibs.CollisionProfile = GibCollisionProfile;
 
 	// Copy materials from PropMesh to GC gibs — allows generic GC with prop's material
-	if (PropMesh)
+	const int32 NumMats = PropMesh->GetNumMaterials();
+	for (int32 i = 0; i < NumMats; i++)
 	{
-		const int32 NumMats = PropMesh->GetNumMaterials();
-		for (int32 i = 0; i < NumMats; i++)
-		{
-			if (UMaterialInterface* Mat = PropMesh->GetMaterial(i))
-			{
-				GCComp->SetMaterial(i, Mat);
-			}
-		}
+		Gibs.Materials.Add(PropMesh->GetMaterial(i));
 	}
 
-	GCComp->SetSimulatePhysics(true);
-	GCComp->RecreatePhysicsState();
-
-	// Break all clusters
-	UUniformScalar* StrainField = NewObject<UUniformScalar>(GCActor);
-	StrainField->Magnitude = 999999.0f;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_ExternalClusterStrain,
-		nullptr, StrainField);
-
 	// Scatter pieces radially from destruction origin (scaled by charge for explosions)
-	URadialVector* RadialVelocity = NewObject<URadialVector>(GCActor);
-	RadialVelocity->Magnitude = DestructionImpulse * CachedChargeScale;
-	RadialVelocity->Position = DestructionOrigin;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-		nullptr, RadialVelocity);
-
-	// Angular velocity for tumbling (scaled by charge for explosions)
-	URadialVector* AngularVelocity = NewObject<URadialVector>(GCActor);
-	AngularVelocity->Magnitude = DestructionAngularImpulse * CachedChargeScale;
-	AngularVelocity->Position = DestructionOrigin;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_AngularVelocity,
-		nullptr, AngularVelocity);
-
-	// Cache reference for freeze/cleanup
-	SpawnedGCActor = GCActor;
+	Gibs.FieldOrigin = DestructionOrigin;
+	Gibs.RadialSpeed = DestructionImpulse * CachedChargeScale;
+	Gibs.AngularSpeed = DestructionAngularImpulse * CachedChargeScale;
 
-	// Phase 1: after GibPhysicsLifetime, freeze gibs (disable physics + collision)
-	GetWorld()->GetTimerManager().SetTimer(GCFreezeTimer, this, &AEMFPhysicsProp::FreezeGibs, GibPhysicsLifetime, false);
+	// Phase 1: after GibPhysicsLifetime, settle gibs (collide with WorldStatic only).
+	// Phase 2: if GibVisualLifetime > 0, back to the pool after additional time;
+	// else they stay as cheap static visuals until the pool needs the actor back.
+	Gibs.SettleAfter = GibPhysicsLifetime;
+	Gibs.Lifetime = GibVisualLifetime > 0.0f ? GibPhysicsLifetime + GibVisualLifetime : 0.0f;
 
-	// Phase 2: if GibVisualLifetime > 0, destroy the frozen gibs after additional time
-	if (GibVisualLifetime > 0.0f)
+	// Cache handle for cleanup on respawn
+	SpawnedGibs = GibPool->SpawnGibs(Gibs);
+	if (!SpawnedGibs.IsSet())
 	{
-		GCActor->SetLifeSpan(GibPhysicsLifetime + GibVisualLifetime);
+		return;
 	}
-	// else: gibs persist forever as cheap static visuals
 
 	// Hide PropMesh (GC gibs replace it visually)
 	PropMesh->SetVisibility(false);
@@ -2049,32 +2097,6 @@ void AEMFPhysicsProp::SpawnDestructionGC(const FVector& DestructionOrigin)
 		GibVisualLifetime > 0.0f ? GibVisualLifetime : -1.0f);
 }
 
-void AEMFPhysicsProp::FreezeGibs()
-{
-	AGeometryCollectionActor* GCActor = SpawnedGCActor.Get();
-	if (!GCActor)
-	{
-		return;
-	}
-
-	UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
-	if (!GCComp)
-	{
-		return;
-	}
-
-	// Don't hard-freeze (SetSimulatePhysics(false)) — that leaves airborne pieces floating.
-	// Instead: strip all collision except WorldStatic so pieces can only rest on floors/walls.
-	// High linear damping makes them settle quickly. Chaos auto-sleeps stationary bodies,
-	// and sleeping rigid bodies cost near-zero (no solver iterations, no broadphase).
-	GCComp->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-	GCComp->SetCollisionResponseToAllChannels(ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
-	GCComp->SetAngularDamping(5.0f);
-
-	UE_LOG(LogTemp, Log, TEXT("EMFPhysicsProp %s: Gibs settling (collision stripped to WorldStatic, high damping)"), *GetName());
-}
-
 // ==================== Explosive Impact ====================
 
 void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, float VFXScaleMultiplier)
@@ -2118,40 +2140,78 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 	}
 
 	bHasExploded = true;
+	bDetonationPending = true;
 	bIsInReverseFlight = false;
 	bAirMailEligibleFlight = false;
 
+	FEMFQueuedExplosion Explosion;
+	Explosion.Prop = this;
+	Explosion.DetonationSerial = DetonationSerial;
+	Explosion.DamageMultiplier = DamageMultiplier;
+	Explosion.RadiusMultiplier = RadiusMultiplier;
+	Explosion.VFXScaleMultiplier = VFXScaleMultiplier;
+	Explosion.Location = GetActorLocation();
+	Explosion.Charge = GetCharge();
+
+	// Detonated, but resolved when the explosion queue gets to it: a chain that sets off a dozen
+	// props spreads over a few frames instead of landing in this one.
+	UEMFExplosionQueueSubsystem* ExplosionQueue = GetWorld()->GetSubsystem<UEMFExplosionQueueSubsystem>();
+	if (!ExplosionQueue)
+	{
+		ResolveExplosion(Explosion);
+		return;
+	}
+
+	ExplosionQueue->LinkToCause(Explosion);
+	if (!ExplosionQueue->Enqueue(Explosion))
+	{
+		ExplosionQueue->Resolve(Explosion);
+	}
+}
+
+void AEMFPhysicsProp::ResolveExplosion(const FEMFQueuedExplosion& Explosion)
+{
+	// Reset or restored from a checkpoint between detonating and being resolved: this blast belongs
+	// to a life the prop no longer has. Damage and Die wait for it otherwise, so nothing else kills
+	// the prop while it is queued.
+	if (!bHasExploded || bIsDead || Explosion.DetonationSerial != DetonationSerial)
+	{
+		return;
+	}
+	bDetonationPending = false;
+
+	const float DamageMultiplier = Explosion.DamageMultiplier;
+	const float RadiusMultiplier = Explosion.RadiusMultiplier;
+	const float VFXScaleMultiplier = Explosion.VFXScaleMultiplier;
+
 	// Charge-proportionate scaling: scale = |charge| / referenceCharge, clamped
 	float ChargeScale = 1.0f;
 	if (bScaleExplosionWithCharge)
 	{
-		const float AbsCharge = FMath::Abs(GetCharge());
+		const float AbsCharge = FMath::Abs(Explosion.Charge);
 		ChargeScale = FMath::Clamp(AbsCharge / ExplosionReferenceCharge, MinChargeScale, MaxChargeScale);
 	}
 	CachedChargeScale = ChargeScale;
 
-	const FVector ExplosionLocation = GetActorLocation();
+	const FVector ExplosionLocation = Explosion.Location;
 	const float FinalDamage = ExplosionDamage * DamageMultiplier * ChargeScale;
 	const float FinalRadius = ExplosionRadius * RadiusMultiplier;
 	const float FinalVFXScale = ExplosionVFXScale * VFXScaleMultiplier * ChargeScale;
 
-	// LOS check: trace from explosion origin to target, blocking on static world geometry only
-	FCollisionQueryParams LOSParams;
-	LOSParams.AddIgnoredActor(this);
-	LOSParams.bTraceComplex = false;
-	auto HasLineOfSight = [&](const AActor* Target) -> bool
+	// One overlap for every stage below, LOS traced once per target on first use. Resolved before
+	// any stage runs, as the separate queries effectively were: a target the damage kills is still
+	// in the set, so the later stages check IsValid and IsDead themselves.
+	FEMFExplosionResolver Resolver;
+	Resolver.Gather(GetWorld(), ExplosionLocation, FinalRadius, this);
+
+	// Props this blast reaches and that go off soon after are its chain reaction
+	if (UEMFExplosionQueueSubsystem* ExplosionQueue = GetWorld()->GetSubsystem<UEMFExplosionQueueSubsystem>())
 	{
-		if (!Target)
+		for (const FEMFExplosionTarget& Target : Resolver.GetTargets())
 		{
-			return false;
+			ExplosionQueue->NoteBlastReached(Target.Prop, Explosion);
 		}
-		FHitResult LOSHit;
-		const bool bBlocked = GetWorld()->LineTraceSingleByChannel(
-			LOSHit, ExplosionLocation, Target->GetActorLocation(),
-			ECC_Visibility, LOSParams);
-		// Not blocked, or the trace hit the target itself = has LOS
-		return !bBlocked || LOSHit.GetActor() == Target;
-	};
+	}
 
 	// Radial damage (manual per-actor with LOS) + impact tracking for delegate
 	float ImpactTotalDamage = 0.0f;
@@ -2165,32 +2225,20 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 			DamageClass = UDamageType::StaticClass();
 		}
 
-		TArray<FOverlapResult> DamageOverlaps;
-		FCollisionShape DamageSphere = FCollisionShape::MakeSphere(FinalRadius);
-		FCollisionQueryParams DamageQueryParams;
-		DamageQueryParams.AddIgnoredActor(this);
-
-		GetWorld()->OverlapMultiByChannel(
-			DamageOverlaps, ExplosionLocation, FQuat::Identity,
-			ECC_Pawn, DamageSphere, DamageQueryParams);
-
-		TSet<AActor*> DamagedActors;
-
-		for (const FOverlapResult& Overlap : DamageOverlaps)
+		for (FEMFExplosionTarget& Target : Resolver.GetTargets())
 		{
-			AActor* HitActor = Overlap.GetActor();
-			if (!HitActor || ShouldSkipPlayerForAreaEffect(HitActor) || DamagedActors.Contains(HitActor))
+			AActor* HitActor = Target.Actor;
+			if (!Target.IsOnPawnChannel() || !IsValid(HitActor) || ShouldSkipPlayerForAreaEffect(HitActor))
 			{
 				continue;
 			}
-			DamagedActors.Add(HitActor);
 
-			if (!HasLineOfSight(HitActor))
+			if (!Resolver.HasLineOfSight(Target))
 			{
 				continue;
 			}
 
-			const float Distance = FVector::Dist(ExplosionLocation, HitActor->GetActorLocation());
+			const float Distance = Target.Distance;
 			const float InnerRadius = FinalRadius * 0.3f;
 
 			// Falloff: full damage within inner radius, then power-curve falloff to edge
@@ -2208,7 +2256,7 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 			const float ActorDamage = FinalDamage * DamageAlpha;
 
 			// Track NPC state before damage for kill detection
-			AShooterNPC* HitNPC = Cast<AShooterNPC>(HitActor);
+			AShooterNPC* HitNPC = Target.NPC;
 			const bool bWasAlive = HitNPC && !HitNPC->IsDead();
 
 			UGameplayStatics::ApplyDamage(HitActor, ActorDamage, nullptr, this, DamageClass);
@@ -2229,6 +2277,11 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 	{
 		AShooterCharacter* Credited = SpendingCharacter.Get();
 		if (!Credited)
+		{
+			// Set off by somebody else's blast: the chain is theirs
+			Credited = Explosion.RootInstigator.Get();
+		}
+		if (!Credited)
 		{
 			// Nobody ever held this prop (chain explosion, shot in place, NPC threw it). Single
 			// player still credits the local player so BP upgrades counting prop impacts keep
@@ -2246,41 +2299,21 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 	// Explosion impulse: push characters and physics bodies (with LOS)
 	if (bApplyExplosionImpulse && FinalRadius > 0.0f)
 	{
-		TArray<FOverlapResult> Overlaps;
-		FCollisionShape Sphere = FCollisionShape::MakeSphere(FinalRadius);
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(this);
-
-		GetWorld()->OverlapMultiByChannel(
-			Overlaps, ExplosionLocation, FQuat::Identity,
-			ECC_Pawn, Sphere, QueryParams);
-
-		// Also sweep WorldDynamic for physics bodies
-		TArray<FOverlapResult> PhysicsOverlaps;
-		GetWorld()->OverlapMultiByChannel(
-			PhysicsOverlaps, ExplosionLocation, FQuat::Identity,
-			ECC_WorldDynamic, Sphere, QueryParams);
-		Overlaps.Append(PhysicsOverlaps);
-
-		// Track already-processed actors to avoid double impulse
-		TSet<AActor*> ProcessedActors;
-
-		for (const FOverlapResult& Overlap : Overlaps)
+		for (FEMFExplosionTarget& Target : Resolver.GetTargets())
 		{
-			AActor* HitActor = Overlap.GetActor();
-			if (!HitActor || ProcessedActors.Contains(HitActor))
+			AActor* HitActor = Target.Actor;
+			if (!IsValid(HitActor))
 			{
 				continue;
 			}
-			ProcessedActors.Add(HitActor);
 
-			if (!HasLineOfSight(HitActor))
+			if (!Resolver.HasLineOfSight(Target))
 			{
 				continue;
 			}
 
-			const FVector ToTarget = HitActor->GetActorLocation() - ExplosionLocation;
-			const float Distance = ToTarget.Size();
+			const FVector ToTarget = Target.Location - ExplosionLocation;
+			const float Distance = Target.Distance;
 
 			// Linear falloff: full strength at center, zero at edge
 			const float FalloffAlpha = FMath::Clamp(1.0f - Distance / FinalRadius, 0.0f, 1.0f);
@@ -2301,7 +2334,7 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 			}
 
 			// Character impulse via LaunchCharacter (velocity override — feels like a rocket boost)
-			ACharacter* HitCharacter = Cast<ACharacter>(HitActor);
+			ACharacter* HitCharacter = Target.Character;
 			if (HitCharacter)
 			{
 				// The boss takes NO physics impulse from prop explosions — it reacts via slowdown +
@@ -2315,8 +2348,8 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 			}
 
 			// Physics body impulse
-			UPrimitiveComponent* HitComp = Overlap.GetComponent();
-			if (HitComp && HitComp->IsSimulatingPhysics())
+			UPrimitiveComponent* HitComp = Target.GetImpulseComponent();
+			if (IsValid(HitComp) && HitComp->IsSimulatingPhysics())
 			{
 				const FVector Impulse = ImpulseDir * ExplosionPhysicsImpulse * FalloffAlpha * DamageMultiplier * ChargeScale;
 				HitComp->AddImpulse(Impulse);
@@ -2325,32 +2358,20 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 	}
 
 	// Stun nearby NPCs (with LOS).
-	// Players cannot be stunned from here at all: the AShooterNPC cast below filters them out
-	// before any gate runs. To let a thrown prop stun teammates, add a player branch to this loop
-	// and let ShouldSkipPlayerForAreaEffect decide, same as the damage loop above.
+	// Players cannot be stunned from here at all: the NPC check below filters them out before any
+	// gate runs. To let a thrown prop stun teammates, add a player branch to this loop and let
+	// ShouldSkipPlayerForAreaEffect decide, same as the damage loop above.
 	if (bApplyExplosionStun && FinalRadius > 0.0f)
 	{
-		TArray<FOverlapResult> StunOverlaps;
-		FCollisionShape StunSphere = FCollisionShape::MakeSphere(FinalRadius);
-		FCollisionQueryParams StunQueryParams;
-		StunQueryParams.AddIgnoredActor(this);
-
-		GetWorld()->OverlapMultiByChannel(
-			StunOverlaps, ExplosionLocation, FQuat::Identity,
-			ECC_Pawn, StunSphere, StunQueryParams);
-
-		TSet<AShooterNPC*> StunnedNPCs;
-
-		for (const FOverlapResult& Overlap : StunOverlaps)
+		for (FEMFExplosionTarget& Target : Resolver.GetTargets())
 		{
-			AShooterNPC* NPC = Cast<AShooterNPC>(Overlap.GetActor());
-			if (!NPC || StunnedNPCs.Contains(NPC) || NPC->IsDead())
+			AShooterNPC* NPC = Target.NPC;
+			if (!NPC || !Target.IsOnPawnChannel() || !IsValid(NPC) || NPC->IsDead())
 			{
 				continue;
 			}
-			StunnedNPCs.Add(NPC);
 
-			if (!HasLineOfSight(NPC))
+			if (!Resolver.HasLineOfSight(Target))
 			{
 				continue;
 			}
@@ -2364,48 +2385,31 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 	// Distribute charge among nearby props and NPCs (instead of chain reaction destruction)
 	if (FinalRadius > 0.0f)
 	{
-		const float MyCharge = GetCharge();
+		const float MyCharge = Explosion.Charge;
 		if (!FMath::IsNearlyZero(MyCharge))
 		{
-			// Overlap on both WorldDynamic (props) and Pawn (NPCs) channels
-			TArray<FOverlapResult> ChargeOverlaps;
-			FCollisionShape ChargeSphere = FCollisionShape::MakeSphere(FinalRadius);
-			FCollisionQueryParams ChargeQueryParams;
-			ChargeQueryParams.AddIgnoredActor(this);
-
-			// Gather props
-			TArray<AEMFPhysicsProp*> NearbyProps;
-			TArray<AShooterNPC*> NearbyNPCs;
-
-			GetWorld()->OverlapMultiByChannel(
-				ChargeOverlaps, ExplosionLocation, FQuat::Identity,
-				ECC_WorldDynamic, ChargeSphere, ChargeQueryParams);
+			// Props answer WorldDynamic, NPCs answer Pawn: the same split the two queries used to make
+			TArray<AEMFPhysicsProp*, TInlineAllocator<16>> NearbyProps;
+			TArray<UEMFVelocityModifier*, TInlineAllocator<16>> NearbyNPCModifiers;
 
-			for (const FOverlapResult& Overlap : ChargeOverlaps)
+			for (const FEMFExplosionTarget& Target : Resolver.GetTargets())
 			{
-				AEMFPhysicsProp* OtherProp = Cast<AEMFPhysicsProp>(Overlap.GetActor());
-				if (OtherProp && OtherProp != this && !OtherProp->IsDead())
+				if (!IsValid(Target.Actor))
 				{
-					NearbyProps.AddUnique(OtherProp);
+					continue;
 				}
-			}
-
-			// Gather NPCs
-			ChargeOverlaps.Reset();
-			GetWorld()->OverlapMultiByChannel(
-				ChargeOverlaps, ExplosionLocation, FQuat::Identity,
-				ECC_Pawn, ChargeSphere, ChargeQueryParams);
 
-			for (const FOverlapResult& Overlap : ChargeOverlaps)
-			{
-				AShooterNPC* NPC = Cast<AShooterNPC>(Overlap.GetActor());
-				if (NPC && !NPC->IsDead() && NPC->FindComponentByClass<UEMFVelocityModifier>())
+				if (Target.Prop && Target.IsOnDynamicChannel() && !Target.Prop->IsDead())
 				{
-					NearbyNPCs.AddUnique(NPC);
+					NearbyProps.Add(Target.Prop);
+				}
+				else if (Target.NPC && Target.NPCModifier && Target.IsOnPawnChannel() && !Target.NPC->IsDead())
+				{
+					NearbyNPCModifiers.Add(Target.NPCModifier);
 				}
 			}
 
-			const int32 TotalReceivers = NearbyProps.Num() + NearbyNPCs.Num();
+			const int32 TotalReceivers = NearbyProps.Num() + NearbyNPCModifiers.Num();
 			if (TotalReceivers > 0)
 			{
 				const float ChargePerReceiver = MyCharge / static_cast<float>(TotalReceivers);
@@ -2415,14 +2419,13 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 					Prop->SetCharge(Prop->GetCharge() + ChargePerReceiver);
 				}
 
-				for (AShooterNPC* NPC : NearbyNPCs)
+				for (UEMFVelocityModifier* NPCModifier : NearbyNPCModifiers)
 				{
-					UEMFVelocityModifier* NPCModifier = NPC->FindComponentByClass<UEMFVelocityModifier>();
 					NPCModifier->SetCharge(NPCModifier->GetCharge() + ChargePerReceiver);
 				}
 
 				UE_LOG(LogTemp, Log, TEXT("EMFPhysicsProp %s: Distributed charge %.1f among %d receivers (%d props, %d NPCs, %.1f each)"),
-					*GetName(), MyCharge, TotalReceivers, NearbyProps.Num(), NearbyNPCs.Num(), ChargePerReceiver);
+					*GetName(), MyCharge, TotalReceivers, NearbyProps.Num(), NearbyNPCModifiers.Num(), ChargePerReceiver);
 			}
 		}
 	}
@@ -2434,29 +2437,21 @@ void AEMFPhysicsProp::Explode(float DamageMultiplier, float RadiusMultiplier, fl
 
 	if (bLogEMForces)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EMFPhysicsProp %s EXPLODED: Damage=%.0f Radius=%.0f VFXScale=%.1f ChargeScale=%.2f (multipliers: %.1fx/%.1fx/%.1fx)"),
-			*GetName(), FinalDamage, FinalRadius, FinalVFXScale, ChargeScale, DamageMultiplier, RadiusMultiplier, VFXScaleMultiplier);
+		UE_LOG(LogTemp, Warning, TEXT("EMFPhysicsProp %s EXPLODED: Damage=%.0f Radius=%.0f VFXScale=%.1f ChargeScale=%.2f (multipliers: %.1fx/%.1fx/%.1fx) Targets=%d LOSTraces=%d"),
+			*GetName(), FinalDamage, FinalRadius, FinalVFXScale, ChargeScale, DamageMultiplier, RadiusMultiplier, VFXScaleMultiplier,
+			Resolver.GetTargets().Num(), Resolver.GetNumLOSTraces());
 	}
 
 	// Check for breakable doors within explosion radius
+	if (const UShooterDoorRegistry* DoorRegistry = GetWorld()->GetSubsystem<UShooterDoorRegistry>())
 	{
-		TArray<AActor*> Doors;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), AShooterDoor::StaticClass(), Doors);
-		for (AActor* DoorActor : Doors)
+		TArray<AShooterDoor*> Doors;
+		DoorRegistry->GetBreakableDoorsInRadius(ExplosionLocation, FinalRadius, Doors);
+		for (AShooterDoor* Door : Doors)
 		{
-			AShooterDoor* Door = Cast<AShooterDoor>(DoorActor);
-			if (!Door || !Door->bCanBeBrokenByDrop)
-			{
-				continue;
-			}
-
-			const float Dist = FVector::Dist(ExplosionLocation, Door->GetActorLocation());
-			if (Dist <= FinalRadius)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("EMFPhysicsProp::Explode - Breaking door %s (dist=%.1f, radius=%.1f)"),
-					*Door->GetName(), Dist, FinalRadius);
-				Door->BreakDoor(ExplosionLocation);
-			}
+			UE_LOG(LogTemp, Warning, TEXT("EMFPhysicsProp::Explode - Breaking door %s (dist=%.1f, radius=%.1f)"),
+				*Door->GetName(), FVector::Dist(ExplosionLocation, Door->GetActorLocation()), FinalRadius);
+			Door->BreakDoor(ExplosionLocation);
 		}
 	}
 
@@ -2497,6 +2492,8 @@ float AEMFPhysicsProp::GetCharge() const
 
 void AEMFPhysicsProp::ResetProp()
 {
+	++DetonationSerial;
+	bDetonationPending = false;
 	bIsDead = false;
 	bHasExploded = false;
 	bIsInReverseFlight = false;
@@ -2508,12 +2505,14 @@ void AEMFPhysicsProp::ResetProp()
 	SetActorTickEnabled(true);
 
 	// Clean up any existing GC gibs from previous death
-	GetWorld()->GetTimerManager().ClearTimer(GCFreezeTimer);
 	GetWorld()->GetTimerManager().ClearTimer(GCCleanupTimer);
-	if (AGeometryCollectionActor* OldGC = SpawnedGCActor.Get())
+	if (SpawnedGibs.IsSet())
 	{
-		OldGC->Destroy();
-		SpawnedGCActor.Reset();
+		if (UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>())
+		{
+			GibPool->ReleaseGibs(SpawnedGibs);
+		}
+		SpawnedGibs.Reset();
 	}
 
 	// Release from capture if held
@@ -2564,6 +2563,10 @@ void AEMFPhysicsProp::ResetProp()
 
 void AEMFPhysicsProp::RestoreFromCheckpointState(const FPropCheckpointData& State)
 {
+	// Whatever the prop had queued belongs to the timeline being rolled back
+	++DetonationSerial;
+	bDetonationPending = false;
+
 	if (State.bWasDead)
 	{
 		// Prop should be dead at checkpoint — silently set dead state (no GC spawn / explosion)
@@ -2788,83 +2791,3 @@ float AEMFPhysicsProp::GetForceMultiplierForOwnerType(EEMSourceOwnerType OwnerTy
 		return UnknownForceMultiplier;
 	}
 }
-
-// ==================== Source Zero Check ====================
-
-bool AEMFPhysicsProp::IsSourceEffectivelyZero(const FEMSourceDescription& Source)
-{
-	switch (Source.SourceType)
-	{
-	case EEMSourceType::PointCharge:
-		return FMath::IsNearlyZero(Source.PointChargeParams.Charge);
-	case EEMSourceType::LineCharge:
-		return FMath::IsNearlyZero(Source.LineChargeParams.LinearChargeDensity);
-	case EEMSourceType::ChargedRing:
-		return FMath::IsNearlyZero(Source.RingParams.TotalCharge);
-	case EEMSourceType::ChargedSphere:
-		return FMath::IsNearlyZero(Source.SphereParams.TotalCharge);
-	case EEMSourceType::ChargedBall:
-		return FMath::IsNearlyZero(Source.BallParams.TotalCharge);
-	case EEMSourceType::InfinitePlate:
-	case EEMSourceType::FinitePlate:
-		return FMath::IsNearlyZero(Source.PlateParams.SurfaceChargeDensity);
-	case EEMSourceType::Dipole:
-		return Source.DipoleParams.DipoleMoment.IsNearlyZero();
-	case EEMSourceType::CurrentWire:
-		return FMath::IsNearlyZero(Source.WireParams.Current);
-	case EEMSourceType::CurrentLoop:
-		return FMath::IsNearlyZero(Source.LoopParams.Current);
-	case EEMSourceType::Solenoid:
-		return FMath::IsNearlyZero(Source.SolenoidParams.Current);
-	case EEMSourceType::MagneticDipole:
-		return Source.MagneticDipoleParams.MagneticMoment.IsNearlyZero();
-	case EEMSourceType::SectorMagnet:
-		return FMath::IsNearlyZero(Source.SectorMagnetParams.FieldStrength);
-	case EEMSourceType::PlateMagnet:
-		return FMath::IsNearlyZero(Source.PlateMagnetParams.FieldStrength);
-	case EEMSourceType::DielectricSphere:
-		return FMath::IsNearlyEqual(Source.DielectricSphereParams.RelativePermittivity, 1.0f);
-	case EEMSourceType::DielectricSlab:
-		return FMath::IsNearlyEqual(Source.DielectricSlabParams.RelativePermittivity, 1.0f);
-	case EEMSourceType::GroundedConductor:
-	case EEMSourceType::GroundedPlate:
-		return false;
-	default:
-		return FMath::IsNearlyZero(Source.PointChargeParams.Charge);
-	}
-}
-
-int32 AEMFPhysicsProp::GetSourceEffectiveChargeSign(const FEMSourceDescription& Source)
-{
-	float EffectiveCharge = 0.0f;
-
-	switch (Source.SourceType)
-	{
-	case EEMSourceType::PointCharge:
-		EffectiveCharge = Source.PointChargeParams.Charge;
-		break;
-	case EEMSourceType::LineCharge:
-		EffectiveCharge = Source.LineChargeParams.LinearChargeDensity;
-		break;
-	case EEMSourceType::ChargedRing:
-		EffectiveCharge = Source.RingParams.TotalCharge;
-		break;
-	case EEMSourceType::ChargedSphere:
-		EffectiveCharge = Source.SphereParams.TotalCharge;
-		break;
-	case EEMSourceType::ChargedBall:
-		EffectiveCharge = Source.BallParams.TotalCharge;
-		break;
-	case EEMSourceType::InfinitePlate:
-	case EEMSourceType::FinitePlate:
-		EffectiveCharge = Source.PlateParams.SurfaceChargeDensity;
-		break;
-	default:
-		// Magnetic sources, dielectrics, grounded conductors — no charge sign concept
-		return 0;
-	}
-
-	if (EffectiveCharge > KINDA_SMALL_NUMBER) return 1;
-	if (EffectiveCharge < -KINDA_SMALL_NUMBER) return -1;
-	return 0;
-}
@@ -8,6 +8,8 @@
 #include "GameFramework/Actor.h"
 #include "Variant_Shooter/ShooterDummyInterface.h"
 #include "EMF_PluginBPLibrary.h"
+#include "EMFSubstepIntegrator.h"
+#include "VFX/GibPoolSubsystem.h"
 #include "EMFPhysicsProp.generated.h"
 
 class UEMF_FieldComponent;
@@ -21,6 +23,8 @@ class UAnimMontage;
 class UCurveFloat;
 class UGeometryCollection;
 class AGeometryCollectionActor;
+struct FEMFForceQuery;
+struct FEMFQueuedExplosion;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPropDeath, AEMFPhysicsProp*, Prop, AActor*, Killer);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnPropDamaged, AEMFPhysicsProp*, Prop, float, Damage, AActor*, DamageCauser);
@@ -76,8 +80,8 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Destruction", meta = (ClampMin = "0.5", ClampMax = "10.0"))
 	float GibPhysicsLifetime = 3.0f;
 
-	/** How long frozen gibs remain visible before being destroyed (seconds).
-	 *  0 = persist forever (no cleanup). Total gib lifespan = GibPhysicsLifetime + GibVisualLifetime. */
+	/** How long frozen gibs remain visible before going back to the gib pool (seconds).
+	 *  0 = persist until the pool needs the actor back (Gibs.MaxActive). Total gib lifespan = GibPhysicsLifetime + GibVisualLifetime. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Destruction", meta = (ClampMin = "0.0"))
 	float GibVisualLifetime = 0.0f;
 
@@ -111,6 +115,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Physics")
 	float MaxEMForce = 100000.0f;
 
+	/** Integrate EM forces at a fixed rate (EMF.Substep.Rate) instead of sampling them once per frame.
+	 *  For props that move fast through strong fields; the result no longer depends on frame time,
+	 *  and the close-range cutoff shrinks by EMF.Substep.CutoffScale. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Physics")
+	bool bUseFixedStepIntegration = false;
+
 	/** Maximum distance to consider EMF sources */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Physics", meta = (ClampMin = "100.0", Units = "cm"))
 	float MaxSourceDistance = 10000.0f;
@@ -602,6 +612,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "EMF")
 	float GetPropMass() const;
 
+	/** Describe this prop's force pass for the EMF force kernel. Used by ApplyEMForces and, ahead of
+	 *  it, by UEMFSolverSubsystem. False when Tick would not apply EM forces this frame. */
+	bool BuildForceQuery(FEMFForceQuery& OutQuery) const;
+
+	/** True if ApplyEMForces integrates with fixed substeps this frame (and the solver can skip us) */
+	bool UsesFixedStepIntegration() const { return FEMFSubstepIntegrator::IsActiveFor(bUseFixedStepIntegration); }
+
+	/** At rest, not held, and no charged source in range: nothing could move this prop, so the
+	 *  receiver LOD can put it to sleep. Looks the sources up, so not for every frame. */
+	bool IsEMFDormantCandidate() const;
+
 	/** Set EMF mass (also updates physics body mass) */
 	UFUNCTION(BlueprintCallable, Category = "EMF")
 	void SetPropMass(float NewMass);
@@ -635,6 +656,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Explosive Impact")
 	void Explode(float DamageMultiplier = 1.0f, float RadiusMultiplier = 1.0f, float VFXScaleMultiplier = 1.0f);
 
+	/**
+	 * The blast itself: damage, push, stun, charge transfer, effects, doors, death. Explode marks the
+	 * prop as detonated and queues this on UEMFExplosionQueueSubsystem, which calls it when the
+	 * frame's budget allows; not for calling directly.
+	 */
+	void ResolveExplosion(const FEMFQueuedExplosion& Explosion);
+
 	/** Reset prop to alive state: restore HP, visibility, physics, charge.
 	 *  Call SetActorTransform() before this if you need to restore position. */
 	UFUNCTION(BlueprintCallable, Category = "Health")
@@ -863,6 +891,14 @@ private:
 	/** True if prop has already exploded (prevents double explosion) */
 	bool bHasExploded = false;
 
+	/** Bumped by ResetProp and RestoreFromCheckpointState; a queued detonation carrying an older
+	 *  value is from before the reset and is dropped by ResolveExplosion */
+	uint32 DetonationSerial = 0;
+
+	/** Detonated and waiting in the explosion queue. The blast kills the prop when it resolves, so
+	 *  until then damage and Die are ignored rather than killing it without its blast. */
+	bool bDetonationPending = false;
+
 	/** Cached charge scale from Explode() — used by SpawnDestructionGC to scale gib impulse.
 	 *  1.0 for non-explosion deaths. */
 	float CachedChargeScale = 1.0f;
@@ -971,6 +1007,9 @@ private:
 	float WeakCaptureTimer = 0.0f;
 	bool bReverseLaunchInitialized = false;
 
+	/** Fixed-step EM integration carry-over, see bUseFixedStepIntegration */
+	FEMFSubstepState SubstepState;
+
 	// ==================== Internal Methods ====================
 
 	/** Calculate effective capture range based on player and prop charges.
@@ -980,6 +1019,9 @@ private:
 	/** Apply electromagnetic forces from all EMF sources */
 	void ApplyEMForces(float DeltaTime);
 
+	/** Tick's conditions for applying EM forces (alive, affected, not in Air Mail flight, simulating) */
+	bool IsAffectedByEMForcesNow() const;
+
 	/** Apply viscous capture forces when held by channeling plate */
 	void UpdateCaptureForces(float DeltaTime);
 
@@ -1032,22 +1074,11 @@ private:
 	/** Get force multiplier for a given source owner type */
 	float GetForceMultiplierForOwnerType(EEMSourceOwnerType OwnerType) const;
 
-	/** Check if source has effectively zero charge/field strength */
-	static bool IsSourceEffectivelyZero(const FEMSourceDescription& Source);
-
-	/** Get effective charge sign of source (+1, -1, or 0 for magnetic/neutral) */
-	static int32 GetSourceEffectiveChargeSign(const FEMSourceDescription& Source);
-
 	// ==================== Geometry Collection Destruction (Internal) ====================
 
-	/** Settle GC gibs: strip collision to WorldStatic only, apply high damping.
-	 *  Pieces fall to rest naturally, Chaos auto-sleeps them (near-zero cost). */
-	void FreezeGibs();
-
-	FTimerHandle GCFreezeTimer;
 	FTimerHandle GCCleanupTimer;
 
-	/** Cached reference to spawned GC actor (for freeze/cleanup) */
-	UPROPERTY()
-	TWeakObjectPtr<AGeometryCollectionActor> SpawnedGCActor;
+	/** Gibs taken from UGibPoolSubsystem on death (for cleanup on respawn). The pool settles and
+	 *  recycles them itself; the handle goes stale once it has. */
+	FGibHandle SpawnedGibs;
 };
@@ -0,0 +1,407 @@
+// EMFReceiverLODSubsystem.cpp
+
+#include "EMFReceiverLODSubsystem.h"
+#include "EMFVelocityModifier.h"
+#include "EMFPhysicsProp.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "Coop/CoopPlayers.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFLODEnable(
+	TEXT("EMF.LOD.Enable"),
+	1,
+	TEXT("1=EMF receivers re-evaluate at a rate set by their distance to players and visibility, 0=every receiver every frame"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLODNearDistance(
+	TEXT("EMF.LOD.NearDistance"),
+	2000.0f,
+	TEXT("Receivers closer than this (cm) to any player evaluate every frame"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLODMidDistance(
+	TEXT("EMF.LOD.MidDistance"),
+	5000.0f,
+	TEXT("Receivers closer than this (cm) to any player evaluate at EMF.LOD.MidRate, the rest at EMF.LOD.FarRate"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLODMidRate(
+	TEXT("EMF.LOD.MidRate"),
+	30.0f,
+	TEXT("Force evaluations per second for Mid receivers"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLODFarRate(
+	TEXT("EMF.LOD.FarRate"),
+	10.0f,
+	TEXT("Force evaluations per second for Far receivers"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLODBucketInterval(
+	TEXT("EMF.LOD.BucketInterval"),
+	0.25f,
+	TEXT("Seconds between bucket passes (also how long a dormant prop may take to notice a source)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFLODVisibilityWindow(
+	TEXT("EMF.LOD.VisibilityWindow"),
+	0.5f,
+	TEXT("A receiver rendered within this many seconds counts as visible and is promoted one bucket"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFLODReportCmd(
+	TEXT("EMF.LOD.Report"),
+	TEXT("Print EMF receiver bucket populations and force evaluations saved since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UEMFReceiverLODSubsystem* LOD = World ? World->GetSubsystem<UEMFReceiverLODSubsystem>() : nullptr)
+		{
+			LOD->ReportStats();
+		}
+	}));
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFReceiverLODSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFReceiverLODSubsystem::Deinitialize()
+{
+	Modifiers.Empty();
+	Props.Empty();
+	States.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UEMFReceiverLODSubsystem::IsTickable() const
+{
+	return States.Num() > 0 && CVarEMFLODEnable.GetValueOnGameThread() != 0;
+}
+
+TStatId UEMFReceiverLODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEMFReceiverLODSubsystem, STATGROUP_Tickables);
+}
+
+void UEMFReceiverLODSubsystem::Tick(float DeltaTime)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now < NextBucketTime)
+	{
+		return;
+	}
+
+	NextBucketTime = Now + FMath::Max(CVarEMFLODBucketInterval.GetValueOnGameThread(), 0.0f);
+	UpdateBuckets();
+}
+
+// ==================== Registration ====================
+
+void UEMFReceiverLODSubsystem::RegisterModifier(UEMFVelocityModifier* Modifier)
+{
+	if (Modifier)
+	{
+		Modifiers.AddUnique(Modifier);
+		States.FindOrAdd(TObjectKey<UObject>(Modifier));
+	}
+}
+
+void UEMFReceiverLODSubsystem::UnregisterModifier(UEMFVelocityModifier* Modifier)
+{
+	Modifiers.Remove(Modifier);
+	States.Remove(TObjectKey<UObject>(Modifier));
+}
+
+void UEMFReceiverLODSubsystem::RegisterProp(AEMFPhysicsProp* Prop)
+{
+	if (Prop)
+	{
+		Props.AddUnique(Prop);
+		States.FindOrAdd(TObjectKey<UObject>(Prop));
+	}
+}
+
+void UEMFReceiverLODSubsystem::UnregisterProp(AEMFPhysicsProp* Prop)
+{
+	Props.Remove(Prop);
+	States.Remove(TObjectKey<UObject>(Prop));
+}
+
+// ==================== Queries ====================
+
+bool UEMFReceiverLODSubsystem::ShouldEvaluate(const UObject* Receiver, FEMFForceResult& OutResult)
+{
+	UWorld* World = Receiver ? Receiver->GetWorld() : nullptr;
+	UEMFReceiverLODSubsystem* LOD = World ? World->GetSubsystem<UEMFReceiverLODSubsystem>() : nullptr;
+	if (!LOD || CVarEMFLODEnable.GetValueOnGameThread() == 0)
+	{
+		return true;
+	}
+
+	const FReceiverState* State = LOD->FindState(Receiver);
+	if (!State)
+	{
+		return true;
+	}
+
+	if (State->LOD == EEMFReceiverLOD::Dormant)
+	{
+		OutResult.Reset();
+		INC_DWORD_STAT(STAT_EMF_LODSkipped);
+		++LOD->TotalSkipped;
+		return false;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	if (!State->bHasResult || Now >= State->NextEvalTime)
+	{
+		return true;
+	}
+
+	Blend(*State, Now, OutResult);
+	INC_DWORD_STAT(STAT_EMF_LODSkipped);
+	++LOD->TotalSkipped;
+	return false;
+}
+
+void UEMFReceiverLODSubsystem::SubmitResult(const UObject* Receiver, FEMFForceResult& InOutResult)
+{
+	UWorld* World = Receiver ? Receiver->GetWorld() : nullptr;
+	UEMFReceiverLODSubsystem* LOD = World ? World->GetSubsystem<UEMFReceiverLODSubsystem>() : nullptr;
+	FReceiverState* State = LOD ? LOD->FindState(Receiver) : nullptr;
+	if (!State)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+
+	State->Previous = State->bHasResult ? State->Last : InOutResult;
+	State->Last = InOutResult;
+	State->bHasResult = true;
+	State->LastEvalTime = Now;
+	State->NextEvalTime = Now + State->Interval;
+	++LOD->TotalEvaluations;
+
+	Blend(*State, Now, InOutResult);
+}
+
+bool UEMFReceiverLODSubsystem::IsDueBy(const UObject* Receiver, double Time)
+{
+	UWorld* World = Receiver ? Receiver->GetWorld() : nullptr;
+	UEMFReceiverLODSubsystem* LOD = World ? World->GetSubsystem<UEMFReceiverLODSubsystem>() : nullptr;
+	if (!LOD || CVarEMFLODEnable.GetValueOnGameThread() == 0)
+	{
+		return true;
+	}
+
+	const FReceiverState* State = LOD->FindState(Receiver);
+	if (!State)
+	{
+		return true;
+	}
+
+	return State->LOD != EEMFReceiverLOD::Dormant && (!State->bHasResult || Time >= State->NextEvalTime);
+}
+
+EEMFReceiverLOD UEMFReceiverLODSubsystem::GetLOD(const UObject* Receiver)
+{
+	UWorld* World = Receiver ? Receiver->GetWorld() : nullptr;
+	UEMFReceiverLODSubsystem* LOD = World ? World->GetSubsystem<UEMFReceiverLODSubsystem>() : nullptr;
+	if (!LOD || CVarEMFLODEnable.GetValueOnGameThread() == 0)
+	{
+		return EEMFReceiverLOD::Near;
+	}
+
+	const FReceiverState* State = LOD->FindState(Receiver);
+	return State ? State->LOD : EEMFReceiverLOD::Near;
+}
+
+// ==================== Buckets ====================
+
+void UEMFReceiverLODSubsystem::UpdateBuckets()
+{
+	UWorld* World = GetWorld();
+
+	PlayerPawns.Reset();
+	CoopPlayers::GetAll(World, PlayerPawns);
+	PlayerLocations.Reset(PlayerPawns.Num());
+	for (const APawn* Pawn : PlayerPawns)
+	{
+		if (Pawn)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	int32 Counts[4] = { 0, 0, 0, 0 };
+
+	auto Assign = [this, &Counts](const UObject* Receiver, EEMFReceiverLOD NewLOD)
+	{
+		FReceiverState& State = States.FindOrAdd(TObjectKey<UObject>(Receiver));
+
+		// Waking up: whatever was cached from before it slept is meaningless now
+		if (State.LOD == EEMFReceiverLOD::Dormant && NewLOD != EEMFReceiverLOD::Dormant)
+		{
+			State.bHasResult = false;
+		}
+
+		State.LOD = NewLOD;
+		State.Interval = GetIntervalFor(NewLOD);
+
+		// A promotion takes effect now, not when the old, longer interval runs out
+		State.NextEvalTime = FMath::Min(State.NextEvalTime, State.LastEvalTime + State.Interval);
+
+		++Counts[static_cast<int32>(NewLOD)];
+	};
+
+	for (int32 i = Modifiers.Num() - 1; i >= 0; --i)
+	{
+		const UEMFVelocityModifier* Modifier = Modifiers[i].Get();
+		if (!Modifier)
+		{
+			Modifiers.RemoveAt(i);
+			continue;
+		}
+
+		// Held NPCs are driven by the plate every frame; never thin them out
+		const EEMFReceiverLOD NewLOD = Modifier->IsCapturedByPlate()
+			? EEMFReceiverLOD::Near
+			: ClassifyByDistance(Modifier->GetOwner(), PlayerLocations);
+		Assign(Modifier, NewLOD);
+	}
+
+	for (int32 i = Props.Num() - 1; i >= 0; --i)
+	{
+		const AEMFPhysicsProp* Prop = Props[i].Get();
+		if (!Prop)
+		{
+			Props.RemoveAt(i);
+			continue;
+		}
+
+		EEMFReceiverLOD NewLOD;
+		if (Prop->IsCapturedByPlate() || Prop->IsInReverseFlight())
+		{
+			NewLOD = EEMFReceiverLOD::Near;
+		}
+		else if (Prop->IsEMFDormantCandidate())
+		{
+			NewLOD = EEMFReceiverLOD::Dormant;
+		}
+		else
+		{
+			NewLOD = ClassifyByDistance(Prop, PlayerLocations);
+		}
+		Assign(Prop, NewLOD);
+	}
+
+	// Stale entries of receivers that went away without unregistering
+	for (auto It = States.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_EMF_LODNear, Counts[static_cast<int32>(EEMFReceiverLOD::Near)]);
+	SET_DWORD_STAT(STAT_EMF_LODMid, Counts[static_cast<int32>(EEMFReceiverLOD::Mid)]);
+	SET_DWORD_STAT(STAT_EMF_LODFar, Counts[static_cast<int32>(EEMFReceiverLOD::Far)]);
+	SET_DWORD_STAT(STAT_EMF_LODDormant, Counts[static_cast<int32>(EEMFReceiverLOD::Dormant)]);
+}
+
+EEMFReceiverLOD UEMFReceiverLODSubsystem::ClassifyByDistance(const AActor* Actor, const TArray<FVector>& InPlayerLocations) const
+{
+	// No players to be far from (dedicated server between rounds, benchmarks): full rate
+	if (!Actor || InPlayerLocations.Num() == 0)
+	{
+		return EEMFReceiverLOD::Near;
+	}
+
+	const FVector Location = Actor->GetActorLocation();
+	float MinDistSq = MAX_FLT;
+	for (const FVector& PlayerLocation : InPlayerLocations)
+	{
+		MinDistSq = FMath::Min(MinDistSq, static_cast<float>(FVector::DistSquared(Location, PlayerLocation)));
+	}
+
+	EEMFReceiverLOD LOD;
+	if (MinDistSq < FMath::Square(CVarEMFLODNearDistance.GetValueOnGameThread()))
+	{
+		LOD = EEMFReceiverLOD::Near;
+	}
+	else if (MinDistSq < FMath::Square(CVarEMFLODMidDistance.GetValueOnGameThread()))
+	{
+		LOD = EEMFReceiverLOD::Mid;
+	}
+	else
+	{
+		LOD = EEMFReceiverLOD::Far;
+	}
+
+	// Something on screen gets one bucket more attention than its distance alone would give it
+	if (LOD != EEMFReceiverLOD::Near && Actor->WasRecentlyRendered(CVarEMFLODVisibilityWindow.GetValueOnGameThread()))
+	{
+		LOD = static_cast<EEMFReceiverLOD>(static_cast<uint8>(LOD) - 1);
+	}
+
+	return LOD;
+}
+
+float UEMFReceiverLODSubsystem::GetIntervalFor(EEMFReceiverLOD LOD)
+{
+	switch (LOD)
+	{
+	case EEMFReceiverLOD::Mid:
+		return 1.0f / FMath::Max(CVarEMFLODMidRate.GetValueOnGameThread(), 1.0f);
+	case EEMFReceiverLOD::Far:
+		return 1.0f / FMath::Max(CVarEMFLODFarRate.GetValueOnGameThread(), 1.0f);
+	default:
+		return 0.0f;
+	}
+}
+
+void UEMFReceiverLODSubsystem::Blend(const FReceiverState& State, double Now, FEMFForceResult& OutResult)
+{
+	OutResult = State.Last;
+	if (State.Interval <= 0.0f)
+	{
+		return;
+	}
+
+	const float Alpha = FMath::Clamp(static_cast<float>((Now - State.LastEvalTime) / State.Interval), 0.0f, 1.0f);
+	OutResult.Force = FMath::Lerp(State.Previous.Force, State.Last.Force, Alpha);
+	OutResult.PlateForce = FMath::Lerp(State.Previous.PlateForce, State.Last.PlateForce, Alpha);
+	for (int32 OwnerIndex = 0; OwnerIndex < EMFForce::NumOwnerTypes; ++OwnerIndex)
+	{
+		OutResult.OwnerForces[OwnerIndex] = FMath::Lerp(State.Previous.OwnerForces[OwnerIndex], State.Last.OwnerForces[OwnerIndex], Alpha);
+	}
+}
+
+// ==================== Stats ====================
+
+void UEMFReceiverLODSubsystem::ReportStats() const
+{
+	int32 Counts[4] = { 0, 0, 0, 0 };
+	for (const TPair<TObjectKey<UObject>, FReceiverState>& Pair : States)
+	{
+		++Counts[static_cast<int32>(Pair.Value.LOD)];
+	}
+
+	const uint64 Total = TotalEvaluations + TotalSkipped;
+	const double SavedPct = Total > 0 ? 100.0 * static_cast<double>(TotalSkipped) / static_cast<double>(Total) : 0.0;
+
+	UE_LOG(LogEMF, Log, TEXT("[EMF_LOD] near=%d mid=%d far=%d dormant=%d evaluations=%llu skipped=%llu (%.1f%%)"),
+		Counts[0], Counts[1], Counts[2], Counts[3], TotalEvaluations, TotalSkipped, SavedPct);
+}
@@ -0,0 +1,123 @@
+// EMFReceiverLODSubsystem.h
+// Significance buckets for EMF receivers: how often each one re-evaluates its force
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "EMFForceKernel.h"
+#include "EMFReceiverLODSubsystem.generated.h"
+
+class UEMFVelocityModifier;
+class AEMFPhysicsProp;
+
+/** How much attention a receiver gets. Ordered from most to least. */
+enum class EEMFReceiverLOD : uint8
+{
+	/** Every frame */
+	Near,
+	/** EMF.LOD.MidRate */
+	Mid,
+	/** EMF.LOD.FarRate */
+	Far,
+	/** Not evaluated at all until something wakes it (props at rest with no source in range) */
+	Dormant
+};
+
+/**
+ * Decides which EMF receivers evaluate their force this frame.
+ *
+ * A few times a second every registered receiver is put in a bucket by its distance to the
+ * nearest player pawn (CoopPlayers::GetAll) and whether it was rendered recently: a receiver
+ * someone can see is promoted one bucket. Captured receivers are always Near. Each bucket
+ * re-evaluates at its own rate; in between, a receiver gets its last two results blended over
+ * the interval, so the force it applies moves smoothly instead of stepping. That blend runs one
+ * interval behind, which at Mid and Far distances nobody notices.
+ *
+ * Props at rest with no charged source in range are Dormant: ApplyEMForces does not run for them
+ * at all. The bucket pass looks for sources around them each time, so a source entering range
+ * wakes them within EMF.LOD.BucketInterval.
+ *
+ * Usage from a receiver:
+ *   if (UEMFReceiverLODSubsystem::ShouldEvaluate(this, Result)) { evaluate into Result; SubmitResult(this, Result); }
+ */
+UCLASS()
+class POLARITY_API UEMFReceiverLODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override;
+
+	// ==================== Registration ====================
+
+	void RegisterModifier(UEMFVelocityModifier* Modifier);
+	void UnregisterModifier(UEMFVelocityModifier* Modifier);
+
+	void RegisterProp(AEMFPhysicsProp* Prop);
+	void UnregisterProp(AEMFPhysicsProp* Prop);
+
+	// ==================== Queries ====================
+
+	/** True if Receiver should evaluate its force this frame. When false, OutResult holds the
+	 *  blended force to use instead. Unknown receivers and LOD off always evaluate. */
+	static bool ShouldEvaluate(const UObject* Receiver, FEMFForceResult& OutResult);
+
+	/** Hand a fresh evaluation over. InOutResult becomes the force to apply this frame, which for
+	 *  anything but Near is the start of the blend towards it. */
+	static void SubmitResult(const UObject* Receiver, FEMFForceResult& InOutResult);
+
+	/** True if Receiver will evaluate at or before Time (the solver skips receivers that will not) */
+	static bool IsDueBy(const UObject* Receiver, double Time);
+
+	/** Current bucket; Near for anything not registered */
+	static EEMFReceiverLOD GetLOD(const UObject* Receiver);
+
+	/** Print bucket populations and evaluations saved */
+	void ReportStats() const;
+
+private:
+	struct FReceiverState
+	{
+		EEMFReceiverLOD LOD = EEMFReceiverLOD::Near;
+		double LastEvalTime = -1.0;
+		double NextEvalTime = 0.0;
+		float Interval = 0.0f;
+		FEMFForceResult Previous;
+		FEMFForceResult Last;
+		bool bHasResult = false;
+	};
+
+	/** Re-bucket every receiver */
+	void UpdateBuckets();
+
+	EEMFReceiverLOD ClassifyByDistance(const AActor* Actor, const TArray<FVector>& PlayerLocations) const;
+
+	static float GetIntervalFor(EEMFReceiverLOD LOD);
+
+	static void Blend(const FReceiverState& State, double Now, FEMFForceResult& OutResult);
+
+	FReceiverState* FindState(const UObject* Receiver) { return States.Find(TObjectKey<UObject>(Receiver)); }
+
+	TArray<TWeakObjectPtr<UEMFVelocityModifier>> Modifiers;
+	TArray<TWeakObjectPtr<AEMFPhysicsProp>> Props;
+	TMap<TObjectKey<UObject>, FReceiverState> States;
+
+	double NextBucketTime = 0.0;
+
+	/** Scratch for the bucket pass */
+	TArray<APawn*> PlayerPawns;
+	TArray<FVector> PlayerLocations;
+
+	uint64 TotalEvaluations = 0;
+	uint64 TotalSkipped = 0;
+};
@@ -0,0 +1,390 @@
+// EMFSolverSubsystem.cpp
+
+#include "EMFSolverSubsystem.h"
+#include "EMFVelocityModifier.h"
+#include "EMFPhysicsProp.h"
+#include "EMFReceiverLODSubsystem.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "EMF_FieldComponent.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/MovementComponent.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFSolverEnable(
+	TEXT("EMF.Solver.Enable"),
+	1,
+	TEXT("1=EMF forces for all receivers are computed in one parallel pass before physics, ahead of the receivers, 0=each receiver computes its own in its tick"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFSolverDeterministic(
+	TEXT("EMF.Solver.Deterministic"),
+	0,
+	TEXT("1=run the solver pass on the game thread only, in registration order"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFSolverValidate(
+	TEXT("EMF.Solver.Validate"),
+	0,
+	TEXT("1=every receiver that takes a solver result also evaluates its live query inline and reports any result that is not bit-identical"),
+	ECVF_Default);
+
+// ==================== Tick Function ====================
+
+void FEMFSolverTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Solver && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Solver->Tick(DeltaTime);
+	}
+}
+
+FString FEMFSolverTickFunction::DiagnosticMessage()
+{
+	return TEXT("FEMFSolverTickFunction");
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFSolverSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFSolverSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Before the receivers' BeginPlay, which adds this as a prerequisite of their ticks
+	SolverTick.Solver = this;
+	SolverTick.TickGroup = TG_PrePhysics;
+	SolverTick.bCanEverTick = true;
+	SolverTick.bStartWithTickEnabled = true;
+	SolverTick.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UEMFSolverSubsystem::Deinitialize()
+{
+	SolverTick.UnRegisterTickFunction();
+	SolverTick.Solver = nullptr;
+
+	Modifiers.Empty();
+	Props.Empty();
+	Batch.Reset();
+	ReceiverToIndex.Empty();
+	SourceCopies.Empty();
+	ChunkKernels.Empty();
+
+	Super::Deinitialize();
+}
+
+void UEMFSolverSubsystem::Tick(float DeltaTime)
+{
+	ReportValidation();
+
+	if ((Modifiers.Num() == 0 && Props.Num() == 0) || CVarEMFSolverEnable.GetValueOnGameThread() == 0)
+	{
+		return;
+	}
+
+	Prepare();
+	Solve();
+
+	ResultFrame = GFrameCounter;
+	SET_DWORD_STAT(STAT_EMF_SolverReceivers, Batch.Num());
+}
+
+// ==================== Registration ====================
+
+void UEMFSolverSubsystem::RegisterModifier(UEMFVelocityModifier* Modifier)
+{
+	if (!Modifier)
+	{
+		return;
+	}
+
+	Modifiers.AddUnique(Modifier);
+
+	TArray<FTickFunction*, TInlineAllocator<2>> Ticks;
+	GetReceiverTicks(Modifier, Ticks);
+	for (FTickFunction* Tick : Ticks)
+	{
+		Tick->AddPrerequisite(this, SolverTick);
+	}
+}
+
+void UEMFSolverSubsystem::UnregisterModifier(UEMFVelocityModifier* Modifier)
+{
+	Modifiers.Remove(Modifier);
+	ReceiverToIndex.Remove(Modifier);
+
+	TArray<FTickFunction*, TInlineAllocator<2>> Ticks;
+	GetReceiverTicks(Modifier, Ticks);
+	for (FTickFunction* Tick : Ticks)
+	{
+		Tick->RemovePrerequisite(this, SolverTick);
+	}
+}
+
+void UEMFSolverSubsystem::RegisterProp(AEMFPhysicsProp* Prop)
+{
+	if (Prop)
+	{
+		Props.AddUnique(Prop);
+
+		// Forces are applied in the prop's own tick
+		Prop->PrimaryActorTick.AddPrerequisite(this, SolverTick);
+	}
+}
+
+void UEMFSolverSubsystem::UnregisterProp(AEMFPhysicsProp* Prop)
+{
+	Props.Remove(Prop);
+	ReceiverToIndex.Remove(Prop);
+
+	if (Prop)
+	{
+		Prop->PrimaryActorTick.RemovePrerequisite(this, SolverTick);
+	}
+}
+
+void UEMFSolverSubsystem::GetReceiverTicks(UEMFVelocityModifier* Modifier, TArray<FTickFunction*, TInlineAllocator<2>>& OutTicks)
+{
+	AActor* Owner = Modifier ? Modifier->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	// The movement component calls ModifyVelocity from its tick; the owner's tick is covered too for
+	// anything that evaluates the modifier from there
+	OutTicks.Add(&Owner->PrimaryActorTick);
+	if (UMovementComponent* Movement = Owner->FindComponentByClass<UMovementComponent>())
+	{
+		OutTicks.Add(&Movement->PrimaryComponentTick);
+	}
+}
+
+// ==================== Results ====================
+
+bool UEMFSolverSubsystem::TryGetResult(const UObject* Receiver, FEMFForceResult& OutResult)
+{
+	UWorld* World = Receiver ? Receiver->GetWorld() : nullptr;
+	const UEMFSolverSubsystem* Solver = World ? World->GetSubsystem<UEMFSolverSubsystem>() : nullptr;
+	if (!Solver || CVarEMFSolverEnable.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	// Only this frame's pass: anything older is a receiver the solver stopped seeing
+	if (Solver->ResultFrame != GFrameCounter)
+	{
+		return false;
+	}
+
+	const int32* Index = Solver->ReceiverToIndex.Find(Receiver);
+	if (!Index)
+	{
+		return false;
+	}
+
+	OutResult = Solver->Batch.Results[*Index];
+	return true;
+}
+
+bool UEMFSolverSubsystem::IsValidating()
+{
+	return CVarEMFSolverValidate.GetValueOnGameThread() != 0;
+}
+
+void UEMFSolverSubsystem::ValidateResult(const UObject* Receiver, const FEMFForceQuery& Query, const FEMFForceResult& SolverResult)
+{
+	UWorld* World = Receiver ? Receiver->GetWorld() : nullptr;
+	UEMFSolverSubsystem* Solver = World ? World->GetSubsystem<UEMFSolverSubsystem>() : nullptr;
+	if (!Solver)
+	{
+		return;
+	}
+
+	// Exactly what the receiver runs with the solver off, on the state it has now
+	FEMFForceResult Inline;
+	FEMFForceKernel::GetGameThreadKernel().EvaluateQuery(Query, Inline);
+
+	const bool bIdentical =
+		FMemory::Memcmp(&SolverResult.Force, &Inline.Force, sizeof(FVector)) == 0 &&
+		FMemory::Memcmp(&SolverResult.PlateForce, &Inline.PlateForce, sizeof(FVector)) == 0 &&
+		FMemory::Memcmp(SolverResult.OwnerForces, Inline.OwnerForces, sizeof(SolverResult.OwnerForces)) == 0 &&
+		SolverResult.bInsideCutoff == Inline.bInsideCutoff &&
+		SolverResult.bPlateContributed == Inline.bPlateContributed &&
+		SolverResult.NumContributing == Inline.NumContributing;
+
+	++Solver->NumValidated;
+	if (!bIdentical)
+	{
+		++Solver->NumMismatches;
+		INC_DWORD_STAT(STAT_EMF_SolverMismatches);
+	}
+}
+
+// ==================== Pass ====================
+
+void UEMFSolverSubsystem::Prepare()
+{
+	EMF_SCOPE_CYCLE_COUNTER(SolverPrepare);
+
+	Batch.Reset();
+	ReceiverToIndex.Reset();
+
+	// Order is registration order, which is what makes deterministic mode reproducible
+	for (int32 i = Modifiers.Num() - 1; i >= 0; --i)
+	{
+		if (!Modifiers[i].IsValid())
+		{
+			Modifiers.RemoveAt(i);
+		}
+	}
+	for (int32 i = Props.Num() - 1; i >= 0; --i)
+	{
+		if (!Props[i].IsValid())
+		{
+			Props.RemoveAt(i);
+		}
+	}
+
+	// Receivers the LOD will not let evaluate this frame would never read their result
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (const TWeakObjectPtr<UEMFVelocityModifier>& WeakModifier : Modifiers)
+	{
+		const UEMFVelocityModifier* Modifier = WeakModifier.Get();
+		const AActor* Owner = Modifier->GetOwner();
+
+		// Substepping receivers evaluate many times per frame on their own
+		if (Modifier->UsesFixedStepIntegration() || !UEMFReceiverLODSubsystem::IsDueBy(Modifier, Now))
+		{
+			continue;
+		}
+
+		FEMFForceQuery Query;
+		if (Owner && Modifier->BuildForceQuery(Owner->GetVelocity(), Query))
+		{
+			AddReceiver(Modifier, Query);
+		}
+	}
+
+	for (const TWeakObjectPtr<AEMFPhysicsProp>& WeakProp : Props)
+	{
+		if (WeakProp->UsesFixedStepIntegration() || !UEMFReceiverLODSubsystem::IsDueBy(WeakProp.Get(), Now))
+		{
+			continue;
+		}
+
+		FEMFForceQuery Query;
+		if (WeakProp->BuildForceQuery(Query))
+		{
+			AddReceiver(WeakProp.Get(), Query);
+		}
+	}
+
+	Batch.Finalize();
+}
+
+void UEMFSolverSubsystem::AddReceiver(const UObject* Receiver, const FEMFForceQuery& Query)
+{
+	FEMFForceKernel& Kernel = FEMFForceKernel::GetGameThreadKernel();
+	TConstArrayView<const FEMSourceDescription*> Gathered = Kernel.GatherSources(Query.Self, Query.Position, Query.Filter.MaxSourceDistance,
+		!Query.bLOSShielding);
+
+	// Baked grids are read-only, so the parallel pass can sample them straight from the filter
+	FEMFForceFilter Filter = Query.Filter;
+	Filter.BakedField = Kernel.GetGatheredBakedField();
+
+	const int32 Index = Batch.AddReceiver(Query.Position, Query.Velocity, Query.Charge, Batch.Filters.Add(Filter));
+	ReceiverToIndex.Add(Receiver, Index);
+
+	// Brute-force gathers live in the kernel's storage and are gone by the next receiver; keep a copy
+	TArray<FEMSourceDescription>* Copies = nullptr;
+	if (Kernel.IsGatherTransient())
+	{
+		if (SourceCopies.Num() <= Index)
+		{
+			SourceCopies.SetNum(Index + 1);
+		}
+		Copies = &SourceCopies[Index];
+		Copies->Reset(Gathered.Num());
+	}
+
+	const int32 ChargeSign = FEMFForceKernel::GetChargeSign(Query.Charge);
+	for (const FEMSourceDescription* Source : Gathered)
+	{
+		// Everything that touches the world happens here, on the game thread; the parallel pass only
+		// ever sees sources that are already known to be visible
+		const EEMFSourceVerdict Verdict = FEMFForceKernel::ClassifySource(Query.Position, ChargeSign, Query.Filter, *Source);
+		if (Verdict == EEMFSourceVerdict::Reject)
+		{
+			continue;
+		}
+		if (Verdict == EEMFSourceVerdict::Accept && Query.bLOSShielding && FEMFForceKernel::IsSourceShielded(Query, *Source))
+		{
+			continue;
+		}
+
+		if (Copies)
+		{
+			// Reserved above, so these pointers stay put
+			Batch.Sources.Add(&Copies->Add_GetRef(*Source));
+		}
+		else
+		{
+			Batch.Sources.Add(Source);
+		}
+	}
+}
+
+void UEMFSolverSubsystem::Solve()
+{
+	EMF_SCOPE_CYCLE_COUNTER(SolverSolve);
+
+	const int32 NumReceivers = Batch.Num();
+	if (NumReceivers == 0)
+	{
+		return;
+	}
+
+	const bool bDeterministic = CVarEMFSolverDeterministic.GetValueOnGameThread() != 0;
+
+	// Contiguous chunks, one kernel each. Kernels persist so their scratch never reallocates.
+	const int32 NumChunks = bDeterministic ? 1 : FMath::Clamp(FTaskGraphInterface::Get().GetNumWorkerThreads() + 1, 1, NumReceivers);
+	if (ChunkKernels.Num() < NumChunks)
+	{
+		ChunkKernels.SetNum(NumChunks);
+	}
+
+	const int32 ChunkSize = FMath::DivideAndRoundUp(NumReceivers, NumChunks);
+
+	ParallelFor(NumChunks, [this, ChunkSize, NumReceivers](int32 Chunk)
+	{
+		FEMFForceKernel& Kernel = ChunkKernels[Chunk];
+		const int32 End = FMath::Min((Chunk + 1) * ChunkSize, NumReceivers);
+		for (int32 i = Chunk * ChunkSize; i < End; ++i)
+		{
+			Kernel.SolveOne(Batch, i, Batch.Results[i]);
+		}
+	}, bDeterministic ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void UEMFSolverSubsystem::ReportValidation()
+{
+	if (NumMismatches > 0)
+	{
+		UE_LOG(LogEMF, Warning, TEXT("[EMF_SOLVER] %d of %d receivers differ from the inline path"), NumMismatches, NumValidated);
+	}
+	NumValidated = 0;
+	NumMismatches = 0;
+}
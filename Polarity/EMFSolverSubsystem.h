@@ -0,0 +1,129 @@
+// EMFSolverSubsystem.h
+// Computes every EMF receiver's force once per frame, in parallel, ahead of the receivers' own ticks
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "EMFForceKernel.h"
+#include "EMFSolverSubsystem.generated.h"
+
+class UEMFVelocityModifier;
+class AEMFPhysicsProp;
+class UEMFSolverSubsystem;
+
+/** Runs the solver pass in TG_PrePhysics; every receiver's tick lists it as a prerequisite */
+USTRUCT()
+struct FEMFSolverTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UEMFSolverSubsystem* Solver = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FEMFSolverTickFunction> : public TStructOpsTypeTraitsBase2<FEMFSolverTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/**
+ * One force pass for the whole world instead of one per receiver tick.
+ *
+ * The pass is its own tick function in TG_PrePhysics, and every receiver's tick (the prop's actor
+ * tick; the modifier's owner and its movement component, which calls ModifyVelocity) has it as a
+ * prerequisite, so it runs before any of them. It asks each registered receiver for its
+ * FEMFForceQuery, gathers its sources from the source index and resolves line of sight on the game
+ * thread (both touch world state), then evaluates all receivers with ParallelFor against that
+ * read-only snapshot. Receivers pick their result up later in the same frame through TryGetResult
+ * and carry on exactly as if they had computed it themselves; a receiver with no result
+ * (registered this frame, skipped by the LOD, solver off) still evaluates inline.
+ *
+ * The inputs are this frame's: receiver positions and velocities are read where the receivers'
+ * ticks would read them, before anything moves, and the solver is the first query of the frame, so
+ * the source index snapshot it gathers from is the one every inline receiver sees afterwards.
+ *
+ * Each receiver is evaluated by itself with its own sources in a fixed order, so its result does
+ * not depend on which thread ran it or what ran next to it. EMF.Solver.Deterministic forces the
+ * pass onto one thread in registration order. EMF.Solver.Validate has each receiver, when it
+ * takes its result, build its query again from its live state and evaluate it inline
+ * (FEMFForceKernel::EvaluateQuery, what it runs with the solver off), and compares the two bit for
+ * bit; mismatches are counted in "stat EMF" and logged once per frame by the next pass. A receiver
+ * pushed between the pass and its own tick (an impulse, a teleport) shows up there, as it should.
+ */
+UCLASS()
+class POLARITY_API UEMFSolverSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** The pass, from FEMFSolverTickFunction */
+	void Tick(float DeltaTime);
+
+	// ==================== Registration ====================
+
+	void RegisterModifier(UEMFVelocityModifier* Modifier);
+	void UnregisterModifier(UEMFVelocityModifier* Modifier);
+
+	void RegisterProp(AEMFPhysicsProp* Prop);
+	void UnregisterProp(AEMFPhysicsProp* Prop);
+
+	// ==================== Results ====================
+
+	/** Result computed for Receiver by this frame's pass. False if there is none, in which case the
+	 *  receiver evaluates inline as before. */
+	static bool TryGetResult(const UObject* Receiver, FEMFForceResult& OutResult);
+
+	/** True while EMF.Solver.Validate is on: receivers then hand a solver result to ValidateResult */
+	static bool IsValidating();
+
+	/** Evaluate the receiver's live Query inline and compare it bit for bit with the result the
+	 *  solver gave it */
+	static void ValidateResult(const UObject* Receiver, const FEMFForceQuery& Query, const FEMFForceResult& SolverResult);
+
+private:
+	/** Build the batch: queries, source gathering and LOS, all on the game thread */
+	void Prepare();
+
+	/** Add one receiver's query to the batch */
+	void AddReceiver(const UObject* Receiver, const FEMFForceQuery& Query);
+
+	/** Evaluate the batch, spread over worker threads unless deterministic mode is on */
+	void Solve();
+
+	/** Log what ValidateResult found since the last pass */
+	void ReportValidation();
+
+	/** The tick functions a receiver's force is applied in, which must run after the pass */
+	static void GetReceiverTicks(UEMFVelocityModifier* Modifier, TArray<FTickFunction*, TInlineAllocator<2>>& OutTicks);
+
+	FEMFSolverTickFunction SolverTick;
+
+	TArray<TWeakObjectPtr<UEMFVelocityModifier>> Modifiers;
+	TArray<TWeakObjectPtr<AEMFPhysicsProp>> Props;
+
+	/** This frame's receivers and their results; ReceiverToIndex maps into Batch */
+	FEMFForceBatch Batch;
+	TMap<const UObject*, int32> ReceiverToIndex;
+	uint64 ResultFrame = 0;
+
+	/** Per-receiver copies of brute-force gathers, which do not survive the next gather */
+	TArray<TArray<FEMSourceDescription>> SourceCopies;
+
+	/** One kernel per parallel chunk, kept across frames so their scratch stays warm */
+	TArray<FEMFForceKernel> ChunkKernels;
+
+	/** ValidateResult counts since the last pass */
+	int32 NumValidated = 0;
+	int32 NumMismatches = 0;
+};
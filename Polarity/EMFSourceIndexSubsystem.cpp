@@ -0,0 +1,538 @@
+// EMFSourceIndexSubsystem.cpp
+
+#include "EMFSourceIndexSubsystem.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "EMFStaticFieldSubsystem.h"
+#include "EMF_FieldComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFSourceIndexMode(
+	TEXT("EMF.SourceIndex.Mode"),
+	1,
+	TEXT("0=brute force (GetAllOtherSources per receiver), 1=spatial index, 2=validate (brute force over the index's snapshot, report mismatches with the grid, use brute force)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFSourceIndexCellSize(
+	TEXT("EMF.SourceIndex.CellSize"),
+	1000.0f,
+	TEXT("Grid cell size (cm) for the EMF source index. Grown automatically if the arena would need more than 64 cells per axis."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFBarnesHutEnable(
+	TEXT("EMF.BarnesHut.Enable"),
+	0,
+	TEXT("1=receivers without LOS shielding see distant clusters of moving point charges as one aggregate charge each"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFBarnesHutTheta(
+	TEXT("EMF.BarnesHut.Theta"),
+	0.5f,
+	TEXT("Barnes-Hut opening angle: a cluster is aggregated when its size / distance is below this. 0 is exact; higher is cheaper and coarser."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFBarnesHutMinCharges(
+	TEXT("EMF.BarnesHut.MinCharges"),
+	32,
+	TEXT("Fewer moving point charges than this and the tree is not built (exact is cheaper)"),
+	ECVF_Default);
+
+namespace EMFSourceIndex
+{
+	/** Upper bound per axis; keeps the grid a few hundred KB at most whatever the level size. */
+	static constexpr int32 MaxCellsPerAxis = 64;
+
+	/** Quantization for sources nobody registered: close enough that a source keeps its id while it
+	 *  sits still, coarse enough that float noise does not change it. */
+	static constexpr float UnregisteredIdQuantum = 50.0f;
+
+	static uint32 MakeUnregisteredId(const FEMSourceDescription& Source)
+	{
+		const FIntVector Q(
+			FMath::FloorToInt(Source.Position.X / UnregisteredIdQuantum),
+			FMath::FloorToInt(Source.Position.Y / UnregisteredIdQuantum),
+			FMath::FloorToInt(Source.Position.Z / UnregisteredIdQuantum));
+
+		uint32 Hash = GetTypeHash(Q);
+		Hash = HashCombine(Hash, static_cast<uint32>(Source.SourceType));
+		Hash = HashCombine(Hash, static_cast<uint32>(Source.OwnerType));
+
+		// Top bit marks "not a component id", so the two spaces never collide.
+		return Hash | 0x80000000u;
+	}
+
+	static bool SameSource(const FEMSourceDescription& A, const FEMSourceDescription& B)
+	{
+		return A.Position == B.Position && A.SourceType == B.SourceType && A.OwnerType == B.OwnerType;
+	}
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFSourceIndexSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFSourceIndexSubsystem::Deinitialize()
+{
+	Sources.Empty();
+	SourceIds.Empty();
+	RegisteredComponents.Empty();
+	ComponentToIndex.Empty();
+	PositionToIndex.Empty();
+	CellStart.Empty();
+	CellEntries.Empty();
+	EntryCell.Empty();
+	EntryBakedMask.Empty();
+	ChargeTree.Reset();
+
+	Super::Deinitialize();
+}
+
+// ==================== Registration ====================
+
+void UEMFSourceIndexSubsystem::RegisterFieldComponent(UEMF_FieldComponent* Component)
+{
+	if (Component)
+	{
+		RegisteredComponents.AddUnique(Component);
+	}
+}
+
+void UEMFSourceIndexSubsystem::UnregisterFieldComponent(UEMF_FieldComponent* Component)
+{
+	RegisteredComponents.RemoveSwap(Component);
+	ComponentToIndex.Remove(Component);
+}
+
+// ==================== Queries ====================
+
+template <typename FuncType>
+void UEMFSourceIndexSubsystem::ForEachInSphere(const FVector& Center, float Radius, int32 ExcludeIndex, FuncType&& Func) const
+{
+	if (Sources.Num() == 0)
+	{
+		return;
+	}
+
+	const FIntVector MinCell = CellCoord(Center - FVector(Radius));
+	const FIntVector MaxCell = CellCoord(Center + FVector(Radius));
+	const float RadiusSq = Radius * Radius;
+
+	for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				const int32 Cell = CellIndex(X, Y, Z);
+				for (int32 i = CellStart[Cell]; i < CellStart[Cell + 1]; ++i)
+				{
+					const int32 Entry = CellEntries[i];
+					if (Entry != ExcludeIndex && FVector::DistSquared(Center, Sources[Entry].Position) <= RadiusSq)
+					{
+						Func(Entry);
+					}
+				}
+			}
+		}
+	}
+}
+
+bool UEMFSourceIndexSubsystem::IsIndexEnabled()
+{
+	return CVarEMFSourceIndexMode.GetValueOnGameThread() != 0;
+}
+
+bool UEMFSourceIndexSubsystem::HasOtherSources(UEMF_FieldComponent* Self)
+{
+	if (!Self)
+	{
+		return false;
+	}
+
+	UWorld* World = Self->GetWorld();
+	UEMFSourceIndexSubsystem* Index = (IsIndexEnabled() && World) ? World->GetSubsystem<UEMFSourceIndexSubsystem>() : nullptr;
+	if (!Index)
+	{
+		return Self->GetAllOtherSources().Num() > 0;
+	}
+
+	Index->EnsureUpToDate(Self);
+	return Index->GetNumSources() > (Index->FindIndexOf(Self) != INDEX_NONE ? 1 : 0);
+}
+
+void UEMFSourceIndexSubsystem::GatherSources(UEMF_FieldComponent* Self, const FVector& Center, float Radius,
+	TArray<FEMSourceDescription>& BruteForceStorage, TArray<const FEMSourceDescription*>& OutSources,
+	const FEMFBakedField** OutBakedField)
+{
+	OutSources.Reset();
+	if (OutBakedField)
+	{
+		*OutBakedField = nullptr;
+	}
+
+	if (!Self)
+	{
+		return;
+	}
+
+	const int32 Mode = CVarEMFSourceIndexMode.GetValueOnGameThread();
+	UWorld* World = Self->GetWorld();
+	UEMFSourceIndexSubsystem* Index = (Mode != 0 && World) ? World->GetSubsystem<UEMFSourceIndexSubsystem>() : nullptr;
+
+	// Brute force: the reference path, and the only one available outside game worlds
+	if (!Index)
+	{
+		BruteForceStorage = Self->GetAllOtherSources();
+		OutSources.Reserve(BruteForceStorage.Num());
+		for (const FEMSourceDescription& Source : BruteForceStorage)
+		{
+			OutSources.Add(&Source);
+		}
+		INC_DWORD_STAT_BY(STAT_EMF_SourcesGathered, OutSources.Num());
+		return;
+	}
+
+	Index->EnsureUpToDate(Self);
+
+	if (Mode == 1)
+	{
+		// Straight into the caller's array: no temporaries, so a warm caller never allocates here
+		SCOPE_CYCLE_COUNTER(STAT_EMF_SourceIndexQuery);
+
+		// A baked grid covering Center stands in for its sources, as long as the masks built at the
+		// start of the frame still describe the grids that exist now
+		uint32 BakedBit = 0;
+		const FEMFBakedField* BakedField = nullptr;
+		if (OutBakedField && Index->EntryBakedMask.Num() > 0)
+		{
+			const UEMFStaticFieldSubsystem* StaticFields = World->GetSubsystem<UEMFStaticFieldSubsystem>();
+			if (StaticFields && StaticFields->GetGeneration() == Index->BakeGeneration)
+			{
+				BakedField = StaticFields->FindFieldAt(Center, BakedBit);
+			}
+		}
+
+		// Moving charges come out of the charge tree instead, distant clusters aggregated
+		const bool bUseTree = OutBakedField && Index->bChargeTreeActive;
+		const int32 SelfIndex = Index->FindIndexOf(Self);
+
+		if (BakedField || bUseTree)
+		{
+			int32 BakedOut = 0;
+			Index->ForEachInSphere(Center, Radius, SelfIndex, [Index, BakedBit, bUseTree, &BakedOut, &OutSources](int32 I)
+			{
+				if (bUseTree && Index->ChargeTree.Contains(I))
+				{
+					return;
+				}
+				if (BakedBit != 0 && (Index->EntryBakedMask[I] & BakedBit))
+				{
+					++BakedOut;
+					return;
+				}
+				OutSources.Add(&Index->GetSource(I));
+			});
+			*OutBakedField = BakedField;
+			INC_DWORD_STAT_BY(STAT_EMF_SourcesBakedOut, BakedOut);
+		}
+		else
+		{
+			Index->ForEachInSphere(Center, Radius, SelfIndex, [Index, &OutSources](int32 I)
+			{
+				OutSources.Add(&Index->GetSource(I));
+			});
+		}
+
+		if (bUseTree)
+		{
+			// Aggregates are made up on the spot; they live in the caller's storage like brute-force copies
+			BruteForceStorage.Reset();
+			Index->ChargeTree.Traverse(Center, Radius, CVarEMFBarnesHutTheta.GetValueOnGameThread(), SelfIndex,
+				[Index, &OutSources](int32 I)
+				{
+					OutSources.Add(&Index->GetSource(I));
+				},
+				[Index, &BruteForceStorage](int32 Template, const FVector& Position, float Charge)
+				{
+					BruteForceStorage.Add(FEMFChargeOctree::MakeAggregate(Index->GetSource(Template), Position, Charge));
+				});
+
+			for (const FEMSourceDescription& Aggregate : BruteForceStorage)
+			{
+				OutSources.Add(&Aggregate);
+			}
+			INC_DWORD_STAT_BY(STAT_EMF_BarnesHutAggregates, BruteForceStorage.Num());
+		}
+		INC_DWORD_STAT_BY(STAT_EMF_SourcesGathered, OutSources.Num());
+		return;
+	}
+
+	// Validate: the brute-force pass walks the same start-of-frame snapshot the grid was binned from.
+	// Against the live registry, anything that moved since the rebuild would be reported as the
+	// grid's fault.
+	const int32 SelfIndex = Index->FindIndexOf(Self);
+	BruteForceStorage.Reset(Index->Sources.Num());
+	for (int32 I = 0; I < Index->Sources.Num(); ++I)
+	{
+		if (I != SelfIndex)
+		{
+			BruteForceStorage.Add(Index->Sources[I]);
+		}
+	}
+	OutSources.Reserve(BruteForceStorage.Num());
+	for (const FEMSourceDescription& Source : BruteForceStorage)
+	{
+		OutSources.Add(&Source);
+	}
+
+	TArray<int32> Indices;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_EMF_SourceIndexQuery);
+		Index->QuerySphere(Center, Radius, SelfIndex, Indices);
+	}
+
+	// Every brute-force source inside the radius must also have come out of the grid, and nothing
+	// else. The brute-force result is what gets used, so a mismatch never changes play.
+	const float RadiusSq = Radius * Radius;
+	int32 BruteInRange = 0;
+	int32 Missing = 0;
+	for (const FEMSourceDescription* Source : OutSources)
+	{
+		if (FVector::DistSquared(Center, Source->Position) > RadiusSq)
+		{
+			continue;
+		}
+		++BruteInRange;
+
+		const bool bFound = Indices.ContainsByPredicate([Index, Source](int32 I)
+		{
+			return EMFSourceIndex::SameSource(Index->GetSource(I), *Source);
+		});
+		if (!bFound)
+		{
+			++Missing;
+		}
+	}
+
+	if (Missing > 0 || BruteInRange != Indices.Num())
+	{
+		INC_DWORD_STAT(STAT_EMF_IndexMismatches);
+		UE_LOG(LogEMF, Warning, TEXT("[EMF_INDEX] %s: brute force found %d sources in range, index %d (%d missing)"),
+			Self->GetOwner() ? *Self->GetOwner()->GetName() : TEXT("?"), BruteInRange, Indices.Num(), Missing);
+	}
+
+	INC_DWORD_STAT_BY(STAT_EMF_SourcesGathered, OutSources.Num());
+}
+
+void UEMFSourceIndexSubsystem::EnsureUpToDate(UEMF_FieldComponent* Anchor)
+{
+	if (BuiltFrame == GFrameCounter || !Anchor)
+	{
+		return;
+	}
+
+	Rebuild(Anchor);
+	BuiltFrame = GFrameCounter;
+}
+
+void UEMFSourceIndexSubsystem::QuerySphere(const FVector& Center, float Radius, int32 ExcludeIndex, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+	ForEachInSphere(Center, Radius, ExcludeIndex, [&OutIndices](int32 I)
+	{
+		OutIndices.Add(I);
+	});
+}
+
+int32 UEMFSourceIndexSubsystem::FindIndexOf(const UEMF_FieldComponent* Component) const
+{
+	if (!Component)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Found = ComponentToIndex.Find(Component))
+	{
+		return *Found;
+	}
+
+	// Not registered here (e.g. a channeling plate querying on the player's behalf): match it the slow way
+	return FindIndexByDescription(const_cast<UEMF_FieldComponent*>(Component)->GetSourceDescription());
+}
+
+uint32 UEMFSourceIndexSubsystem::GetSourceIdFor(const FEMSourceDescription& Source) const
+{
+	const FEMSourceDescription* Begin = Sources.GetData();
+	if (&Source >= Begin && &Source < Begin + Sources.Num())
+	{
+		return SourceIds[static_cast<int32>(&Source - Begin)];
+	}
+
+	const int32 Matched = FindIndexByDescription(Source);
+	return Matched != INDEX_NONE ? SourceIds[Matched] : EMFSourceIndex::MakeUnregisteredId(Source);
+}
+
+uint32 UEMFSourceIndexSubsystem::GetSourceIdFor(const UWorld* World, const FEMSourceDescription& Source)
+{
+	if (const UEMFSourceIndexSubsystem* Index = World ? World->GetSubsystem<UEMFSourceIndexSubsystem>() : nullptr)
+	{
+		return Index->GetSourceIdFor(Source);
+	}
+	return EMFSourceIndex::MakeUnregisteredId(Source);
+}
+
+// ==================== Rebuild ====================
+
+void UEMFSourceIndexSubsystem::Rebuild(UEMF_FieldComponent* Anchor)
+{
+	EMF_SCOPE_CYCLE_COUNTER(SourceIndexRebuild);
+
+	// The registry view of any component is "everything but me"; put the anchor back if it is in there
+	Sources = Anchor->GetAllOtherSources();
+	if (Anchor->IsRegistered())
+	{
+		Sources.Add(Anchor->GetSourceDescription());
+	}
+
+	PositionToIndex.Reset();
+	SourceIds.SetNumUninitialized(Sources.Num());
+	int32 NumMovingCharges = 0;
+	for (int32 i = 0; i < Sources.Num(); ++i)
+	{
+		PositionToIndex.FindOrAdd(Sources[i].Position, i);
+		SourceIds[i] = EMFSourceIndex::MakeUnregisteredId(Sources[i]);
+		NumMovingCharges += FEMFChargeOctree::IsAggregatable(Sources[i]) ? 1 : 0;
+	}
+
+	// Registered components: find their entry while their description is still the one the registry holds
+	ComponentToIndex.Reset();
+	for (int32 i = RegisteredComponents.Num() - 1; i >= 0; --i)
+	{
+		UEMF_FieldComponent* Component = RegisteredComponents[i].Get();
+		if (!Component)
+		{
+			RegisteredComponents.RemoveAtSwap(i);
+			continue;
+		}
+
+		if (!Component->IsRegistered())
+		{
+			continue;
+		}
+
+		const int32 Entry = FindIndexByDescription(Component->GetSourceDescription());
+		if (Entry != INDEX_NONE)
+		{
+			ComponentToIndex.Add(Component, Entry);
+			SourceIds[Entry] = Component->GetUniqueID() & 0x7FFFFFFFu;
+		}
+	}
+
+	BuildGrid();
+
+	// Barnes-Hut pays for itself only once there is a swarm to aggregate
+	bChargeTreeActive = CVarEMFBarnesHutEnable.GetValueOnGameThread() != 0
+		&& NumMovingCharges >= CVarEMFBarnesHutMinCharges.GetValueOnGameThread();
+	if (bChargeTreeActive)
+	{
+		ChargeTree.Build(Sources);
+	}
+	else
+	{
+		ChargeTree.Reset();
+	}
+
+	// Which static field grids hold each entry; skipped entirely on levels without a bake
+	EntryBakedMask.Reset();
+	const UEMFStaticFieldSubsystem* StaticFields = GetWorld()->GetSubsystem<UEMFStaticFieldSubsystem>();
+	BakeGeneration = StaticFields ? StaticFields->GetGeneration() : 0;
+	if (StaticFields && StaticFields->HasAnyBake())
+	{
+		EntryBakedMask.SetNumUninitialized(Sources.Num());
+		for (int32 i = 0; i < Sources.Num(); ++i)
+		{
+			EntryBakedMask[i] = StaticFields->GetBakedMask(Sources[i]);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_EMF_IndexedSources, Sources.Num());
+}
+
+void UEMFSourceIndexSubsystem::BuildGrid()
+{
+	FBox Bounds(ForceInit);
+	for (const FEMSourceDescription& Source : Sources)
+	{
+		Bounds += Source.Position;
+	}
+
+	if (!Bounds.IsValid)
+	{
+		Bounds = FBox(FVector::ZeroVector, FVector::ZeroVector);
+	}
+
+	const FVector Extent = Bounds.GetSize();
+	CellSize = FMath::Max(CVarEMFSourceIndexCellSize.GetValueOnGameThread(), 100.0f);
+	CellSize = FMath::Max(CellSize, Extent.GetMax() / (EMFSourceIndex::MaxCellsPerAxis - 1));
+
+	GridOrigin = Bounds.Min;
+	GridDims = FIntVector(
+		FMath::FloorToInt(Extent.X / CellSize) + 1,
+		FMath::FloorToInt(Extent.Y / CellSize) + 1,
+		FMath::FloorToInt(Extent.Z / CellSize) + 1);
+
+	const int32 NumCells = GridDims.X * GridDims.Y * GridDims.Z;
+
+	// Counting sort: count per cell, prefix-sum into starts, then scatter
+	CellStart.Reset();
+	CellStart.SetNumZeroed(NumCells + 1);
+	EntryCell.SetNumUninitialized(Sources.Num());
+
+	for (int32 i = 0; i < Sources.Num(); ++i)
+	{
+		const FIntVector C = CellCoord(Sources[i].Position);
+		EntryCell[i] = CellIndex(C.X, C.Y, C.Z);
+		++CellStart[EntryCell[i] + 1];
+	}
+
+	for (int32 c = 0; c < NumCells; ++c)
+	{
+		CellStart[c + 1] += CellStart[c];
+	}
+
+	CellEntries.SetNumUninitialized(Sources.Num());
+	TArray<int32, TInlineAllocator<256>> Cursor;
+	Cursor.Append(CellStart.GetData(), NumCells);
+	for (int32 i = 0; i < Sources.Num(); ++i)
+	{
+		CellEntries[Cursor[EntryCell[i]]++] = i;
+	}
+}
+
+FIntVector UEMFSourceIndexSubsystem::CellCoord(const FVector& Position) const
+{
+	// Clamped, so queries reaching past the populated area just stop at its edge
+	const FVector Local = (Position - GridOrigin) / CellSize;
+	return FIntVector(
+		FMath::Clamp(FMath::FloorToInt(Local.X), 0, GridDims.X - 1),
+		FMath::Clamp(FMath::FloorToInt(Local.Y), 0, GridDims.Y - 1),
+		FMath::Clamp(FMath::FloorToInt(Local.Z), 0, GridDims.Z - 1));
+}
+
+int32 UEMFSourceIndexSubsystem::FindIndexByDescription(const FEMSourceDescription& Desc) const
+{
+	const int32* Found = PositionToIndex.Find(Desc.Position);
+	if (Found && EMFSourceIndex::SameSource(Sources[*Found], Desc))
+	{
+		return *Found;
+	}
+	return INDEX_NONE;
+}
@@ -0,0 +1,159 @@
+// EMFSourceIndexSubsystem.h
+// World-level spatial index over every registered EMF source, rebuilt once per frame
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EMF_PluginBPLibrary.h"
+#include "EMFChargeOctree.h"
+#include "EMFSourceIndexSubsystem.generated.h"
+
+class UEMF_FieldComponent;
+struct FEMFBakedField;
+
+/**
+ * Answers "which EMF sources are within R of P" without every receiver walking the whole registry.
+ *
+ * Receivers used to call UEMF_FieldComponent::GetAllOtherSources() every tick, which copies the
+ * entire registry, and then distance-cull it themselves. With N charged actors that is N copies of
+ * N sources a frame. Here the registry is copied ONCE per frame, on the first query of the frame,
+ * and binned into a uniform grid; each receiver then only touches the cells its radius overlaps.
+ *
+ * The snapshot is taken from the registry itself (through whichever component asks first), so what
+ * it contains is exactly what GetAllOtherSources would have returned. Sources that move later in the
+ * same frame are seen where they were at the start of it.
+ *
+ * Self-exclusion: the registry hands out descriptions, not owners, so components that want to be
+ * recognised in the snapshot (everything that both emits and receives) register here. At rebuild
+ * each registered component's description is matched to its entry, and a query on its behalf skips it.
+ *
+ * EMF.SourceIndex.Mode switches between this and the old brute-force path, and 2 runs both and
+ * reports any disagreement, which is how the index is checked against the reference.
+ *
+ * Static field bakes: each entry also records which AEMFStaticFieldVolume grids hold it. A query from
+ * inside a baked volume leaves those entries out and hands back the grid instead.
+ *
+ * Barnes-Hut (EMF.BarnesHut.Enable): moving point charges also go into an FEMFChargeOctree, and a
+ * query replaces distant clusters of them with one aggregate charge each.
+ *
+ * Both approximations are indexed mode only and opt-in per query; brute force and validate stay exact.
+ */
+UCLASS()
+class POLARITY_API UEMFSourceIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// ==================== Registration ====================
+
+	/** Make this component identifiable in the snapshot. Call from BeginPlay of anything that
+	 *  queries on its own behalf while also being a source, and for any source that moves (LOS
+	 *  cache entries are keyed on the id, and an unregistered source's id follows its position). */
+	void RegisterFieldComponent(UEMF_FieldComponent* Component);
+
+	void UnregisterFieldComponent(UEMF_FieldComponent* Component);
+
+	// ==================== Queries ====================
+
+	/**
+	 * The one entry point receivers use. Fills OutSources with every source within Radius of Center,
+	 * excluding Self, honouring EMF.SourceIndex.Mode.
+	 *
+	 * In brute-force mode the registry copy lands in BruteForceStorage and OutSources points into it
+	 * (validate mode copies the snapshot instead); in indexed mode OutSources points into the
+	 * snapshot. Either way the pointers are good until the end of the frame, and BruteForceStorage
+	 * must outlive them.
+	 *
+	 * Passing OutBakedField opts in to approximate gathers (callers without LOS shielding):
+	 *  - if Center is in a baked static field volume, the sources that grid stands in for are left
+	 *    out and it is returned there; the caller must add its field. Otherwise it is set to null.
+	 *  - with Barnes-Hut on, distant clusters of moving charges come back as aggregate point charges,
+	 *    stored in BruteForceStorage.
+	 */
+	static void GatherSources(UEMF_FieldComponent* Self, const FVector& Center, float Radius,
+		TArray<FEMSourceDescription>& BruteForceStorage, TArray<const FEMSourceDescription*>& OutSources,
+		const FEMFBakedField** OutBakedField = nullptr);
+
+	/** True when EMF.SourceIndex.Mode routes queries through the grid (1 or 2). */
+	static bool IsIndexEnabled();
+
+	/** Does the registry hold any source besides Self, at any distance? Read from this frame's
+	 *  snapshot when the index is on, so it costs nothing once the snapshot exists. */
+	static bool HasOtherSources(UEMF_FieldComponent* Self);
+
+	/** Bring the snapshot up to date for this frame. Anchor is the component whose registry view is
+	 *  copied; any registered component will do. */
+	void EnsureUpToDate(UEMF_FieldComponent* Anchor);
+
+	/** Indices of snapshot entries within Radius of Center, skipping ExcludeIndex (INDEX_NONE for none). */
+	void QuerySphere(const FVector& Center, float Radius, int32 ExcludeIndex, TArray<int32>& OutIndices) const;
+
+	/** Snapshot entry for a registered component, or INDEX_NONE if it is not in the registry this frame. */
+	int32 FindIndexOf(const UEMF_FieldComponent* Component) const;
+
+	int32 GetNumSources() const { return Sources.Num(); }
+	const FEMSourceDescription& GetSource(int32 Index) const { return Sources[Index]; }
+
+	/** Stable identity of a snapshot entry across frames. A registered component keeps its id for life;
+	 *  anything else is identified by its type and quantized position. */
+	uint32 GetSourceId(int32 Index) const { return SourceIds[Index]; }
+
+	/** Stable identity of any description: a pointer into the snapshot resolves directly, anything
+	 *  else (a brute-force copy) is matched by position and type, or hashed if it is not in the snapshot. */
+	uint32 GetSourceIdFor(const FEMSourceDescription& Source) const;
+
+	/** GetSourceIdFor through the world's index when there is one, the position hash when there is not. */
+	static uint32 GetSourceIdFor(const UWorld* World, const FEMSourceDescription& Source);
+
+private:
+	void Rebuild(UEMF_FieldComponent* Anchor);
+	void BuildGrid();
+
+	/** Visit every snapshot entry within Radius of Center except ExcludeIndex */
+	template <typename FuncType>
+	void ForEachInSphere(const FVector& Center, float Radius, int32 ExcludeIndex, FuncType&& Func) const;
+
+	FIntVector CellCoord(const FVector& Position) const;
+	int32 CellIndex(int32 X, int32 Y, int32 Z) const { return X + GridDims.X * (Y + GridDims.Y * Z); }
+
+	/** Match a live description to its snapshot entry (exact position and type). */
+	int32 FindIndexByDescription(const FEMSourceDescription& Desc) const;
+
+	/** Frame the snapshot was built on. */
+	uint64 BuiltFrame = MAX_uint64;
+
+	/** Registry copy for this frame. */
+	TArray<FEMSourceDescription> Sources;
+	TArray<uint32> SourceIds;
+
+	/** Components that asked to be recognised, and where they landed this frame. */
+	TArray<TWeakObjectPtr<UEMF_FieldComponent>> RegisteredComponents;
+	TMap<const UEMF_FieldComponent*, int32> ComponentToIndex;
+	TMap<FVector, int32> PositionToIndex;
+
+	/** Per entry, the static field volumes whose grid holds it (empty when nothing is baked) */
+	TArray<uint32> EntryBakedMask;
+
+	/** Static field generation the masks were built against */
+	uint32 BakeGeneration = 0;
+
+	/** Moving point charges for Barnes-Hut; only consulted while bChargeTreeActive */
+	FEMFChargeOctree ChargeTree;
+	bool bChargeTreeActive = false;
+
+	// ==================== Grid ====================
+	// Counting-sorted: entries of cell C are CellEntries[CellStart[C] .. CellStart[C + 1]).
+
+	FVector GridOrigin = FVector::ZeroVector;
+	float CellSize = 1000.0f;
+	FIntVector GridDims = FIntVector(1, 1, 1);
+	TArray<int32> CellStart;
+	TArray<int32> CellEntries;
+	TArray<int32> EntryCell;
+};
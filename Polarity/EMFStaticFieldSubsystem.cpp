@@ -0,0 +1,224 @@
+// EMFStaticFieldSubsystem.cpp
+
+#include "EMFStaticFieldSubsystem.h"
+#include "EMFStaticFieldVolume.h"
+#include "EMFForceKernel.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFStaticFieldEnable(
+	TEXT("EMF.StaticField.Enable"),
+	1,
+	TEXT("1=receivers inside a baked AEMFStaticFieldVolume sample its grid for static sources, 0=every source evaluated exactly"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFStaticFieldReportCmd(
+	TEXT("EMF.StaticField.Report"),
+	TEXT("Print every static field volume's grid size, baked sources and bake time"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		for (TActorIterator<AEMFStaticFieldVolume> It(World); It; ++It)
+		{
+			It->ReportStats();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GEMFStaticFieldRebakeCmd(
+	TEXT("EMF.StaticField.Rebake"),
+	TEXT("Bake every static field volume again from the current sources"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		for (TActorIterator<AEMFStaticFieldVolume> It(World); It; ++It)
+		{
+			It->Bake();
+		}
+	}));
+
+// ==================== Baked Field ====================
+
+void FEMFBakedField::Reset()
+{
+	Dims = FIntVector::ZeroValue;
+	E.Reset();
+	B.Reset();
+	Unsafe.Reset();
+	bValid = false;
+}
+
+FIntVector FEMFBakedField::LocateCell(const FVector& Position, FVector& OutFraction) const
+{
+	const FVector Local = (Position - Origin) / CellSize;
+	const FIntVector Cell(
+		FMath::Clamp(FMath::FloorToInt(Local.X), 0, Dims.X - 2),
+		FMath::Clamp(FMath::FloorToInt(Local.Y), 0, Dims.Y - 2),
+		FMath::Clamp(FMath::FloorToInt(Local.Z), 0, Dims.Z - 2));
+
+	OutFraction = FVector(
+		FMath::Clamp(Local.X - Cell.X, 0.0, 1.0),
+		FMath::Clamp(Local.Y - Cell.Y, 0.0, 1.0),
+		FMath::Clamp(Local.Z - Cell.Z, 0.0, 1.0));
+	return Cell;
+}
+
+bool FEMFBakedField::CanSampleAt(const FVector& Position) const
+{
+	if (!bValid)
+	{
+		return false;
+	}
+
+	const FVector Local = (Position - Origin) / CellSize;
+	if (Local.X < 0.0 || Local.Y < 0.0 || Local.Z < 0.0
+		|| Local.X > Dims.X - 1 || Local.Y > Dims.Y - 1 || Local.Z > Dims.Z - 1)
+	{
+		return false;
+	}
+
+	FVector Fraction;
+	const FIntVector Cell = LocateCell(Position, Fraction);
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		if (Unsafe[NodeIndex(Cell.X + (Corner & 1), Cell.Y + ((Corner >> 1) & 1), Cell.Z + ((Corner >> 2) & 1))])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FEMFBakedField::Sample(const FVector& Position, FVector& OutE, FVector& OutB) const
+{
+	FVector F;
+	const FIntVector C = LocateCell(Position, F);
+
+	FVector3f SumE = FVector3f::ZeroVector;
+	FVector3f SumB = FVector3f::ZeroVector;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const int32 DX = Corner & 1;
+		const int32 DY = (Corner >> 1) & 1;
+		const int32 DZ = (Corner >> 2) & 1;
+		const float Weight = static_cast<float>(
+			(DX ? F.X : 1.0 - F.X) * (DY ? F.Y : 1.0 - F.Y) * (DZ ? F.Z : 1.0 - F.Z));
+
+		const int32 Node = NodeIndex(C.X + DX, C.Y + DY, C.Z + DZ);
+		SumE += E[Node] * Weight;
+		SumB += B[Node] * Weight;
+	}
+
+	OutE = FVector(SumE);
+	OutB = FVector(SumB);
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UEMFStaticFieldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UEMFStaticFieldSubsystem::Deinitialize()
+{
+	Volumes.Empty();
+	BakedMasks.Empty();
+
+	Super::Deinitialize();
+}
+
+// ==================== Registration ====================
+
+int32 UEMFStaticFieldSubsystem::RegisterVolume(AEMFStaticFieldVolume* Volume)
+{
+	if (!Volume)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 i = 0; i < Volumes.Num(); ++i)
+	{
+		if (!Volumes[i].IsValid())
+		{
+			Volumes[i] = Volume;
+			return i;
+		}
+	}
+
+	if (Volumes.Num() >= MaxVolumes)
+	{
+		return INDEX_NONE;
+	}
+	return Volumes.Add(Volume);
+}
+
+void UEMFStaticFieldSubsystem::UnregisterVolume(AEMFStaticFieldVolume* Volume)
+{
+	const int32 Index = Volumes.IndexOfByKey(Volume);
+	if (Index != INDEX_NONE)
+	{
+		// Keep the slot numbering of everyone else
+		Volumes[Index] = nullptr;
+		NotifyBakeChanged();
+	}
+}
+
+void UEMFStaticFieldSubsystem::NotifyBakeChanged()
+{
+	BakedMasks.Reset();
+	for (int32 i = 0; i < Volumes.Num(); ++i)
+	{
+		const AEMFStaticFieldVolume* Volume = Volumes[i].Get();
+		if (!Volume || !Volume->IsBaked())
+		{
+			continue;
+		}
+
+		for (const FEMSourceDescription& Source : Volume->GetBakedSources())
+		{
+			BakedMasks.FindOrAdd(Source.Position) |= (1u << i);
+		}
+	}
+
+	++Generation;
+}
+
+// ==================== Queries ====================
+
+const FEMFBakedField* UEMFStaticFieldSubsystem::FindFieldAt(const FVector& Position, uint32& OutBit) const
+{
+	OutBit = 0;
+	if (BakedMasks.Num() == 0 || CVarEMFStaticFieldEnable.GetValueOnAnyThread() == 0)
+	{
+		return nullptr;
+	}
+
+	// First volume that can serve the point; overlapping volumes each hold their own sources
+	for (int32 i = 0; i < Volumes.Num(); ++i)
+	{
+		const AEMFStaticFieldVolume* Volume = Volumes[i].Get();
+		if (Volume && Volume->GetField().CanSampleAt(Position))
+		{
+			OutBit = 1u << i;
+			return &Volume->GetField();
+		}
+	}
+	return nullptr;
+}
+
+uint32 UEMFStaticFieldSubsystem::GetBakedMask(const FEMSourceDescription& Source) const
+{
+	const uint32* Mask = BakedMasks.Find(Source.Position);
+	return (Mask && IsBakeableSource(Source)) ? *Mask : 0;
+}
+
+bool UEMFStaticFieldSubsystem::IsBakeableSource(const FEMSourceDescription& Source)
+{
+	return Source.bIsStatic
+		&& Source.OwnerType == EEMSourceOwnerType::Environment
+		&& !FEMFForceKernel::IsPassiveSource(Source)
+		&& !FEMFForceKernel::IsSourceEffectivelyZero(Source);
+}
@@ -0,0 +1,117 @@
+// EMFStaticFieldSubsystem.h
+// Baked E/B grids for static environment sources, and which sources each grid stands in for
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EMF_PluginBPLibrary.h"
+#include "EMFStaticFieldSubsystem.generated.h"
+
+class AEMFStaticFieldVolume;
+
+/**
+ * Summed E and B of a set of sources on a regular grid of nodes, sampled trilinearly.
+ *
+ * The plugin's force is linear in charge and velocity (F = q(E + v x B)), so the fields are
+ * recovered from three force evaluations per node on a unit test charge: at rest for E, and moving
+ * along X and Y for the components of B. Sampling gives back exactly what the plugin would have
+ * computed at the nodes; in between, the trilinear error is what the cell size buys.
+ *
+ * Close to a baked source (a charge, or the face of a plate) the field is far too steep for any
+ * grid. Nodes near one are marked unsafe, and a receiver in a cell touching an unsafe node does not
+ * use the grid at all: it gets the sources themselves, and with them the usual close-range cutoff.
+ *
+ * Read-only once baked, so the solver's worker threads can sample it freely.
+ */
+struct POLARITY_API FEMFBakedField
+{
+	FVector Origin = FVector::ZeroVector;
+	float CellSize = 100.0f;
+
+	/** Nodes per axis (cells + 1) */
+	FIntVector Dims = FIntVector::ZeroValue;
+
+	TArray<FVector3f> E;
+	TArray<FVector3f> B;
+
+	/** Nonzero for nodes too close to a baked source to interpolate across */
+	TArray<uint8> Unsafe;
+
+	bool bValid = false;
+
+	void Reset();
+
+	int32 NodeIndex(int32 X, int32 Y, int32 Z) const { return X + Dims.X * (Y + Dims.Y * Z); }
+	int32 NumNodes() const { return Dims.X * Dims.Y * Dims.Z; }
+
+	/** Inside the grid and in a cell whose corners are all safe */
+	bool CanSampleAt(const FVector& Position) const;
+
+	/** Trilinear E and B at Position, clamped to the grid */
+	void Sample(const FVector& Position, FVector& OutE, FVector& OutB) const;
+
+private:
+	/** Cell containing Position (clamped) and the fractional position inside it */
+	FIntVector LocateCell(const FVector& Position, FVector& OutFraction) const;
+};
+
+/**
+ * Registry of AEMFStaticFieldVolume bakes for the source index and the force kernel.
+ *
+ * The source index asks, per snapshot entry, which volumes baked that source; a receiver standing in
+ * a volume then skips exactly those sources while gathering and adds the volume's grid instead.
+ * Everything else, dynamic sources and static ones outside or unsafe, is still evaluated exactly.
+ *
+ * Generation changes whenever any bake appears or goes away, so the index can tell that the
+ * per-entry masks it built this frame no longer match the grids and fall back to exact sources.
+ */
+UCLASS()
+class POLARITY_API UEMFStaticFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** One bit per volume in a source's baked mask */
+	static constexpr int32 MaxVolumes = 32;
+
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// ==================== Registration ====================
+
+	/** Volume slot, or INDEX_NONE if all MaxVolumes slots are taken */
+	int32 RegisterVolume(AEMFStaticFieldVolume* Volume);
+	void UnregisterVolume(AEMFStaticFieldVolume* Volume);
+
+	/** A volume's bake became valid or invalid; rebuilds the baked-source lookup */
+	void NotifyBakeChanged();
+
+	// ==================== Queries ====================
+
+	/** Grid usable at Position and the bit of its volume, or null (OutBit 0) if there is none */
+	const FEMFBakedField* FindFieldAt(const FVector& Position, uint32& OutBit) const;
+
+	/** Volumes that baked this source, one bit per slot */
+	uint32 GetBakedMask(const FEMSourceDescription& Source) const;
+
+	/** Changes whenever a bake appears or goes away */
+	uint32 GetGeneration() const { return Generation; }
+
+	/** True if any volume currently has a valid bake (lets the index skip the mask pass) */
+	bool HasAnyBake() const { return BakedMasks.Num() > 0; }
+
+	/** Sources that belong in a bake: static, environment-owned and not passive */
+	static bool IsBakeableSource(const FEMSourceDescription& Source);
+
+private:
+	/** Slot = bit index */
+	TArray<TWeakObjectPtr<AEMFStaticFieldVolume>> Volumes;
+
+	/** Baked source position -> mask of volumes holding it */
+	TMap<FVector, uint32> BakedMasks;
+
+	uint32 Generation = 0;
+};
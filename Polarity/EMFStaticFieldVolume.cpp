@@ -0,0 +1,372 @@
+// EMFStaticFieldVolume.cpp
+
+#include "EMFStaticFieldVolume.h"
+#include "EMFStaticFieldSubsystem.h"
+#include "EMFStats.h"
+#include "EMFLog.h"
+#include "EMF_FieldComponent.h"
+#include "EMF_PluginBPLibrary.h"
+#include "Components/BoxComponent.h"
+#include "Async/ParallelFor.h"
+#include "UObject/UObjectIterator.h"
+
+namespace EMFStaticField
+{
+	/** Test speed for recovering B from the velocity term; large enough to dwarf float noise in E */
+	static constexpr float ProbeSpeed = 1000.0f;
+
+	/** Relative change in a fingerprint entry that counts as the source having changed */
+	static constexpr float FingerprintTolerance = 1.0e-3f;
+
+	/** Distance from Position to the source for the unsafe-node test: to the surface for plates, to the centre otherwise */
+	static float DistanceToSource(const FEMSourceDescription& Source, const FVector& Position)
+	{
+		const FVector Offset = Position - Source.Position;
+
+		switch (Source.SourceType)
+		{
+		case EEMSourceType::InfinitePlate:
+		case EEMSourceType::FinitePlate:
+		case EEMSourceType::AcceleratorPlate:
+		{
+			const FVector Normal = Source.PlateParams.Normal.GetSafeNormal();
+			if (Normal.IsNearlyZero())
+			{
+				return Offset.Size();
+			}
+
+			const float Across = FMath::Abs(FVector::DotProduct(Offset, Normal));
+			if (Source.SourceType == EEMSourceType::InfinitePlate || Source.PlateParams.bIsInfinite)
+			{
+				return Across;
+			}
+
+			// In-plane orientation is the plugin's business; treat the plate as a disc covering its corners
+			const float HalfDiagonal = 0.5f * Source.PlateParams.Dimensions.Size();
+			const float Along = FMath::Max((Offset - Normal * FVector::DotProduct(Offset, Normal)).Size() - HalfDiagonal, 0.0f);
+			return FMath::Sqrt(Across * Across + Along * Along);
+		}
+
+		default:
+			return Offset.Size();
+		}
+	}
+
+	/** Canonical order, so the fingerprint does not change when the registry reorders */
+	static bool SourceLess(const FEMSourceDescription& A, const FEMSourceDescription& B)
+	{
+		if (A.Position.X != B.Position.X) { return A.Position.X < B.Position.X; }
+		if (A.Position.Y != B.Position.Y) { return A.Position.Y < B.Position.Y; }
+		if (A.Position.Z != B.Position.Z) { return A.Position.Z < B.Position.Z; }
+		return A.SourceType < B.SourceType;
+	}
+}
+
+AEMFStaticFieldVolume::AEMFStaticFieldVolume()
+{
+	// Only the periodic source check ticks; sampling is driven by the receivers
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickInterval = 1.0f;
+
+	Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+	Bounds->SetBoxExtent(FVector(2000.0f, 2000.0f, 500.0f));
+	Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Bounds->SetCanEverAffectNavigation(false);
+	RootComponent = Bounds;
+}
+
+// ==================== Lifecycle ====================
+
+void AEMFStaticFieldVolume::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UEMFStaticFieldSubsystem* StaticFields = GetWorld()->GetSubsystem<UEMFStaticFieldSubsystem>())
+	{
+		Slot = StaticFields->RegisterVolume(this);
+		if (Slot == INDEX_NONE)
+		{
+			UE_LOG(LogEMF, Warning, TEXT("[EMF_STATIC] %s: more than %d static field volumes, this one stays unbaked"),
+				*GetName(), UEMFStaticFieldSubsystem::MaxVolumes);
+		}
+	}
+
+	bPendingInitialBake = true;
+}
+
+void AEMFStaticFieldVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Field.Reset();
+
+	if (UEMFStaticFieldSubsystem* StaticFields = GetWorld()->GetSubsystem<UEMFStaticFieldSubsystem>())
+	{
+		StaticFields->UnregisterVolume(this);
+	}
+	Slot = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AEMFStaticFieldVolume::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (bPendingInitialBake)
+	{
+		bPendingInitialBake = false;
+		Bake();
+		LastFingerprint = BakedFingerprint;
+		LastChangeTime = GetWorld()->GetTimeSeconds();
+		return;
+	}
+
+	CollectSources(LiveSources);
+	ComputeFingerprint(LiveSources, LiveFingerprint);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (!FingerprintsMatch(LiveFingerprint, LastFingerprint))
+	{
+		LastFingerprint = LiveFingerprint;
+		LastChangeTime = Now;
+	}
+
+	if (Field.bValid)
+	{
+		// Any difference from what was baked, and the grid is wrong: drop it now, rebake once things settle
+		if (!FingerprintsMatch(LiveFingerprint, BakedFingerprint))
+		{
+			EMF_LOG(Log, TEXT("[EMF_STATIC] %s: static sources changed, bake dropped"), *GetName());
+			InvalidateBake();
+		}
+		return;
+	}
+
+	if (LiveSources.Num() > 0 && Now - LastChangeTime >= RebakeDelay)
+	{
+		Bake();
+	}
+}
+
+// ==================== Bake ====================
+
+void AEMFStaticFieldVolume::Bake()
+{
+	SCOPE_CYCLE_COUNTER(STAT_EMF_StaticFieldBake);
+	const double StartTime = FPlatformTime::Seconds();
+
+	Field.Reset();
+	CollectSources(BakedSources);
+	ComputeFingerprint(BakedSources, BakedFingerprint);
+
+	if (BakedSources.Num() == 0 || !Bounds)
+	{
+		BakedSources.Reset();
+		if (UEMFStaticFieldSubsystem* StaticFields = GetWorld()->GetSubsystem<UEMFStaticFieldSubsystem>())
+		{
+			StaticFields->NotifyBakeChanged();
+		}
+		return;
+	}
+
+	// Grid over the box, coarsened until it fits the node budget
+	const FBox Box = Bounds->Bounds.GetBox();
+	const FVector Size = Box.GetSize();
+	float Cell = CellSize;
+	FIntVector Dims;
+	for (;;)
+	{
+		Dims = FIntVector(
+			FMath::Max(FMath::CeilToInt(Size.X / Cell), 1) + 1,
+			FMath::Max(FMath::CeilToInt(Size.Y / Cell), 1) + 1,
+			FMath::Max(FMath::CeilToInt(Size.Z / Cell), 1) + 1);
+		if (static_cast<int64>(Dims.X) * Dims.Y * Dims.Z <= MaxNodes)
+		{
+			break;
+		}
+		Cell *= 1.25f;
+	}
+
+	Field.Origin = Box.Min;
+	Field.CellSize = Cell;
+	Field.Dims = Dims;
+
+	const int32 NumNodes = Field.NumNodes();
+	Field.E.SetNumUninitialized(NumNodes);
+	Field.B.SetNumUninitialized(NumNodes);
+	Field.Unsafe.SetNumZeroed(NumNodes);
+
+	// Three plugin calls per node on a unit charge; the plugin is pure, so slices run in parallel
+	const TArray<FEMSourceDescription>& Sources = BakedSources;
+	const float Radius = UnsafeRadius;
+	FEMFBakedField& Out = Field;
+	ParallelFor(Dims.Z, [&Out, &Sources, Radius, Dims](int32 Z)
+	{
+		const FVector VX(EMFStaticField::ProbeSpeed, 0.0f, 0.0f);
+		const FVector VY(0.0f, EMFStaticField::ProbeSpeed, 0.0f);
+
+		for (int32 Y = 0; Y < Dims.Y; ++Y)
+		{
+			for (int32 X = 0; X < Dims.X; ++X)
+			{
+				const int32 Node = Out.NodeIndex(X, Y, Z);
+				const FVector Position = Out.Origin + FVector(X, Y, Z) * Out.CellSize;
+
+				for (const FEMSourceDescription& Source : Sources)
+				{
+					if (EMFStaticField::DistanceToSource(Source, Position) < Radius)
+					{
+						Out.Unsafe[Node] = 1;
+						break;
+					}
+				}
+
+				const FVector E = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(1.0f, Position, FVector::ZeroVector, Sources, true);
+				const FVector FX = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(1.0f, Position, VX, Sources, true) - E;
+				const FVector FY = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(1.0f, Position, VY, Sources, true) - E;
+
+				// v x B with v along X gives (0, -Bz, By); along Y gives (Bz, 0, -Bx)
+				const FVector B(
+					-FY.Z / EMFStaticField::ProbeSpeed,
+					FX.Z / EMFStaticField::ProbeSpeed,
+					-FX.Y / EMFStaticField::ProbeSpeed);
+
+				Out.E[Node] = FVector3f(E);
+				Out.B[Node] = FVector3f(B);
+			}
+		}
+	});
+
+	Field.bValid = true;
+	LastBakeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	if (UEMFStaticFieldSubsystem* StaticFields = GetWorld()->GetSubsystem<UEMFStaticFieldSubsystem>())
+	{
+		StaticFields->NotifyBakeChanged();
+	}
+
+	UE_LOG(LogEMF, Log, TEXT("[EMF_STATIC] %s: baked %d sources into %dx%dx%d nodes (%.0f cm cells) in %.1f ms"),
+		*GetName(), BakedSources.Num(), Dims.X, Dims.Y, Dims.Z, Cell, LastBakeSeconds * 1000.0);
+}
+
+void AEMFStaticFieldVolume::InvalidateBake()
+{
+	if (!Field.bValid)
+	{
+		return;
+	}
+
+	Field.Reset();
+	BakedSources.Reset();
+	BakedFingerprint.Reset();
+
+	if (UEMFStaticFieldSubsystem* StaticFields = GetWorld()->GetSubsystem<UEMFStaticFieldSubsystem>())
+	{
+		StaticFields->NotifyBakeChanged();
+	}
+}
+
+// ==================== Source Tracking ====================
+
+void AEMFStaticFieldVolume::CollectSources(TArray<FEMSourceDescription>& OutSources) const
+{
+	OutSources.Reset();
+
+	// The registry only hands out "everything but me" views, so borrow any field component in this world
+	UWorld* World = GetWorld();
+	UEMF_FieldComponent* Anchor = nullptr;
+	for (TObjectIterator<UEMF_FieldComponent> It; It; ++It)
+	{
+		if (It->GetWorld() == World && IsValid(*It))
+		{
+			Anchor = *It;
+			break;
+		}
+	}
+	if (!Anchor || !Bounds)
+	{
+		return;
+	}
+
+	TArray<FEMSourceDescription> Registry = Anchor->GetAllOtherSources();
+	if (Anchor->IsRegistered())
+	{
+		Registry.Add(Anchor->GetSourceDescription());
+	}
+
+	const FBox Reach = Bounds->Bounds.GetBox().ExpandBy(SourceMargin);
+	for (const FEMSourceDescription& Source : Registry)
+	{
+		if (UEMFStaticFieldSubsystem::IsBakeableSource(Source) && Reach.IsInsideOrOn(Source.Position))
+		{
+			OutSources.Add(Source);
+		}
+	}
+
+	OutSources.Sort(&EMFStaticField::SourceLess);
+}
+
+void AEMFStaticFieldVolume::ComputeFingerprint(const TArray<FEMSourceDescription>& InSources, TArray<FVector4>& OutFingerprint) const
+{
+	OutFingerprint.Reset(InSources.Num() * 2);
+
+	// Where each source is, and what it does to a resting unit charge at the box corner: catches
+	// moves and every change of strength or orientation the plugin would notice
+	const FVector Probe = Bounds ? Bounds->Bounds.GetBox().Min : GetActorLocation();
+	TArray<FEMSourceDescription> Single;
+	for (const FEMSourceDescription& Source : InSources)
+	{
+		Single.Reset();
+		Single.Add(Source);
+		const FVector Force = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(1.0f, Probe, FVector::ZeroVector, Single, true);
+
+		OutFingerprint.Add(FVector4(Source.Position, static_cast<double>(Source.SourceType)));
+		OutFingerprint.Add(FVector4(Force, 0.0));
+	}
+}
+
+bool AEMFStaticFieldVolume::FingerprintsMatch(const TArray<FVector4>& A, const TArray<FVector4>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < A.Num(); ++i)
+	{
+		const double Scale = FMath::Max(FMath::Max(FVector(A[i]).Size(), FVector(B[i]).Size()), 1.0e-6);
+		if (FVector(A[i] - B[i]).Size() > EMFStaticField::FingerprintTolerance * Scale || A[i].W != B[i].W)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// ==================== Diagnostics ====================
+
+void AEMFStaticFieldVolume::ReportStats() const
+{
+	if (!Field.bValid)
+	{
+		UE_LOG(LogEMF, Log, TEXT("[EMF_STATIC] %s (slot %d): not baked"), *GetName(), Slot);
+		return;
+	}
+
+	int32 NumUnsafe = 0;
+	for (const uint8 Flag : Field.Unsafe)
+	{
+		NumUnsafe += Flag;
+	}
+
+	const int32 NumNodes = Field.NumNodes();
+	UE_LOG(LogEMF, Log, TEXT("[EMF_STATIC] %s (slot %d): %d sources, %dx%dx%d nodes (%.0f cm), %d unsafe (%.1f%%), %.1f KB, baked in %.1f ms"),
+		*GetName(), Slot, BakedSources.Num(), Field.Dims.X, Field.Dims.Y, Field.Dims.Z, Field.CellSize,
+		NumUnsafe, NumNodes > 0 ? 100.0f * NumUnsafe / NumNodes : 0.0f,
+		(Field.E.GetAllocatedSize() + Field.B.GetAllocatedSize() + Field.Unsafe.GetAllocatedSize()) / 1024.0f,
+		LastBakeSeconds * 1000.0);
+}
@@ -0,0 +1,116 @@
+// EMFStaticFieldVolume.h
+// Arena volume that bakes the field of its static EMF sources into a grid
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "EMFStaticFieldSubsystem.h"
+#include "EMFStaticFieldVolume.generated.h"
+
+class UBoxComponent;
+class UEMF_FieldComponent;
+
+/**
+ * Place one around an environment-heavy arena. At level load it bakes the summed E and B of every
+ * static environment source (bIsStatic, Environment-owned: accelerator plates, level-placed
+ * charges) into a grid covering the box, and receivers inside then pay a few lookups for all of
+ * them instead of evaluating each one every frame. Dynamic sources are unaffected.
+ *
+ * The bake is checked about once a second against the live sources. If one moves, changes strength,
+ * or disappears (a plate switched off or picked up), the grid is dropped at once and receivers go
+ * back to exact evaluation; once the sources have held still for RebakeDelay, it bakes again.
+ *
+ * Runtime-spawned sources such as AEMFStaticCharge are player-owned and never baked.
+ */
+UCLASS(Blueprintable)
+class POLARITY_API AEMFStaticFieldVolume : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AEMFStaticFieldVolume();
+
+	// ==================== Components ====================
+
+	/** Region the grid covers */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UBoxComponent> Bounds;
+
+	// ==================== Bake Settings ====================
+
+	/** Grid spacing. Smaller is more accurate near plates and costs memory (two vectors per node) and bake time. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Bake", meta = (ClampMin = "25.0", ClampMax = "1000.0", Units = "cm"))
+	float CellSize = 100.0f;
+
+	/** Static sources this far outside the box still go into the bake */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Bake", meta = (ClampMin = "0.0", Units = "cm"))
+	float SourceMargin = 10000.0f;
+
+	/** Nodes closer than this to a baked source are not interpolated across (exact evaluation there) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Bake", meta = (ClampMin = "0.0", Units = "cm"))
+	float UnsafeRadius = 150.0f;
+
+	/** Upper bound on grid nodes; the cell size grows to fit */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Bake", meta = (ClampMin = "8"))
+	int32 MaxNodes = 262144;
+
+	/** Seconds the static sources must hold still before a dropped grid is baked again */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Bake", meta = (ClampMin = "0.0", Units = "s"))
+	float RebakeDelay = 2.0f;
+
+	// ==================== API ====================
+
+	/** Bake now from the sources currently in the world */
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "EMF|Bake")
+	void Bake();
+
+	/** Drop the grid; receivers go back to exact evaluation */
+	UFUNCTION(BlueprintCallable, Category = "EMF|Bake")
+	void InvalidateBake();
+
+	UFUNCTION(BlueprintPure, Category = "EMF|Bake")
+	bool IsBaked() const { return Field.bValid; }
+
+	const FEMFBakedField& GetField() const { return Field; }
+	const TArray<FEMSourceDescription>& GetBakedSources() const { return BakedSources; }
+	int32 GetSlot() const { return Slot; }
+
+	/** Print grid size, source count and last bake time */
+	void ReportStats() const;
+
+	// ==================== AActor Overrides ====================
+
+	virtual void Tick(float DeltaTime) override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** Static sources relevant to this volume, live */
+	void CollectSources(TArray<FEMSourceDescription>& OutSources) const;
+
+	/** Cheap signature of a source set: position and field at a probe point, per source */
+	void ComputeFingerprint(const TArray<FEMSourceDescription>& InSources, TArray<FVector4>& OutFingerprint) const;
+
+	static bool FingerprintsMatch(const TArray<FVector4>& A, const TArray<FVector4>& B);
+
+	FEMFBakedField Field;
+	TArray<FEMSourceDescription> BakedSources;
+	TArray<FVector4> BakedFingerprint;
+
+	/** What the sources looked like at the last check, and when they last changed */
+	TArray<FVector4> LastFingerprint;
+	double LastChangeTime = 0.0;
+
+	/** First check bakes straight away: everything placed in the level has begun play by then */
+	bool bPendingInitialBake = true;
+
+	int32 Slot = INDEX_NONE;
+	double LastBakeSeconds = 0.0;
+
+	/** Scratch for the periodic check */
+	TArray<FEMSourceDescription> LiveSources;
+	TArray<FVector4> LiveFingerprint;
+};
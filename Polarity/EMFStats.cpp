@@ -0,0 +1,44 @@
+// EMFStats.cpp
+
+#include "EMFStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(POLARITY_API, EMF, true);
+
+DEFINE_STAT(STAT_EMF_SourceIndexRebuild);
+DEFINE_STAT(STAT_EMF_SourceIndexQuery);
+DEFINE_STAT(STAT_EMF_IndexedSources);
+DEFINE_STAT(STAT_EMF_SourcesGathered);
+DEFINE_STAT(STAT_EMF_IndexMismatches);
+DEFINE_STAT(STAT_EMF_ForceKernel);
+DEFINE_STAT(STAT_EMF_PluginCalls);
+DEFINE_STAT(STAT_EMF_LOSQueries);
+DEFINE_STAT(STAT_EMF_LOSCacheHits);
+DEFINE_STAT(STAT_EMF_LOSTracesSaved);
+DEFINE_STAT(STAT_EMF_LOSSyncTraces);
+DEFINE_STAT(STAT_EMF_LOSAsyncTraces);
+DEFINE_STAT(STAT_EMF_LOSCacheEntries);
+DEFINE_STAT(STAT_EMF_SolverPrepare);
+DEFINE_STAT(STAT_EMF_SolverSolve);
+DEFINE_STAT(STAT_EMF_SolverReceivers);
+DEFINE_STAT(STAT_EMF_SolverMismatches);
+DEFINE_STAT(STAT_EMF_SubstepIntegrate);
+DEFINE_STAT(STAT_EMF_Substeps);
+DEFINE_STAT(STAT_EMF_LODNear);
+DEFINE_STAT(STAT_EMF_LODMid);
+DEFINE_STAT(STAT_EMF_LODFar);
+DEFINE_STAT(STAT_EMF_LODDormant);
+DEFINE_STAT(STAT_EMF_LODSkipped);
+DEFINE_STAT(STAT_EMF_ReceiverUpdate);
+DEFINE_STAT(STAT_EMF_StaticFieldBake);
+DEFINE_STAT(STAT_EMF_StaticFieldSamples);
+DEFINE_STAT(STAT_EMF_SourcesBakedOut);
+DEFINE_STAT(STAT_EMF_BarnesHutBuild);
+DEFINE_STAT(STAT_EMF_BarnesHutNodes);
+DEFINE_STAT(STAT_EMF_BarnesHutAggregates);
+DEFINE_STAT(STAT_EMF_ExplosionResolve);
+DEFINE_STAT(STAT_EMF_ExplosionTargets);
+DEFINE_STAT(STAT_EMF_ExplosionLOSTraces);
+DEFINE_STAT(STAT_EMF_ExplosionQueueTick);
+DEFINE_STAT(STAT_EMF_ExplosionQueueDepth);
+DEFINE_STAT(STAT_EMF_ExplosionsResolved);
+DEFINE_STAT(STAT_EMF_ExplosionsDeferred);
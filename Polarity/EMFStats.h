@@ -0,0 +1,96 @@
+// EMFStats.h
+// Stat group shared by the EMF force path. "stat EMF" in the console shows all of it.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("EMF"), STATGROUP_EMF, STATCAT_Advanced);
+
+/** CSV profiler category for the same numbers, per frame; what EMF.Benchmark captures */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(POLARITY_API, EMF);
+
+/** Cycle stat STAT_EMF_<Name> plus a CSV timer EMF/<Name>. Game thread only: CSV timers are per thread. */
+#define EMF_SCOPE_CYCLE_COUNTER(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_EMF_##Name); \
+	CSV_SCOPED_TIMING_STAT(EMF, Name)
+
+/** INC_DWORD_STAT on STAT_EMF_<Name> plus a per-frame CSV count EMF/<Name> */
+#define EMF_INC_DWORD_STAT(Name) \
+	INC_DWORD_STAT(STAT_EMF_##Name); \
+	CSV_CUSTOM_STAT(EMF, Name, 1, ECsvCustomStatOp::Accumulate)
+
+// ==================== Source Index ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Source Index Rebuild"), STAT_EMF_SourceIndexRebuild, STATGROUP_EMF, POLARITY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Source Index Query"), STAT_EMF_SourceIndexQuery, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Indexed Sources"), STAT_EMF_IndexedSources, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Sources Gathered"), STAT_EMF_SourcesGathered, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Index Mismatches"), STAT_EMF_IndexMismatches, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Force Kernel ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Force Kernel"), STAT_EMF_ForceKernel, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Plugin Force Calls"), STAT_EMF_PluginCalls, STATGROUP_EMF, POLARITY_API);
+
+// ==================== LOS Cache ====================
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LOS Queries"), STAT_EMF_LOSQueries, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LOS Cache Hits"), STAT_EMF_LOSCacheHits, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LOS Traces Saved"), STAT_EMF_LOSTracesSaved, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LOS Sync Traces"), STAT_EMF_LOSSyncTraces, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LOS Async Traces"), STAT_EMF_LOSAsyncTraces, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOS Cache Entries"), STAT_EMF_LOSCacheEntries, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Solver ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Solver Prepare"), STAT_EMF_SolverPrepare, STATGROUP_EMF, POLARITY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Solver Solve"), STAT_EMF_SolverSolve, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Solver Receivers"), STAT_EMF_SolverReceivers, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Solver Validation Mismatches"), STAT_EMF_SolverMismatches, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Substep Integrator ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Substep Integrate"), STAT_EMF_SubstepIntegrate, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Substeps"), STAT_EMF_Substeps, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Receiver LOD ====================
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOD Near"), STAT_EMF_LODNear, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOD Mid"), STAT_EMF_LODMid, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOD Far"), STAT_EMF_LODFar, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOD Dormant"), STAT_EMF_LODDormant, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LOD Evaluations Skipped"), STAT_EMF_LODSkipped, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Receivers ====================
+
+/** Whole per-receiver update (force, damping, capture, diagnostics); compare with and without EMF diagnostics */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Receiver Update"), STAT_EMF_ReceiverUpdate, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Static Field ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Static Field Bake"), STAT_EMF_StaticFieldBake, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Static Field Samples"), STAT_EMF_StaticFieldSamples, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Sources Baked Out"), STAT_EMF_SourcesBakedOut, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Barnes-Hut ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Barnes-Hut Build"), STAT_EMF_BarnesHutBuild, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Barnes-Hut Nodes"), STAT_EMF_BarnesHutNodes, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Barnes-Hut Aggregates"), STAT_EMF_BarnesHutAggregates, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Explosions ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Explosion Resolve"), STAT_EMF_ExplosionResolve, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Explosion Targets"), STAT_EMF_ExplosionTargets, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Explosion LOS Traces"), STAT_EMF_ExplosionLOSTraces, STATGROUP_EMF, POLARITY_API);
+
+// ==================== Explosion Queue ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Explosion Queue Tick"), STAT_EMF_ExplosionQueueTick, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Explosion Queue Depth"), STAT_EMF_ExplosionQueueDepth, STATGROUP_EMF, POLARITY_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Explosions Resolved"), STAT_EMF_ExplosionsResolved, STATGROUP_EMF, POLARITY_API);
+/** Detonations carried over to a later frame by the budget, summed over frames waited */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Explosions Deferred"), STAT_EMF_ExplosionsDeferred, STATGROUP_EMF, POLARITY_API);
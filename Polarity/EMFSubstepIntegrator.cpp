@@ -0,0 +1,136 @@
+// EMFSubstepIntegrator.cpp
+
+#include "EMFSubstepIntegrator.h"
+#include "EMFForceKernel.h"
+#include "EMFStats.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEMFSubstepMode(
+	TEXT("EMF.Substep.Mode"),
+	1,
+	TEXT("0=EM forces sampled once per frame everywhere, 1=receivers with bUseFixedStepIntegration integrate at EMF.Substep.Rate, 2=every receiver does"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFSubstepRate(
+	TEXT("EMF.Substep.Rate"),
+	120.0f,
+	TEXT("Fixed EM integration rate (Hz)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEMFSubstepMaxSubsteps(
+	TEXT("EMF.Substep.MaxSubsteps"),
+	8,
+	TEXT("Most substeps a receiver runs in one frame; time beyond that is dropped"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEMFSubstepCutoffScale(
+	TEXT("EMF.Substep.CutoffScale"),
+	0.5f,
+	TEXT("Multiplier on a receiver's close-range cutoff while it integrates with substeps"),
+	ECVF_Default);
+
+namespace EMFSubstep
+{
+	/** Sources that survived LOS for the receiver being integrated. Game thread only. */
+	static TArray<const FEMSourceDescription*> VisibleSources;
+}
+
+bool FEMFSubstepIntegrator::IsActiveFor(bool bReceiverOptedIn)
+{
+	const int32 Mode = CVarEMFSubstepMode.GetValueOnGameThread();
+	return Mode >= 2 || (Mode == 1 && bReceiverOptedIn);
+}
+
+int32 FEMFSubstepIntegrator::Integrate(FEMFForceKernel& Kernel, const FEMFForceQuery& Query, float Mass, float MaxForce,
+	float DeltaTime, FEMFSubstepState& State, FEMFForceResult& OutResult)
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_EMF_SubstepIntegrate);
+
+	OutResult.Reset();
+
+	const float Step = 1.0f / FMath::Max(CVarEMFSubstepRate.GetValueOnGameThread(), 1.0f);
+	const int32 MaxSubsteps = FMath::Max(CVarEMFSubstepMaxSubsteps.GetValueOnGameThread(), 1);
+
+	State.Accumulator += FMath::Max(DeltaTime, 0.0f);
+	int32 NumSubsteps = FMath::FloorToInt32(State.Accumulator / Step);
+	if (NumSubsteps > MaxSubsteps)
+	{
+		// Hitch: integrate what the budget allows and forget the rest
+		NumSubsteps = MaxSubsteps;
+		State.Accumulator = 0.0f;
+	}
+	else
+	{
+		State.Accumulator -= NumSubsteps * Step;
+	}
+
+	if (NumSubsteps == 0 || DeltaTime <= KINDA_SMALL_NUMBER)
+	{
+		return 0;
+	}
+
+	FEMFForceFilter Filter = Query.Filter;
+	Filter.CutoffDistance *= FMath::Max(CVarEMFSubstepCutoffScale.GetValueOnGameThread(), 0.0f);
+
+	// Gather and shield once; the sources are a snapshot for the whole frame anyway
+	const TConstArrayView<const FEMSourceDescription*> Gathered = Kernel.GatherSources(Query.Self, Query.Position, Filter.MaxSourceDistance,
+		!Query.bLOSShielding);
+	Filter.BakedField = Kernel.GetGatheredBakedField();
+	TArray<const FEMSourceDescription*>& Visible = EMFSubstep::VisibleSources;
+	Visible.Reset();
+
+	const int32 ChargeSign = FEMFForceKernel::GetChargeSign(Query.Charge);
+	for (const FEMSourceDescription* Source : Gathered)
+	{
+		const EEMFSourceVerdict Verdict = FEMFForceKernel::ClassifySource(Query.Position, ChargeSign, Filter, *Source);
+		if (Verdict == EEMFSourceVerdict::Accept && Query.bLOSShielding && FEMFForceKernel::IsSourceShielded(Query, *Source))
+		{
+			continue;
+		}
+		Visible.Add(Source);
+	}
+
+	const float InvMass = 1.0f / FMath::Max(Mass, 0.001f);
+	const float MaxForceSq = FMath::Square(MaxForce);
+
+	FVector Position = Query.Position;
+	FVector Velocity = Query.Velocity;
+	FEMFForceResult StepResult;
+
+	for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+	{
+		Kernel.Evaluate(Position, Velocity, Query.Charge, Filter, Visible, StepResult);
+
+		OutResult.Force += StepResult.Force;
+		OutResult.PlateForce += StepResult.PlateForce;
+		for (int32 OwnerIndex = 0; OwnerIndex < EMFForce::NumOwnerTypes; ++OwnerIndex)
+		{
+			OutResult.OwnerForces[OwnerIndex] += StepResult.OwnerForces[OwnerIndex];
+		}
+		OutResult.bInsideCutoff |= StepResult.bInsideCutoff;
+		OutResult.bPlateContributed |= StepResult.bPlateContributed;
+		OutResult.NumContributing = FMath::Max(OutResult.NumContributing, StepResult.NumContributing);
+
+		// Semi-implicit Euler on the EM force alone: velocity first, then position with the new velocity
+		FVector StepForce = StepResult.Force;
+		if (StepForce.SizeSquared() > MaxForceSq)
+		{
+			StepForce = StepForce.GetSafeNormal() * MaxForce;
+		}
+		Velocity += StepForce * InvMass * Step;
+		Position += Velocity * Step;
+	}
+
+	// Sum of F*Step over the substeps, spread over the frame: same impulse, applied the usual way
+	const float ToFrame = Step / DeltaTime;
+	OutResult.Force *= ToFrame;
+	OutResult.PlateForce *= ToFrame;
+	for (FVector& OwnerForce : OutResult.OwnerForces)
+	{
+		OwnerForce *= ToFrame;
+	}
+
+	INC_DWORD_STAT_BY(STAT_EMF_Substeps, NumSubsteps);
+	return NumSubsteps;
+}
@@ -0,0 +1,56 @@
+// EMFSubstepIntegrator.h
+// Fixed-rate substepped integration of EM forces, independent of the render frame rate
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FEMFForceKernel;
+struct FEMFForceQuery;
+struct FEMFForceResult;
+
+/** Integrator state a receiver keeps across frames. */
+struct FEMFSubstepState
+{
+	/** Frame time not yet covered by a whole substep; carried into the next frame */
+	float Accumulator = 0.0f;
+};
+
+/**
+ * Integrates a receiver's EM force at a fixed rate (EMF.Substep.Rate, 120 Hz by default) instead of
+ * sampling it once per frame.
+ *
+ * A single sample per frame is what makes the Coulomb term dangerous: at 30 fps a prop passing a
+ * charge feels whatever the force was at the one point it happened to be, for the whole frame.
+ * That is why receivers carry a close-range cutoff and proximity damping sized for the worst frame
+ * time. Here the frame's time is split into fixed substeps; each substep evaluates the force at the
+ * receiver's predicted position and velocity (semi-implicit Euler on the EM force alone), and the
+ * frame gets the time-averaged force back. The result is the same whatever the frame rate, so the
+ * cutoffs can shrink (EMF.Substep.CutoffScale).
+ *
+ * Sources are gathered and LOS-tested once per frame at the start position; only the force
+ * evaluation repeats. Leftover time below one substep carries over; a hitch beyond
+ * EMF.Substep.MaxSubsteps drops the excess instead of spiralling.
+ *
+ * Receivers opt in per instance (bUseFixedStepIntegration). EMF.Substep.Mode 0 turns it off
+ * everywhere, 2 forces it on everywhere.
+ */
+class POLARITY_API FEMFSubstepIntegrator
+{
+public:
+	/** Whether a receiver with the given opt-in flag should integrate with substeps right now. */
+	static bool IsActiveFor(bool bReceiverOptedIn);
+
+	/**
+	 * Run this frame's substeps for one receiver.
+	 *
+	 * OutResult is in the same terms as a single FEMFForceKernel evaluation, so callers use it in
+	 * place of one: its forces are the frame-equivalent force (total impulse over the substeps
+	 * divided by DeltaTime), flags are set if any substep set them. Each substep's force is clamped
+	 * to MaxForce before it moves the receiver.
+	 *
+	 * @return Number of substeps run this frame (0 when the frame was shorter than one substep)
+	 */
+	static int32 Integrate(FEMFForceKernel& Kernel, const FEMFForceQuery& Query, float Mass, float MaxForce,
+		float DeltaTime, FEMFSubstepState& State, FEMFForceResult& OutResult);
+};
@@ -16,6 +16,12 @@
 // EMF Plugin includes
 #include "EMF_FieldComponent.h"
 #include "EMF_PluginBPLibrary.h"
+#include "EMFSourceIndexSubsystem.h"
+#include "EMFForceKernel.h"
+#include "EMFSolverSubsystem.h"
+#include "EMFReceiverLODSubsystem.h"
+#include "EMFLog.h"
+#include "EMFStats.h"
 #include "Engine/OverlapResult.h"
 
 UEMFVelocityModifier::UEMFVelocityModifier()
@@ -63,6 +69,22 @@ void UEMFVelocityModifier::BeginPlay()
 		PreviousCharge = GetCharge();
 		// Initialize charge from BaseCharge
 		UpdateFieldComponentCharge();
+
+		// So the source index can tell our own entry apart when we query
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(FieldComponent);
+		}
+
+		if (UEMFSolverSubsystem* Solver = GetWorld()->GetSubsystem<UEMFSolverSubsystem>())
+		{
+			Solver->RegisterModifier(this);
+		}
+
+		if (UEMFReceiverLODSubsystem* LOD = GetWorld()->GetSubsystem<UEMFReceiverLODSubsystem>())
+		{
+			LOD->RegisterModifier(this);
+		}
 	}
 
 	// Find and register with MovementComponent
@@ -93,6 +115,24 @@ void UEMFVelocityModifier::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		MovementComponent->UnregisterVelocityModifier(this);
 	}
 
+	if (FieldComponent)
+	{
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->UnregisterFieldComponent(FieldComponent);
+		}
+	}
+
+	if (UEMFSolverSubsystem* Solver = GetWorld()->GetSubsystem<UEMFSolverSubsystem>())
+	{
+		Solver->UnregisterModifier(this);
+	}
+
+	if (UEMFReceiverLODSubsystem* LOD = GetWorld()->GetSubsystem<UEMFReceiverLODSubsystem>())
+	{
+		LOD->UnregisterModifier(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -100,17 +140,19 @@ void UEMFVelocityModifier::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 bool UEMFVelocityModifier::ModifyVelocity_Implementation(float DeltaTime, const FVector& CurrentVelocity, FVector& OutVelocityDelta)
 {
+#if EMF_DEBUG_DIAGNOSTICS
 	// Periodic diagnostic — fires ~4x/sec when NPC is captured, to verify path is alive
-	if (CapturingPlate.IsValid())
+	if (CapturingPlate.IsValid() && EMF_LOG_ACTIVE(Verbose))
 	{
 		static int32 LogCounter = 0;
 		if (++LogCounter % 15 == 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[CAPTURE_DEBUG] %s ModifyVelocity: bEnabled=%d, bViscous=%d, Plate=%s, ReverseMode=%d, CurrentVel=%s"),
+			EMF_LOG(Verbose, TEXT("[CAPTURE_DEBUG] %s ModifyVelocity: bEnabled=%d, bViscous=%d, Plate=%s, ReverseMode=%d, CurrentVel=%s"),
 				GetOwner() ? *GetOwner()->GetName() : TEXT("?"), bEnabled, bEnableViscousCapture,
 				*CapturingPlate->GetName(), CapturingPlate->IsInReverseMode(), *CurrentVelocity.ToCompactString());
 		}
 	}
+#endif
 
 	if (!bEnabled)
 	{
@@ -291,6 +333,8 @@ EEMSourceOwnerType UEMFVelocityModifier::GetOwnerType() const
 
 FVector UEMFVelocityModifier::ComputeVelocityDelta(float DeltaTime, const FVector& CurrentVelocity)
 {
+	EMF_SCOPE_CYCLE_COUNTER(ReceiverUpdate);
+
 	if (!FieldComponent)
 	{
 		return FVector::ZeroVector;
@@ -308,10 +352,7 @@ FVector UEMFVelocityModifier::ComputeVelocityDelta(float DeltaTime, const FVecto
 		return ComputeProxyVelocityDelta(DeltaTime, CurrentVelocity);
 	}
 
-	// Get all other sources (excluding self)
-	TArray<FEMSourceDescription> OtherSources = FieldComponent->GetAllOtherSources();
-
-	if (OtherSources.Num() == 0)
+	if (!UEMFSourceIndexSubsystem::HasOtherSources(FieldComponent))
 	{
 		// No other sources - no force
 		CurrentEMForce = FVector::ZeroVector;
@@ -320,11 +361,12 @@ FVector UEMFVelocityModifier::ComputeVelocityDelta(float DeltaTime, const FVecto
 	}
 
 	FVector Position = Owner->GetActorLocation();
+
 	float Charge = GetCharge();
 	float Mass = GetMass();
 
 	// Debug: always-visible capture range sphere around this NPC
-	if (bDrawDebug && bEnableViscousCapture)
+	if (EMF_SHOULD_DRAW(bDrawDebug) && bEnableViscousCapture)
 	{
 		const float DebugCaptureRange = CalculateCaptureRange();
 		if (DebugCaptureRange > 0.0f)
@@ -333,16 +375,7 @@ FVector UEMFVelocityModifier::ComputeVelocityDelta(float DeltaTime, const FVecto
 		}
 	}
 
-	// Pre-calculate squared distances for faster comparison
-	const float MaxDistSq = MaxSourceDistance * MaxSourceDistance;
-	const float OppositeChargeMinDistSq = bEnableOppositeChargeDistanceCutoff
-		? OppositeChargeMinDistance * OppositeChargeMinDistance : 0.0f;
-
-	// Calculate Lorentz force from each source individually with multipliers
-	FVector TotalForce = FVector::ZeroVector;
-	FVector PlateForce = FVector::ZeroVector; // Separated for viscous capture suppression
 	bool bFoundAnyChannelingPlate = false; // Track plate presence for non-capturable timer
-	bool bShouldApplyProximityDamping = false;
 
 	// Viscous capture: resolve plate position from direct reference (not registry search)
 	FVector NearestPlatePosition = FVector::ZeroVector;
@@ -358,123 +391,68 @@ FVector UEMFVelocityModifier::ComputeVelocityDelta(float DeltaTime, const FVecto
 		bFoundPlate = true;
 	}
 
-	for (const FEMSourceDescription& Source : OtherSources)
+	// Forces from sources within MaxSourceDistance (excluding self). The solver has usually done this
+	// already earlier in the frame; if not, evaluate here. Other sources exist (checked above), so no
+	// early-out when none is in range: the capture timers and hard hold below must still run.
+	// Far from every player the LOD hands back a blend of recent results instead.
+	FEMFForceResult ForceResult;
+	if (UEMFReceiverLODSubsystem::ShouldEvaluate(this, ForceResult))
 	{
-		// OPTIMIZATION: Skip sources with zero charge/current/field - they produce no force
-		if (IsSourceEffectivelyZero(Source))
-		{
-			continue;
-		}
-
-		// OPTIMIZATION: Distance culling - skip sources too far away
-		float DistSq = FVector::DistSquared(Position, Source.Position);
-		if (DistSq > MaxDistSq)
+		if (UsesFixedStepIntegration())
 		{
-			continue;
-		}
-
-		// Close-range cutoff: skip any charged source inside the cutoff radius. Prevents extreme forces
-		// from the Coulomb 1/r^2 singularity, which is sign-independent -- the old version only fired
-		// for opposite signs, so same-sign pairs at contact range kept the full force. Same fix as
-		// AEMFPhysicsProp::ApplyEMForces, kept identical so the two do not drift apart.
-		if (bEnableOppositeChargeDistanceCutoff && DistSq < OppositeChargeMinDistSq)
-		{
-			const int32 SourceChargeSign = GetSourceEffectiveChargeSign(Source);
-			const int32 MyChargeSign = (Charge > KINDA_SMALL_NUMBER) ? 1 : ((Charge < -KINDA_SMALL_NUMBER) ? -1 : 0);
-			if (SourceChargeSign != 0 && MyChargeSign != 0)
+			FEMFForceQuery Query;
+			if (BuildForceQuery(CurrentVelocity, Query))
 			{
-				bShouldApplyProximityDamping = true;
-				continue;
+				FEMFSubstepIntegrator::Integrate(FEMFForceKernel::GetGameThreadKernel(), Query, Mass, MaxForce,
+					DeltaTime, SubstepState, ForceResult);
 			}
 		}
-
-		// LOS Shielding: skip sources blocked by geometry
-		if (bEnableLOSShielding)
+		else if (UEMFSolverSubsystem::TryGetResult(this, ForceResult))
 		{
-			FHitResult LOSHit;
-			FCollisionQueryParams LOSParams(SCENE_QUERY_STAT(EMF_LOS), true, Owner);
-			bool bBlocked = GetWorld()->LineTraceSingleByChannel(
-				LOSHit, Position, Source.Position, LOSTraceChannel, LOSParams);
-
-			if (bDrawLOSDebug)
-			{
-				DrawDebugLine(GetWorld(), Position, Source.Position,
-					bBlocked ? FColor::Red : FColor::Green, false, -1.0f, 0, 0.5f);
-			}
-
-			if (bBlocked)
+			FEMFForceQuery Query;
+			if (UEMFSolverSubsystem::IsValidating() && BuildForceQuery(CurrentVelocity, Query))
 			{
-				continue;
+				UEMFSolverSubsystem::ValidateResult(this, Query, ForceResult);
 			}
 		}
-
-		// Identify plate sources (player-owned finite plates from channeling)
-		const bool bIsChannelingPlate =
-			Source.SourceType == EEMSourceType::FinitePlate &&
-			Source.OwnerType == EEMSourceOwnerType::Player;
-
-		// Non-captured NPCs with viscous capture enabled: SKIP plate forces entirely.
-		// Only the captured NPC should feel the plate.
-		if (bIsChannelingPlate && bEnableViscousCapture && !bFoundPlate)
-		{
-			continue;
-		}
-
-
-
-		bool bIsPlateSource = bFoundPlate && bIsChannelingPlate;
-
-		// Get multiplier for this source's owner type
-		float Multiplier = GetForceMultiplierForOwnerType(Source.OwnerType);
-
-		// Skip sources with zero multiplier for optimization
-		if (FMath::IsNearlyZero(Multiplier))
+		else
 		{
-			continue;
+			FEMFForceQuery Query;
+			if (BuildForceQuery(CurrentVelocity, Query))
+			{
+				FEMFForceKernel::GetGameThreadKernel().EvaluateQuery(Query, ForceResult);
+			}
 		}
+		UEMFReceiverLODSubsystem::SubmitResult(this, ForceResult);
+	}
 
-		// Calculate force from this single source
-		TArray<FEMSourceDescription> SingleSource;
-		SingleSource.Add(Source);
-
-		FVector SourceForce = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(
-			Charge,
-			Position,
-			CurrentVelocity,
-			SingleSource,
-			true  // Include magnetic component
-		);
-
-		SourceForce *= Multiplier;
+	FVector TotalForce = ForceResult.Force;
+	FVector PlateForce = bFoundPlate ? ForceResult.PlateForce : FVector::ZeroVector; // Separated for viscous capture suppression
+	const bool bShouldApplyProximityDamping = ForceResult.bInsideCutoff;
 
+#if EMF_DEBUG_DIAGNOSTICS
+	if (EMF_LOG_ACTIVE(Verbose))
+	{
 		// [SHAKE_EMF] Melee-jitter probe: significant force from the PLAYER's charge on this actor.
 		// At lunge stop distance (~50cm) the Coulomb 1/r² term can get huge for same-sign charges
 		// (the opposite-charge cutoff doesn't cover repulsion). Filter Output Log by SHAKE_EMF.
-		if (Source.OwnerType == EEMSourceOwnerType::Player && SourceForce.SizeSquared() > FMath::Square(500.0f))
+		const FVector PlayerForce = ForceResult.OwnerForces[EMFForce::OwnerTypeIndex(EEMSourceOwnerType::Player)] - ForceResult.PlateForce;
+		if (PlayerForce.SizeSquared() > FMath::Square(500.0f))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[SHAKE_EMF] %s force from PLAYER: (%.0f,%.0f,%.0f) size=%.0f dist=%.0f myCharge=%.2f mult=%.2f"),
+			EMF_LOG(Verbose, TEXT("[SHAKE_EMF] %s force from PLAYER: (%.0f,%.0f,%.0f) size=%.0f myCharge=%.2f mult=%.2f"),
 				GetOwner() ? *GetOwner()->GetName() : TEXT("?"),
-				SourceForce.X, SourceForce.Y, SourceForce.Z, SourceForce.Size(),
-				FMath::Sqrt(DistSq), Charge, Multiplier);
+				PlayerForce.X, PlayerForce.Y, PlayerForce.Z, PlayerForce.Size(),
+				Charge, GetForceMultiplierForOwnerType(EEMSourceOwnerType::Player));
 		}
 
-		// DEBUG: Log plate force on kamikaze drones
-		if (bIsChannelingPlate)
+		// Plate force on kamikaze drones
+		if (ForceResult.bPlateContributed)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[EMF DEBUG] %s | PlateForce: %s | Mult: %.1f | Charge: %.1f | bViscous: %d | bFoundPlate: %d | Timer: %.2f/%.2f"),
-				*GetOwner()->GetName(), *SourceForce.ToCompactString(), Multiplier, Charge, bEnableViscousCapture, bFoundPlate, NonCapturePlateForceTimer, NonCapturePlateForceDuration);
-		}
-
-		// Separate plate forces for later suppression
-		if (bIsPlateSource)
-		{
-			PlateForce += SourceForce;
-		}
-		else
-		{
-			TotalForce += SourceForce;
+			EMF_LOG(Verbose, TEXT("[EMF DEBUG] %s | PlateForce: %s | Mult: %.1f | Charge: %.1f | bViscous: %d | bFoundPlate: %d | Timer: %.2f/%.2f"),
+				*GetOwner()->GetName(), *ForceResult.PlateForce.ToCompactString(), GetForceMultiplierForOwnerType(EEMSourceOwnerType::Player), Charge, bEnableViscousCapture, bFoundPlate, NonCapturePlateForceTimer, NonCapturePlateForceDuration);
 		}
 	}
+#endif
 
 	// ===== Hard Hold Capture: suppress EM forces + rigid hold =====
 	if (bFoundPlate)
@@ -560,15 +538,15 @@ FVector UEMFVelocityModifier::ComputeVelocityDelta(float DeltaTime, const FVecto
 		VelocityDelta = ComputeHardHoldDelta(DeltaTime, CurrentVelocity, CaptPlate);
 	}
 
-	// DEBUG: Final velocity delta for drones
-	if (!VelocityDelta.IsNearlyZero(0.1f))
+	// Final velocity delta for drones
+	if (EMF_LOG_ACTIVE(Verbose) && !VelocityDelta.IsNearlyZero(0.1f))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[EMF RESULT] %s | VelDelta: %s | Force: %s | Mass: %.1f"),
+		EMF_LOG(Verbose, TEXT("[EMF RESULT] %s | VelDelta: %s | Force: %s | Mass: %.1f"),
 			*GetOwner()->GetName(), *VelocityDelta.ToCompactString(), *CurrentEMForce.ToCompactString(), Mass);
 	}
 
 	// Debug
-	if (bDrawDebug)
+	if (EMF_SHOULD_DRAW(bDrawDebug))
 	{
 		DrawDebugForces(Position, CurrentEMForce);
 	}
@@ -616,6 +594,80 @@ float UEMFVelocityModifier::GetForceMultiplierForOwnerType(EEMSourceOwnerType Ow
 	}
 }
 
+bool UEMFVelocityModifier::BuildForceQuery(const FVector& Velocity, FEMFForceQuery& OutQuery) const
+{
+	AActor* Owner = GetOwner();
+	if (!bEnabled || !FieldComponent || !Owner)
+	{
+		return false;
+	}
+
+	// Channeling proxy mode: forces at the plate position, from Environment sources only
+	if (bChannelingProxyMode && ProxyPlateActor.IsValid())
+	{
+		AEMFChannelingPlateActor* Plate = ProxyPlateActor.Get();
+		if (!Plate->PlateFieldComponent)
+		{
+			return false;
+		}
+
+		OutQuery.Self = Plate->PlateFieldComponent;
+		OutQuery.Receiver = this;
+		OutQuery.IgnoreActor = Owner;
+		OutQuery.Position = Plate->GetActorLocation();
+		OutQuery.Velocity = Velocity; // Player's velocity for the magnetic component
+		OutQuery.Charge = Plate->GetPlateChargeDensity();
+		OutQuery.Filter.MaxSourceDistance = MaxSourceDistance;
+		for (float& Multiplier : OutQuery.Filter.OwnerMultipliers)
+		{
+			Multiplier = 0.0f;
+		}
+		OutQuery.Filter.SetMultiplier(EEMSourceOwnerType::Environment, EnvironmentForceMultiplier);
+		return true;
+	}
+
+	// Same exit as ModifyVelocity: uncharged and not held, nothing to compute
+	if (!bChannelingProxyMode && !CapturingPlate.IsValid() && FMath::IsNearlyZero(GetCharge()))
+	{
+		return false;
+	}
+
+	OutQuery.Self = FieldComponent;
+	OutQuery.Receiver = this;
+	OutQuery.IgnoreActor = Owner;
+	OutQuery.Position = Owner->GetActorLocation();
+	OutQuery.Velocity = Velocity;
+	OutQuery.Charge = GetCharge();
+	OutQuery.Filter.MaxSourceDistance = MaxSourceDistance;
+
+	// Close-range cutoff: skip any charged source inside the cutoff radius. Prevents extreme forces
+	// from the Coulomb 1/r^2 singularity, which is sign-independent. Same rule as
+	// AEMFPhysicsProp::ApplyEMForces; both go through the kernel so they cannot drift apart.
+	OutQuery.Filter.CutoffDistance = bEnableOppositeChargeDistanceCutoff ? OppositeChargeMinDistance : 0.0f;
+
+	for (int32 OwnerIndex = 0; OwnerIndex < EMFForce::NumOwnerTypes; ++OwnerIndex)
+	{
+		OutQuery.Filter.OwnerMultipliers[OwnerIndex] = GetForceMultiplierForOwnerType(static_cast<EEMSourceOwnerType>(OwnerIndex));
+	}
+
+	// Non-captured NPCs with viscous capture enabled skip plate forces entirely: only the captured NPC
+	// should feel the plate. The captured one gets plate force separated for suppression later.
+	if (bEnableViscousCapture && CapturingPlate.IsValid())
+	{
+		OutQuery.Filter.PlateHandling = EEMFPlateHandling::Separate;
+	}
+	else if (bEnableViscousCapture)
+	{
+		OutQuery.Filter.PlateHandling = EEMFPlateHandling::Skip;
+	}
+
+	// LOS Shielding: skip sources blocked by geometry
+	OutQuery.bLOSShielding = bEnableLOSShielding;
+	OutQuery.bDrawLOSDebug = bDrawLOSDebug;
+	OutQuery.LOSChannel = LOSTraceChannel;
+	return true;
+}
+
 bool UEMFVelocityModifier::CanBeNeutralized() const
 {
 	if (!bCanNeutralizeOnContact || FMath::IsNearlyZero(GetCharge()))
@@ -696,108 +748,6 @@ void UEMFVelocityModifier::OnOwnerBeginOverlap(AActor* OverlappedActor, AActor*
 	}
 }
 
-bool UEMFVelocityModifier::IsSourceEffectivelyZero(const FEMSourceDescription& Source)
-{
-	// Check based on source type - different types store "strength" differently
-	switch (Source.SourceType)
-	{
-	case EEMSourceType::PointCharge:
-		return FMath::IsNearlyZero(Source.PointChargeParams.Charge);
-
-	case EEMSourceType::LineCharge:
-		return FMath::IsNearlyZero(Source.LineChargeParams.LinearChargeDensity);
-
-	case EEMSourceType::ChargedRing:
-		return FMath::IsNearlyZero(Source.RingParams.TotalCharge);
-
-	case EEMSourceType::ChargedSphere:
-		return FMath::IsNearlyZero(Source.SphereParams.TotalCharge);
-
-	case EEMSourceType::ChargedBall:
-		return FMath::IsNearlyZero(Source.BallParams.TotalCharge);
-
-	case EEMSourceType::InfinitePlate:
-	case EEMSourceType::FinitePlate:
-		return FMath::IsNearlyZero(Source.PlateParams.SurfaceChargeDensity);
-
-	case EEMSourceType::Dipole:
-		return Source.DipoleParams.DipoleMoment.IsNearlyZero();
-
-	case EEMSourceType::CurrentWire:
-		return FMath::IsNearlyZero(Source.WireParams.Current);
-
-	case EEMSourceType::CurrentLoop:
-		return FMath::IsNearlyZero(Source.LoopParams.Current);
-
-	case EEMSourceType::Solenoid:
-		return FMath::IsNearlyZero(Source.SolenoidParams.Current);
-
-	case EEMSourceType::MagneticDipole:
-		return Source.MagneticDipoleParams.MagneticMoment.IsNearlyZero();
-
-	case EEMSourceType::SectorMagnet:
-		return FMath::IsNearlyZero(Source.SectorMagnetParams.FieldStrength);
-
-	case EEMSourceType::PlateMagnet:
-		return FMath::IsNearlyZero(Source.PlateMagnetParams.FieldStrength);
-
-	// Passive sources (dielectrics, grounded conductors) - they modify fields, not create them
-	// But they still need external sources to work, so skip them if no permittivity effect
-	case EEMSourceType::DielectricSphere:
-		return FMath::IsNearlyEqual(Source.DielectricSphereParams.RelativePermittivity, 1.0f);
-
-	case EEMSourceType::DielectricSlab:
-		return FMath::IsNearlyEqual(Source.DielectricSlabParams.RelativePermittivity, 1.0f);
-
-	case EEMSourceType::GroundedConductor:
-	case EEMSourceType::GroundedPlate:
-		// Grounded conductors always affect fields if present
-		return false;
-
-	case EEMSourceType::Antenna:
-	case EEMSourceType::WaveGuide:
-	case EEMSourceType::Custom:
-	default:
-		// For unknown/custom types, check legacy Charge field as fallback
-		return FMath::IsNearlyZero(Source.PointChargeParams.Charge);
-	}
-}
-
-int32 UEMFVelocityModifier::GetSourceEffectiveChargeSign(const FEMSourceDescription& Source)
-{
-	float EffectiveCharge = 0.0f;
-
-	switch (Source.SourceType)
-	{
-	case EEMSourceType::PointCharge:
-		EffectiveCharge = Source.PointChargeParams.Charge;
-		break;
-	case EEMSourceType::LineCharge:
-		EffectiveCharge = Source.LineChargeParams.LinearChargeDensity;
-		break;
-	case EEMSourceType::ChargedRing:
-		EffectiveCharge = Source.RingParams.TotalCharge;
-		break;
-	case EEMSourceType::ChargedSphere:
-		EffectiveCharge = Source.SphereParams.TotalCharge;
-		break;
-	case EEMSourceType::ChargedBall:
-		EffectiveCharge = Source.BallParams.TotalCharge;
-		break;
-	case EEMSourceType::InfinitePlate:
-	case EEMSourceType::FinitePlate:
-		EffectiveCharge = Source.PlateParams.SurfaceChargeDensity;
-		break;
-	default:
-		// Magnetic sources, dielectrics, grounded conductors — no charge sign concept
-		return 0;
-	}
-
-	if (EffectiveCharge > KINDA_SMALL_NUMBER) return 1;
-	if (EffectiveCharge < -KINDA_SMALL_NUMBER) return -1;
-	return 0;
-}
-
 // ==================== Capture: Hard Hold ====================
 
 float UEMFVelocityModifier::CalculateCaptureRange() const
@@ -1072,17 +1022,7 @@ void UEMFVelocityModifier::SetChannelingProxyMode(bool bEnable, AEMFChannelingPl
 FVector UEMFVelocityModifier::ComputeProxyVelocityDelta(float DeltaTime, const FVector& CurrentVelocity)
 {
 	AEMFChannelingPlateActor* Plate = ProxyPlateActor.Get();
-	if (!Plate || !Plate->PlateFieldComponent)
-	{
-		CurrentEMForce = FVector::ZeroVector;
-		CurrentAcceleration = FVector::ZeroVector;
-		return FVector::ZeroVector;
-	}
-
-	// Get all sources visible to the plate (excluding the plate actor itself)
-	TArray<FEMSourceDescription> OtherSources = Plate->PlateFieldComponent->GetAllOtherSources();
-
-	if (OtherSources.Num() == 0)
+	if (!Plate || !Plate->PlateFieldComponent || !UEMFSourceIndexSubsystem::HasOtherSources(Plate->PlateFieldComponent))
 	{
 		CurrentEMForce = FVector::ZeroVector;
 		CurrentAcceleration = FVector::ZeroVector;
@@ -1090,48 +1030,29 @@ FVector UEMFVelocityModifier::ComputeProxyVelocityDelta(float DeltaTime, const F
 	}
 
 	FVector PlatePosition = Plate->GetActorLocation();
-	float PlateCharge = Plate->GetPlateChargeDensity();
 	float Mass = GetMass();
 
-	// Pre-calculate squared max distance
-	const float MaxDistSq = MaxSourceDistance * MaxSourceDistance;
-
-	FVector TotalForce = FVector::ZeroVector;
-
-	for (const FEMSourceDescription& Source : OtherSources)
+	// Only Environment sources act on the plate for player movement (see BuildForceQuery)
+	FEMFForceResult ForceResult;
+	if (UEMFSolverSubsystem::TryGetResult(this, ForceResult))
 	{
-		// Only interact with Environment sources for player movement
-		if (Source.OwnerType != EEMSourceOwnerType::Environment)
+		FEMFForceQuery Query;
+		if (UEMFSolverSubsystem::IsValidating() && BuildForceQuery(CurrentVelocity, Query))
 		{
-			continue;
+			UEMFSolverSubsystem::ValidateResult(this, Query, ForceResult);
 		}
-
-		if (IsSourceEffectivelyZero(Source))
-		{
-			continue;
-		}
-
-		float DistSq = FVector::DistSquared(PlatePosition, Source.Position);
-		if (DistSq > MaxDistSq)
+	}
+	else
+	{
+		FEMFForceQuery Query;
+		if (BuildForceQuery(CurrentVelocity, Query))
 		{
-			continue;
+			FEMFForceKernel::GetGameThreadKernel().EvaluateQuery(Query, ForceResult);
 		}
-
-		// Calculate force on the plate from this environment source
-		TArray<FEMSourceDescription> SingleSource;
-		SingleSource.Add(Source);
-
-		FVector SourceForce = UEMF_PluginBPLibrary::CalculateLorentzForceComplete(
-			PlateCharge,
-			PlatePosition,
-			CurrentVelocity, // Use player's velocity for magnetic component
-			SingleSource,
-			true
-		);
-
-		TotalForce += SourceForce * EnvironmentForceMultiplier;
 	}
 
+	const FVector TotalForce = ForceResult.Force;
+
 	CurrentEMForce = TotalForce;
 
 	// Clamp maximum force
@@ -1143,7 +1064,7 @@ FVector UEMFVelocityModifier::ComputeProxyVelocityDelta(float DeltaTime, const F
 	CurrentAcceleration = CurrentEMForce / FMath::Max(Mass, 0.001f);
 	FVector VelocityDelta = CurrentAcceleration * DeltaTime;
 
-	if (bDrawDebug)
+	if (EMF_SHOULD_DRAW(bDrawDebug))
 	{
 		// Draw force at plate position pointing toward player
 		DrawDebugForces(PlatePosition, CurrentEMForce);
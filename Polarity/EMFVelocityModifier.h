@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "VelocityModifier.h"
+#include "EMFSubstepIntegrator.h"
 #include "EMFVelocityModifier.generated.h"
 
 class UApexMovementComponent;
@@ -14,6 +15,7 @@ class AEMFChannelingPlateActor;
 
 // EMF Plugin - forward declaration
 struct FEMSourceDescription;
+struct FEMFForceQuery;
 
 // Делегаты
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnChargeChanged, float, NewCharge);
@@ -67,6 +69,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Performance", meta = (ClampMin = "100.0", Units = "cm"))
 	float MaxSourceDistance = 10000.0f;
 
+	/** Integrate EM forces at a fixed rate (EMF.Substep.Rate) instead of sampling them once per frame.
+	 *  Keeps fast movers stable near strong sources at low frame rates; the close-range cutoff
+	 *  shrinks by EMF.Substep.CutoffScale while it is on. Not used in channeling proxy mode. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EMF|Performance")
+	bool bUseFixedStepIntegration = false;
+
 	// ==================== Charge Accumulation ====================
 
 	/** Текущий заряд (модуль). Расходуется на выстрелы и способности. Начинается с 0. */
@@ -473,6 +481,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "EMF|Channeling")
 	bool IsInChannelingProxyMode() const { return bChannelingProxyMode; }
 
+	// ==================== Force Evaluation ====================
+
+	/** Describe this receiver's force pass for the EMF force kernel (position, charge, filters, LOS).
+	 *  Used by ComputeVelocityDelta and, ahead of it, by UEMFSolverSubsystem.
+	 *  @return false when there is nothing to compute (disabled, uncharged and not held, no plate in proxy mode) */
+	bool BuildForceQuery(const FVector& Velocity, FEMFForceQuery& OutQuery) const;
+
+	/** True if ComputeVelocityDelta integrates with fixed substeps this frame (and the solver can skip us) */
+	bool UsesFixedStepIntegration() const { return !bChannelingProxyMode && FEMFSubstepIntegrator::IsActiveFor(bUseFixedStepIntegration); }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -515,14 +533,6 @@ private:
 	/** Debug визуализация */
 	void DrawDebugForces(const FVector& Position, const FVector& Force) const;
 
-	/** Check if source has effectively zero charge/current/field strength
-	 *  Handles different source types: PointCharge, LineCharge, CurrentWire, etc.
-	 *  @return true if source produces no force (zero charge/current/field) */
-	static bool IsSourceEffectivelyZero(const FEMSourceDescription& Source);
-
-	/** Get effective charge sign of source (+1, -1, or 0 for magnetic/neutral) */
-	static int32 GetSourceEffectiveChargeSign(const FEMSourceDescription& Source);
-
 	// ==================== Capture State ====================
 
 	/** Plate that captured this NPC (set via SetCapturedByPlate) */
@@ -535,6 +545,9 @@ private:
 	/** Accumulated time that NPC has been outside CaptureRadius */
 	float WeakCaptureTimer = 0.0f;
 
+	/** Fixed-step EM integration carry-over, see bUseFixedStepIntegration */
+	FEMFSubstepState SubstepState;
+
 	/** Timer tracking how long channeling plate has been active (for non-capturable NPCs) */
 	float NonCapturePlateForceTimer = 0.0f;
 
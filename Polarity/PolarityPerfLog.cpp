@@ -0,0 +1,5 @@
+// PolarityPerfLog.cpp
+
+#include "PolarityPerfLog.h"
+
+DEFINE_LOG_CATEGORY(LogPolarityPerf);
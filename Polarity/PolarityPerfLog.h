@@ -0,0 +1,15 @@
+// PolarityPerfLog.h
+// Log category for the budgeted systems' counters, reports and benchmarks
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Where the pooling, AI and projectile systems that keep lifetime counters print them: gib and actor
+ * pools, enemy beam bolts, AI line of sight, the combat coordinator and its stress test, the flight
+ * field, the projectile simulation, the VFX manager. Their Report console commands log at Log, so
+ * "log LogPolarityPerf Verbose" only adds the per-event messages (pool misses and the like) and
+ * "log LogPolarityPerf off" silences all of it without touching LogTemp.
+ */
+DECLARE_LOG_CATEGORY_EXTERN(LogPolarityPerf, Log, All);
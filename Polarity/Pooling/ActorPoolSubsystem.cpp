@@ -0,0 +1,312 @@
+// ActorPoolSubsystem.cpp
+
+#include "ActorPoolSubsystem.h"
+#include "PoolableActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarPoolEnable(
+	TEXT("Pool.Enable"),
+	1,
+	TEXT("1=poolable actors are reused through the actor pool, 0=spawned and destroyed like any other actor"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolPrewarmPerFrame(
+	TEXT("Pool.PrewarmPerFrame"),
+	4,
+	TEXT("Pooled actors created per frame while prewarm requests are outstanding"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolMaxPrewarmPerClass(
+	TEXT("Pool.MaxPrewarmPerClass"),
+	32,
+	TEXT("Upper bound on the actors a prewarm request can ask for per class; misses past it still spawn"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GPoolReportCmd(
+	TEXT("Pool.Report"),
+	TEXT("Print actor pool sizes per class, reuse and misses since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UActorPoolSubsystem* Pool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr)
+		{
+			Pool->ReportStats();
+		}
+	}));
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UActorPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Create for all game worlds, skip editor preview worlds
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	// Actors are destroyed with the world
+	Pools.Empty();
+	Owned.Empty();
+	PrewarmQueue.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UActorPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UActorPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UActorPoolSubsystem::Tick(float DeltaTime)
+{
+	int32 Budget = FMath::Max(CVarPoolPrewarmPerFrame.GetValueOnGameThread(), 1);
+
+	while (Budget > 0 && PrewarmQueue.Num() > 0)
+	{
+		UClass* ActorClass = PrewarmQueue[0];
+		const FActorPoolList* Pool = Pools.Find(ActorClass);
+		if (!ActorClass || !Pool || Pool->NumOwned >= Pool->PrewarmTarget)
+		{
+			PrewarmQueue.RemoveAt(0, EAllowShrinking::No);
+			continue;
+		}
+
+		// BeginPlay of the new actor may touch other pools, so look this one up again afterwards
+		AActor* Actor = SpawnPooledActor(ActorClass);
+		if (!Actor)
+		{
+			PrewarmQueue.RemoveAt(0, EAllowShrinking::No);
+			continue;
+		}
+
+		Pools.FindChecked(ActorClass).Free.Add(Actor);
+		++TotalPrewarmed;
+		--Budget;
+	}
+}
+
+// ==================== API ====================
+
+AActor* UActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform,
+	AActor* Owner, APawn* Instigator)
+{
+	UWorld* World = GetWorld();
+	if (!ActorClass || !World)
+	{
+		return nullptr;
+	}
+
+	++TotalAcquires;
+
+	// Not poolable (or pooling off): spawn it the way the call site always did
+	if (!CVarPoolEnable.GetValueOnGameThread() || !ActorClass->ImplementsInterface(UPoolableActor::StaticClass()))
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Owner = Owner;
+		SpawnParams.Instigator = Instigator;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<AActor>(ActorClass, Transform, SpawnParams);
+	}
+
+	AActor* Actor = nullptr;
+	if (FActorPoolList* Pool = Pools.Find(ActorClass))
+	{
+		// Pop from pool, skipping any that were unexpectedly destroyed
+		while (!Actor && Pool->Free.Num() > 0)
+		{
+			Actor = Pool->Free.Pop(EAllowShrinking::No);
+			if (!IsValid(Actor))
+			{
+				Actor = nullptr;
+			}
+		}
+	}
+
+	if (Actor)
+	{
+		++TotalReuses;
+	}
+	else
+	{
+		Actor = SpawnPooledActor(ActorClass);
+		if (!Actor)
+		{
+			return nullptr;
+		}
+		++TotalMisses;
+	}
+
+	Owned.FindChecked(Actor) = true;
+
+	Actor->SetOwner(Owner);
+	Actor->SetInstigator(Instigator);
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+	Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+	CastChecked<IPoolableActor>(Actor)->OnPoolActivate();
+
+	return Actor;
+}
+
+bool UActorPoolSubsystem::Release(AActor* Actor)
+{
+	bool* bInUse = Actor ? Owned.Find(Actor) : nullptr;
+	if (!bInUse || !*bInUse)
+	{
+		return false;
+	}
+	*bInUse = false;
+
+	IPoolableActor* Poolable = CastChecked<IPoolableActor>(Actor);
+	Poolable->OnPoolDeactivate();
+	Poolable->OnPoolReset();
+
+	Park(Actor);
+	Pools.FindOrAdd(Actor->GetClass()).Free.Add(Actor);
+
+	++TotalReleases;
+	return true;
+}
+
+void UActorPoolSubsystem::ReleaseOrDestroy(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	UWorld* World = Actor->GetWorld();
+	UActorPoolSubsystem* Pool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr;
+
+	// Ours: park it. Already parked (lifetime timer after pickup, say) is a no-op, not a Destroy.
+	if (Pool && Pool->Owned.Contains(Actor))
+	{
+		Pool->Release(Actor);
+		return;
+	}
+
+	Actor->Destroy();
+}
+
+void UActorPoolSubsystem::RequestPrewarm(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!ActorClass || Count <= 0 || !CVarPoolEnable.GetValueOnGameThread()
+		|| !ActorClass->ImplementsInterface(UPoolableActor::StaticClass()))
+	{
+		return;
+	}
+
+	// Drops and weapons are spawned where things die, on the server; a client's pool would sit unused
+	if (GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	Count = FMath::Min(Count, FMath::Max(CVarPoolMaxPrewarmPerClass.GetValueOnGameThread(), 0));
+
+	FActorPoolList& Pool = Pools.FindOrAdd(ActorClass);
+	Pool.PrewarmTarget = FMath::Max(Pool.PrewarmTarget, Count);
+	if (Pool.NumOwned < Pool.PrewarmTarget)
+	{
+		PrewarmQueue.AddUnique(ActorClass);
+	}
+}
+
+bool UActorPoolSubsystem::IsInUse(const AActor* Actor) const
+{
+	const bool* bInUse = Actor ? Owned.Find(Actor) : nullptr;
+	return bInUse && *bInUse;
+}
+
+int32 UActorPoolSubsystem::GetNumFree(TSubclassOf<AActor> ActorClass) const
+{
+	const FActorPoolList* Pool = Pools.Find(ActorClass);
+	return Pool ? Pool->Free.Num() : 0;
+}
+
+int32 UActorPoolSubsystem::GetNumOwned(TSubclassOf<AActor> ActorClass) const
+{
+	const FActorPoolList* Pool = Pools.Find(ActorClass);
+	return Pool ? Pool->NumOwned : 0;
+}
+
+void UActorPoolSubsystem::ReportStats() const
+{
+	UE_LOG(LogPolarityPerf, Log, TEXT("[POOL] classes=%d actors=%d | acquires=%llu reused=%llu missed=%llu prewarmed=%llu released=%llu | prewarm queue=%d"),
+		Pools.Num(), Owned.Num(), TotalAcquires, TotalReuses, TotalMisses, TotalPrewarmed, TotalReleases, PrewarmQueue.Num());
+
+	for (const TPair<TObjectPtr<UClass>, FActorPoolList>& Pair : Pools)
+	{
+		UE_LOG(LogPolarityPerf, Log, TEXT("[POOL]   %s: owned=%d free=%d in use=%d prewarm target=%d"),
+			*GetNameSafe(Pair.Key), Pair.Value.NumOwned, Pair.Value.Free.Num(),
+			Pair.Value.NumOwned - Pair.Value.Free.Num(), Pair.Value.PrewarmTarget);
+	}
+}
+
+// ==================== Internals ====================
+
+AActor* UActorPoolSubsystem::SpawnPooledActor(UClass* ActorClass)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	const FTransform ParkingTransform(ParkingLocation);
+
+	// Deferred so the actor knows it is pooled before its BeginPlay runs
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.bDeferConstruction = true;
+
+	AActor* Actor = World->SpawnActor<AActor>(ActorClass, ParkingTransform, SpawnParams);
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	CastChecked<IPoolableActor>(Actor)->OnPoolCreated();
+	Actor->FinishSpawning(ParkingTransform);
+
+	Park(Actor);
+	Actor->OnDestroyed.AddDynamic(this, &UActorPoolSubsystem::OnPooledActorDestroyed);
+
+	Owned.Add(Actor, false);
+	++Pools.FindOrAdd(ActorClass).NumOwned;
+
+	return Actor;
+}
+
+void UActorPoolSubsystem::Park(AActor* Actor)
+{
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->SetOwner(nullptr);
+	Actor->SetInstigator(nullptr);
+	Actor->SetActorLocation(ParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+}
+
+void UActorPoolSubsystem::OnPooledActorDestroyed(AActor* DestroyedActor)
+{
+	if (Owned.Remove(DestroyedActor) == 0)
+	{
+		return;
+	}
+
+	if (FActorPoolList* Pool = Pools.Find(DestroyedActor->GetClass()))
+	{
+		--Pool->NumOwned;
+		Pool->Free.RemoveSingleSwap(DestroyedActor, EAllowShrinking::No);
+	}
+}
@@ -0,0 +1,123 @@
+// ActorPoolSubsystem.h
+// Class-keyed pool for actors that implement IPoolableActor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPoolSubsystem.generated.h"
+
+/** Wrapper struct so UPROPERTY can track pooled actors */
+USTRUCT()
+struct FActorPoolList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Free;
+
+	/** Free and in use together */
+	int32 NumOwned = 0;
+
+	/** Actors this class should have in total once the prewarm queue has caught up */
+	int32 PrewarmTarget = 0;
+};
+
+/**
+ * Drops, pickups and NPC weapons used to be spawned with SpawnActor when something died and
+ * destroyed when they were picked up or expired, so a fight paid for actor construction, component
+ * registration and BeginPlay in the frames that were already the busiest. UProjectilePoolSubsystem
+ * solved this for projectiles only, with the hooks built into AShooterProjectile.
+ *
+ * This pool does the same for any actor class that implements IPoolableActor, keyed by the exact
+ * class. Acquire hands out a parked actor (or spawns one on a miss), Release parks it again, and
+ * ReleaseOrDestroy is what a pooled-or-not actor calls instead of Destroy. Classes that do not
+ * implement the interface are spawned and destroyed as before, so a call site can switch to the
+ * pool before its actor class does.
+ *
+ * Prewarm requests are queued and created a few per frame (Pool.PrewarmPerFrame), so an arena asking
+ * for its drops up front does not become the hitch it is meant to prevent. AArenaManager requests
+ * what its waves can drop when it begins play.
+ */
+UCLASS()
+class POLARITY_API UActorPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return PrewarmQueue.Num() > 0; }
+
+	// ==================== API ====================
+
+	/**
+	 * Take an actor of exactly this class out of the pool, or spawn one if none is free.
+	 * Non-poolable classes are simply spawned. Null only if the class is null or spawning failed.
+	 */
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform,
+		AActor* Owner = nullptr, APawn* Instigator = nullptr);
+
+	template<typename T>
+	T* Acquire(TSubclassOf<T> ActorClass, const FTransform& Transform,
+		AActor* Owner = nullptr, APawn* Instigator = nullptr)
+	{
+		return Cast<T>(AcquireActor(ActorClass, Transform, Owner, Instigator));
+	}
+
+	/** Park an actor this pool handed out. False (and nothing done) if the pool does not own it or it is already parked. */
+	bool Release(AActor* Actor);
+
+	/** Release if pooled, Destroy otherwise. What a poolable actor calls where it used to call Destroy. */
+	static void ReleaseOrDestroy(AActor* Actor);
+
+	/** Make sure at least Count actors of this class exist, created over the next frames. Non-poolable classes are ignored. */
+	void RequestPrewarm(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/** Owned by this pool and currently handed out */
+	bool IsInUse(const AActor* Actor) const;
+
+	int32 GetNumFree(TSubclassOf<AActor> ActorClass) const;
+	int32 GetNumOwned(TSubclassOf<AActor> ActorClass) const;
+
+	/** Lifetime counters to the log (Pool.Report) */
+	void ReportStats() const;
+
+private:
+
+	/** Spawn one parked actor of this class; it goes on no free list */
+	AActor* SpawnPooledActor(UClass* ActorClass);
+
+	/** Hidden, no collision, no tick, no owner, at ParkingLocation */
+	void Park(AActor* Actor);
+
+	/** Somebody destroyed an actor we own (level teardown, kill volume) */
+	UFUNCTION()
+	void OnPooledActorDestroyed(AActor* DestroyedActor);
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FActorPoolList> Pools;
+
+	/** Every actor this pool created -> whether it is handed out right now */
+	TMap<TObjectKey<AActor>, bool> Owned;
+
+	/** Classes with PrewarmTarget above NumOwned, in request order */
+	TArray<TObjectPtr<UClass>> PrewarmQueue;
+
+	/** Where parked actors wait, out of sight and out of everybody's way */
+	FVector ParkingLocation = FVector(0.0f, 0.0f, -100000.0f);
+
+	// Lifetime counters for ReportStats
+	uint64 TotalAcquires = 0;
+	uint64 TotalReuses = 0;
+	uint64 TotalMisses = 0;
+	uint64 TotalPrewarmed = 0;
+	uint64 TotalReleases = 0;
+};
@@ -0,0 +1,46 @@
+// PoolableActor.h
+// Hooks an actor implements to be reused through UActorPoolSubsystem
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "PoolableActor.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UPoolableActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * An actor the pool may hand out more than once.
+ *
+ * The pool does the generic part itself: it shows or hides the actor, turns its collision and actor
+ * tick on or off, sets transform, owner and instigator, and parks it out of the way between uses.
+ * These hooks are for everything only the actor knows about — timers, registrations with other
+ * subsystems, physics simulation, and per-use state that would otherwise leak into the next user.
+ *
+ * A pooled actor runs BeginPlay once, when the pool creates it, with no owner and far from anywhere.
+ * Per-use setup therefore belongs in OnPoolActivate, and BeginPlay skips it when OnPoolCreated has
+ * been called (the same split AShooterProjectile makes with SetPooledFlag).
+ */
+class POLARITY_API IPoolableActor
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Created by the pool: called after construction and before BeginPlay */
+	virtual void OnPoolCreated() = 0;
+
+	/** Taken out of the pool. Transform, owner and instigator are set; the actor is visible, collides and ticks. */
+	virtual void OnPoolActivate() = 0;
+
+	/** Going back into the pool: stop timers, leave subsystems, stop simulating. The pool hides and parks it afterwards. */
+	virtual void OnPoolDeactivate() = 0;
+
+	/** Put per-use state back to what a fresh actor has. Called right after OnPoolDeactivate. */
+	virtual void OnPoolReset() = 0;
+};
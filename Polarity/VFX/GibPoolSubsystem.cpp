@@ -0,0 +1,403 @@
+// GibPoolSubsystem.cpp
+
+#include "GibPoolSubsystem.h"
+#include "GeometryCollection/GeometryCollectionActor.h"
+#include "GeometryCollection/GeometryCollectionComponent.h"
+#include "GeometryCollection/GeometryCollectionObject.h"
+#include "Field/FieldSystemObjects.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarGibsPrewarmCount(
+	TEXT("Gibs.PrewarmCount"),
+	2,
+	TEXT("Geometry-collection actors made ahead of time per collection a prop or NPC in the level uses"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGibsMaxSimulating(
+	TEXT("Gibs.MaxSimulating"),
+	24,
+	TEXT("Gib bursts simulating at once; past this the oldest simulating one goes back to the pool"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGibsMaxActive(
+	TEXT("Gibs.MaxActive"),
+	96,
+	TEXT("Gib bursts out at all, settled ones included; past this the oldest goes back to the pool"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GGibsReportCmd(
+	TEXT("Gibs.Report"),
+	TEXT("Print gib pool sizes, reuse and early recycling since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UGibPoolSubsystem* Pool = World ? World->GetSubsystem<UGibPoolSubsystem>() : nullptr)
+		{
+			Pool->ReportStats();
+		}
+	}));
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UGibPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Create for all game worlds, skip editor preview worlds
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UGibPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	StrainField = NewObject<UUniformScalar>(this);
+	RadialVelocityField = NewObject<URadialVector>(this);
+	AngularVelocityField = NewObject<URadialVector>(this);
+	BiasField = NewObject<UUniformVector>(this);
+
+	// Break all clusters
+	StrainField->Magnitude = 999999.0f;
+}
+
+void UGibPoolSubsystem::Deinitialize()
+{
+	// Actors are destroyed with the world
+	Pools.Empty();
+	Active.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UGibPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGibPoolSubsystem, STATGROUP_Tickables);
+}
+
+void UGibPoolSubsystem::Tick(float DeltaTime)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (int32 i = 0; i < Active.Num(); )
+	{
+		FActiveGibs& Gibs = Active[i];
+
+		// Destroyed under us (level teardown, somebody's Destroy)
+		if (!Gibs.Actor.IsValid())
+		{
+			if (FGibActorPool* Pool = Pools.Find(Gibs.RestCollection))
+			{
+				--Pool->NumOwned;
+			}
+			Active.RemoveAt(i, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Gibs.ReleaseTime > 0.0 && Now >= Gibs.ReleaseTime)
+		{
+			ReturnToPool(i);
+			continue;
+		}
+
+		if (Gibs.SettleTime > 0.0 && Now >= Gibs.SettleTime)
+		{
+			Settle(Gibs);
+		}
+		++i;
+	}
+}
+
+// ==================== API ====================
+
+void UGibPoolSubsystem::Prewarm(UGeometryCollection* RestCollection, int32 Count)
+{
+	if (!RestCollection)
+	{
+		return;
+	}
+
+	if (Count < 0)
+	{
+		Count = CVarGibsPrewarmCount.GetValueOnGameThread();
+	}
+
+	FGibActorPool& Pool = Pools.FindOrAdd(RestCollection);
+	while (Pool.NumOwned < Count)
+	{
+		AGeometryCollectionActor* GCActor = CreatePooledActor(RestCollection);
+		if (!GCActor)
+		{
+			return;
+		}
+		Pool.Free.Add(GCActor);
+	}
+}
+
+FGibHandle UGibPoolSubsystem::SpawnGibs(const FGibSpawnParams& Params)
+{
+	FGibHandle Handle;
+	if (!Params.RestCollection)
+	{
+		return Handle;
+	}
+
+	EnforceCaps();
+
+	FGibActorPool& Pool = Pools.FindOrAdd(Params.RestCollection);
+	AGeometryCollectionActor* GCActor = nullptr;
+	while (!GCActor && Pool.Free.Num() > 0)
+	{
+		GCActor = Pool.Free.Pop(EAllowShrinking::No);
+		if (!IsValid(GCActor))
+		{
+			GCActor = nullptr;
+			--Pool.NumOwned;
+		}
+	}
+
+	if (GCActor)
+	{
+		++TotalReuses;
+	}
+	else
+	{
+		GCActor = CreatePooledActor(Params.RestCollection);
+		if (!GCActor)
+		{
+			return Handle;
+		}
+		++TotalSpawns;
+	}
+
+	UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
+
+	GCActor->SetActorTransform(Params.Transform, false, nullptr, ETeleportType::ResetPhysics);
+	GCActor->SetActorHiddenInGame(false);
+
+	// Collision: gibs should not push pawns or block camera
+	GCComp->SetCollisionProfileName(Params.CollisionProfile);
+	GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+	GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+	GCComp->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
+	GCComp->SetAngularDamping(Pool.DefaultAngularDamping);
+
+	// Reassigning the rest collection resets the pieces a previous burst scattered
+	GCComp->SetRestCollection(Params.RestCollection);
+
+	// The previous user's materials may not be ours (generic collections take the owner's)
+	GCComp->EmptyOverrideMaterials();
+	for (int32 i = 0; i < Params.Materials.Num(); i++)
+	{
+		if (Params.Materials[i])
+		{
+			GCComp->SetMaterial(i, Params.Materials[i]);
+		}
+	}
+
+	GCComp->SetSimulatePhysics(true);
+	GCComp->RecreatePhysicsState();
+
+	// Break all clusters
+	GCComp->ApplyPhysicsField(true,
+		EGeometryCollectionPhysicsTypeEnum::Chaos_ExternalClusterStrain,
+		nullptr, StrainField);
+
+	// Scatter pieces radially from the field origin
+	RadialVelocityField->Magnitude = Params.RadialSpeed;
+	RadialVelocityField->Position = Params.FieldOrigin;
+	GCComp->ApplyPhysicsField(true,
+		EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
+		nullptr, RadialVelocityField);
+
+	// Angular velocity for tumbling
+	AngularVelocityField->Magnitude = Params.AngularSpeed;
+	AngularVelocityField->Position = Params.FieldOrigin;
+	GCComp->ApplyPhysicsField(true,
+		EGeometryCollectionPhysicsTypeEnum::Chaos_AngularVelocity,
+		nullptr, AngularVelocityField);
+
+	// Directional bias from killing hit direction
+	if (Params.BiasSpeed > 0.0f && !Params.BiasDirection.IsNearlyZero())
+	{
+		BiasField->Magnitude = Params.BiasSpeed;
+		BiasField->Direction = Params.BiasDirection;
+		GCComp->ApplyPhysicsField(true,
+			EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
+			nullptr, BiasField);
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	FActiveGibs& Gibs = Active.AddDefaulted_GetRef();
+	Gibs.Actor = GCActor;
+	Gibs.RestCollection = Params.RestCollection;
+	Gibs.Serial = NextSerial++;
+	Gibs.SettleTime = Params.SettleAfter > 0.0f ? Now + Params.SettleAfter : 0.0;
+	Gibs.ReleaseTime = Params.Lifetime > 0.0f ? Now + Params.Lifetime : 0.0;
+	Gibs.bSimulating = true;
+
+	if (NextSerial == 0)
+	{
+		NextSerial = 1;
+	}
+
+	Handle.Actor = GCActor;
+	Handle.Serial = Gibs.Serial;
+	return Handle;
+}
+
+void UGibPoolSubsystem::ReleaseGibs(const FGibHandle& Handle)
+{
+	if (!Handle.IsSet())
+	{
+		return;
+	}
+
+	const int32 Index = Active.IndexOfByPredicate([&Handle](const FActiveGibs& Gibs) { return Gibs.Serial == Handle.Serial; });
+	if (Index != INDEX_NONE)
+	{
+		ReturnToPool(Index);
+	}
+}
+
+void UGibPoolSubsystem::ReportStats() const
+{
+	int32 NumFree = 0;
+	int32 NumOwned = 0;
+	for (const TPair<TObjectPtr<UGeometryCollection>, FGibActorPool>& Pair : Pools)
+	{
+		NumFree += Pair.Value.Free.Num();
+		NumOwned += Pair.Value.NumOwned;
+	}
+
+	int32 NumSimulating = 0;
+	for (const FActiveGibs& Gibs : Active)
+	{
+		NumSimulating += Gibs.bSimulating ? 1 : 0;
+	}
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[GIBS] collections=%d actors=%d free=%d active=%d simulating=%d | bursts=%llu reused=%llu spawned=%llu recycled early=%llu"),
+		Pools.Num(), NumOwned, NumFree, Active.Num(), NumSimulating,
+		TotalReuses + TotalSpawns, TotalReuses, TotalSpawns, TotalRecycledEarly);
+}
+
+// ==================== Internals ====================
+
+AGeometryCollectionActor* UGibPoolSubsystem::CreatePooledActor(UGeometryCollection* RestCollection)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AGeometryCollectionActor* GCActor = GetWorld()->SpawnActor<AGeometryCollectionActor>(
+		ParkingLocation, FRotator::ZeroRotator, SpawnParams);
+
+	if (!GCActor)
+	{
+		return nullptr;
+	}
+
+	UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
+	if (!GCComp)
+	{
+		GCActor->Destroy();
+		return nullptr;
+	}
+
+	GCComp->SetSimulatePhysics(false);
+	GCComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	GCComp->SetRestCollection(RestCollection);
+	GCActor->SetActorHiddenInGame(true);
+
+	FGibActorPool& Pool = Pools.FindOrAdd(RestCollection);
+	if (Pool.NumOwned == 0)
+	{
+		Pool.DefaultAngularDamping = GCComp->GetAngularDamping();
+	}
+	++Pool.NumOwned;
+
+	return GCActor;
+}
+
+void UGibPoolSubsystem::ReturnToPool(int32 ActiveIndex)
+{
+	const FActiveGibs Gibs = Active[ActiveIndex];
+	Active.RemoveAt(ActiveIndex, EAllowShrinking::No);
+
+	FGibActorPool* Pool = Pools.Find(Gibs.RestCollection);
+	AGeometryCollectionActor* GCActor = Gibs.Actor.Get();
+	if (!GCActor)
+	{
+		if (Pool)
+		{
+			--Pool->NumOwned;
+		}
+		return;
+	}
+
+	if (UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent())
+	{
+		GCComp->SetSimulatePhysics(false);
+		GCComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+	GCActor->SetActorHiddenInGame(true);
+	GCActor->SetActorLocation(ParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+
+	if (Pool)
+	{
+		Pool->Free.Add(GCActor);
+	}
+}
+
+void UGibPoolSubsystem::Settle(FActiveGibs& Gibs)
+{
+	Gibs.SettleTime = 0.0;
+	Gibs.bSimulating = false;
+
+	AGeometryCollectionActor* GCActor = Gibs.Actor.Get();
+	UGeometryCollectionComponent* GCComp = GCActor ? GCActor->GetGeometryCollectionComponent() : nullptr;
+	if (!GCComp)
+	{
+		return;
+	}
+
+	// Don't hard-freeze (SetSimulatePhysics(false)) — that leaves airborne pieces floating.
+	// Instead: strip all collision except WorldStatic so pieces can only rest on floors/walls.
+	// High linear damping makes them settle quickly. Chaos auto-sleeps stationary bodies,
+	// and sleeping rigid bodies cost near-zero (no solver iterations, no broadphase).
+	GCComp->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
+	GCComp->SetCollisionResponseToAllChannels(ECR_Ignore);
+	GCComp->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
+	GCComp->SetAngularDamping(5.0f);
+}
+
+void UGibPoolSubsystem::EnforceCaps()
+{
+	const int32 MaxActive = FMath::Max(CVarGibsMaxActive.GetValueOnGameThread(), 1);
+	while (Active.Num() >= MaxActive)
+	{
+		ReturnToPool(0);
+		++TotalRecycledEarly;
+	}
+
+	const int32 MaxSimulating = FMath::Max(CVarGibsMaxSimulating.GetValueOnGameThread(), 1);
+	int32 NumSimulating = 0;
+	for (const FActiveGibs& Gibs : Active)
+	{
+		NumSimulating += Gibs.bSimulating ? 1 : 0;
+	}
+
+	for (int32 i = 0; i < Active.Num() && NumSimulating >= MaxSimulating; )
+	{
+		if (!Active[i].bSimulating)
+		{
+			++i;
+			continue;
+		}
+		ReturnToPool(i);
+		++TotalRecycledEarly;
+		--NumSimulating;
+	}
+}
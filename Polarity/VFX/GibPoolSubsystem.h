@@ -0,0 +1,175 @@
+// GibPoolSubsystem.h
+// Pooled geometry-collection gibs for prop and NPC destruction
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GibPoolSubsystem.generated.h"
+
+class AGeometryCollectionActor;
+class UGeometryCollection;
+class UMaterialInterface;
+class UUniformScalar;
+class URadialVector;
+class UUniformVector;
+
+/** Everything one burst of gibs needs; filled in by whoever is being destroyed */
+struct FGibSpawnParams
+{
+	UGeometryCollection* RestCollection = nullptr;
+
+	/** World transform of the mesh being replaced, scale included */
+	FTransform Transform = FTransform::Identity;
+
+	/** Collision profile; Pawn, Camera and Visibility are ignored on top of it */
+	FName CollisionProfile = FName("Ragdoll");
+
+	/** Material overrides by slot; null slots keep the collection's own */
+	TArray<UMaterialInterface*, TInlineAllocator<8>> Materials;
+
+	/** Radial scatter and tumble, centred on FieldOrigin */
+	FVector FieldOrigin = FVector::ZeroVector;
+	float RadialSpeed = 0.0f;
+	float AngularSpeed = 0.0f;
+
+	/** Extra uniform push along BiasDirection (killing hit); none if BiasSpeed is 0 */
+	FVector BiasDirection = FVector::ZeroVector;
+	float BiasSpeed = 0.0f;
+
+	/** Seconds of full simulation before the pieces settle (collide with WorldStatic only, heavy damping); 0 = never */
+	float SettleAfter = 0.0f;
+
+	/** Seconds until the gibs go back to the pool; 0 = keep them until the pool needs them back */
+	float Lifetime = 0.0f;
+};
+
+/** A burst handed out by the pool. The actor is reused, so Serial tells this burst from later ones. */
+struct FGibHandle
+{
+	TWeakObjectPtr<AGeometryCollectionActor> Actor;
+	uint32 Serial = 0;
+
+	bool IsSet() const { return Serial != 0; }
+	void Reset() { Actor.Reset(); Serial = 0; }
+};
+
+/** Wrapper struct so UPROPERTY can track pooled actors */
+USTRUCT()
+struct FGibActorPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AGeometryCollectionActor>> Free;
+
+	/** Free and in use together, for prewarm targets */
+	int32 NumOwned = 0;
+
+	/** Angular damping of a fresh actor, put back after a settle raised it */
+	float DefaultAngularDamping = 0.0f;
+};
+
+/**
+ * Every prop and NPC death used to spawn a fresh AGeometryCollectionActor, create three or four
+ * field objects with NewObject, and destroy the actor by timer or lifespan a few seconds later.
+ * A room of things dying at once paid for all of that in the frames they died in, and nothing
+ * capped how many gib sets were simulating together.
+ *
+ * The pool keeps hidden geometry-collection actors per rest collection, prewarmed when a prop or
+ * NPC that uses the collection begins play. A burst takes one, resets it by reassigning the rest
+ * collection (pieces back to their rest pose, clusters whole), moves it into place and applies the
+ * fields. The field objects are the pool's own and reused for every burst: ApplyPhysicsField builds
+ * its evaluation graph from their values at call time and does not keep them.
+ *
+ * The pool settles and releases gibs itself, which replaces the per-owner freeze timers and actor
+ * lifespans. At most Gibs.MaxSimulating bursts simulate at once and at most Gibs.MaxActive are
+ * out at all; past either the oldest one is taken back first, so a massacre costs the newest gibs'
+ * worth of physics rather than all of them.
+ */
+UCLASS()
+class POLARITY_API UGibPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Active.Num() > 0; }
+
+	// ==================== API ====================
+
+	/** Make sure at least Count actors exist for this collection (Gibs.PrewarmCount if Count < 0) */
+	void Prewarm(UGeometryCollection* RestCollection, int32 Count = -1);
+
+	/** Break a collection apart at Params.Transform. Unset handle if there is no collection or the actor could not be made. */
+	FGibHandle SpawnGibs(const FGibSpawnParams& Params);
+
+	/** Take a burst back early (owner respawned). No-op if the pool already recycled it. */
+	void ReleaseGibs(const FGibHandle& Handle);
+
+	/** Lifetime counters to the log (Gibs.Report) */
+	void ReportStats() const;
+
+private:
+	struct FActiveGibs
+	{
+		TWeakObjectPtr<AGeometryCollectionActor> Actor;
+
+		/** Pool it goes back to; kept alive as a key of Pools */
+		UGeometryCollection* RestCollection = nullptr;
+		uint32 Serial = 0;
+
+		/** World time to settle (0 = never, or already settled) and to release (0 = never) */
+		double SettleTime = 0.0;
+		double ReleaseTime = 0.0;
+
+		bool bSimulating = true;
+	};
+
+	AGeometryCollectionActor* CreatePooledActor(UGeometryCollection* RestCollection);
+
+	/** Hide, stop and park an actor; it goes back on its collection's free list */
+	void ReturnToPool(int32 ActiveIndex);
+
+	void Settle(FActiveGibs& Gibs);
+
+	/** Take the oldest burst back if spawning one more would break a cap */
+	void EnforceCaps();
+
+	UPROPERTY()
+	TMap<TObjectPtr<UGeometryCollection>, FGibActorPool> Pools;
+
+	/** In use, oldest first */
+	TArray<FActiveGibs> Active;
+
+	/** Reused for every burst */
+	UPROPERTY()
+	TObjectPtr<UUniformScalar> StrainField;
+
+	UPROPERTY()
+	TObjectPtr<URadialVector> RadialVelocityField;
+
+	UPROPERTY()
+	TObjectPtr<URadialVector> AngularVelocityField;
+
+	UPROPERTY()
+	TObjectPtr<UUniformVector> BiasField;
+
+	/** Where parked actors wait, out of sight and out of everybody's way */
+	FVector ParkingLocation = FVector(0.0f, 0.0f, -100000.0f);
+
+	uint32 NextSerial = 1;
+
+	// Lifetime counters for ReportStats
+	uint64 TotalSpawns = 0;
+	uint64 TotalReuses = 0;
+	uint64 TotalRecycledEarly = 0;
+};
@@ -0,0 +1,424 @@
+// VFXManagerSubsystem.cpp
+
+#include "VFXManagerSubsystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Stats/Stats.h"
+#include "PolarityPerfLog.h"
+
+DECLARE_STATS_GROUP(TEXT("VFX Budget"), STATGROUP_VFXBudget, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Effects"), STAT_VFX_Active, STATGROUP_VFXBudget);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawned"), STAT_VFX_Spawned, STATGROUP_VFXBudget);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Culled (Distance)"), STAT_VFX_CulledDistance, STATGROUP_VFXBudget);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Culled (Budget)"), STAT_VFX_CulledBudget, STATGROUP_VFXBudget);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Evicted"), STAT_VFX_Evicted, STATGROUP_VFXBudget);
+
+static TAutoConsoleVariable<int32> CVarVFXPooling(
+	TEXT("VFX.Pooling"),
+	1,
+	TEXT("1=managed effects come from the Niagara component pool, 0=a fresh component per effect"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarVFXMaxActive(
+	TEXT("VFX.MaxActive"),
+	200,
+	TEXT("Managed effects alive at once before new ones have to displace old ones (0 = no limit)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarVFXMaxPerSystem(
+	TEXT("VFX.MaxPerSystem"),
+	24,
+	TEXT("Managed effects of one Niagara asset alive at once (0 = no limit)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarVFXCullDistance(
+	TEXT("VFX.CullDistance"),
+	8000.0f,
+	TEXT("Medium effects further than this from every local camera are not spawned; Low at half, High at double, Critical never (0 = off)"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GVFXReportCmd(
+	TEXT("VFX.Report"),
+	TEXT("Print managed effect counts, culls and evictions since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UVFXManagerSubsystem* VFX = World ? World->GetSubsystem<UVFXManagerSubsystem>() : nullptr)
+		{
+			VFX->ReportStats();
+		}
+	}));
+
+namespace
+{
+	/** Relative weight when two effects compete for a slot */
+	float SignificanceWeight(EVFXSignificance Significance)
+	{
+		switch (Significance)
+		{
+		case EVFXSignificance::Low:		return 1.0f;
+		case EVFXSignificance::Medium:	return 2.0f;
+		case EVFXSignificance::High:	return 4.0f;
+		default:						return 8.0f;
+		}
+	}
+
+	float CullDistanceScale(EVFXSignificance Significance)
+	{
+		switch (Significance)
+		{
+		case EVFXSignificance::Low:		return 0.5f;
+		case EVFXSignificance::High:	return 2.0f;
+		default:						return 1.0f;
+		}
+	}
+
+	ENCPoolMethod GetPoolMethod()
+	{
+		return CVarVFXPooling.GetValueOnGameThread() ? ENCPoolMethod::AutoRelease : ENCPoolMethod::None;
+	}
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UVFXManagerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Create for all game worlds, skip editor preview worlds
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UVFXManagerSubsystem::Deinitialize()
+{
+	// Components belong to Niagara's pool and go with the world
+	Active.Empty();
+	ActivePerSystem.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UVFXManagerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVFXManagerSubsystem, STATGROUP_Tickables);
+}
+
+void UVFXManagerSubsystem::Tick(float DeltaTime)
+{
+	PruneFinished();
+	SET_DWORD_STAT(STAT_VFX_Active, Active.Num());
+}
+
+// ==================== API ====================
+
+UNiagaraComponent* UVFXManagerSubsystem::SpawnSystemAtLocation(const UObject* WorldContextObject, UNiagaraSystem* System,
+	const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAutoActivate,
+	EVFXSignificance Significance)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if (!System || !World)
+	{
+		return nullptr;
+	}
+
+	// No manager (not a game world): spawn the way the call site always did
+	UVFXManagerSubsystem* Manager = World->GetSubsystem<UVFXManagerSubsystem>();
+	if (!Manager)
+	{
+		return UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+			World, System, Location, Rotation, Scale, true, bAutoActivate, ENCPoolMethod::None);
+	}
+
+	if (!Manager->Admit(System, Location, Significance))
+	{
+		return nullptr;
+	}
+
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		World, System, Location, Rotation, Scale, true, bAutoActivate, GetPoolMethod());
+
+	if (Component)
+	{
+		Manager->Track(Component, System, Location, Significance);
+	}
+	return Component;
+}
+
+UNiagaraComponent* UVFXManagerSubsystem::SpawnSystemAttached(UNiagaraSystem* System, USceneComponent* AttachTo,
+	FName SocketName, const FVector& Scale, EVFXSignificance Significance)
+{
+	UWorld* World = AttachTo ? AttachTo->GetWorld() : nullptr;
+	if (!System || !World)
+	{
+		return nullptr;
+	}
+
+	UVFXManagerSubsystem* Manager = World->GetSubsystem<UVFXManagerSubsystem>();
+	if (!Manager)
+	{
+		return UNiagaraFunctionLibrary::SpawnSystemAttached(System, AttachTo, SocketName,
+			FVector::ZeroVector, FRotator::ZeroRotator, Scale, EAttachLocation::SnapToTarget, true, ENCPoolMethod::None);
+	}
+
+	const FVector Location = AttachTo->GetSocketLocation(SocketName);
+	if (!Manager->Admit(System, Location, Significance))
+	{
+		return nullptr;
+	}
+
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAttached(System, AttachTo, SocketName,
+		FVector::ZeroVector, FRotator::ZeroRotator, Scale, EAttachLocation::SnapToTarget, true, GetPoolMethod());
+
+	if (Component)
+	{
+		Manager->Track(Component, System, Location, Significance);
+	}
+	return Component;
+}
+
+FVFXHandle UVFXManagerSubsystem::GetHandle(UNiagaraComponent* Component) const
+{
+	FVFXHandle Handle;
+	if (!Component)
+	{
+		return Handle;
+	}
+
+	// Newest first: a reused component's latest entry is the one that counts
+	for (int32 i = Active.Num() - 1; i >= 0; --i)
+	{
+		if (Active[i].Component.Get() == Component)
+		{
+			Handle.Component = Component;
+			Handle.Serial = Active[i].Serial;
+			break;
+		}
+	}
+	return Handle;
+}
+
+void UVFXManagerSubsystem::DeactivateEffect(const FVFXHandle& Handle)
+{
+	UNiagaraComponent* Component = Handle.Component.Get();
+	if (!Handle.IsSet() || !Component)
+	{
+		return;
+	}
+
+	for (int32 i = Active.Num() - 1; i >= 0; --i)
+	{
+		if (Active[i].Serial == Handle.Serial)
+		{
+			if (Active[i].Component.Get() == Component && Component->IsActive())
+			{
+				Component->Deactivate();
+			}
+			return;
+		}
+	}
+}
+
+void UVFXManagerSubsystem::ReportStats() const
+{
+	UE_LOG(LogPolarityPerf, Log, TEXT("[VFX] active=%d peak=%d | requested=%llu spawned=%llu culled distance=%llu culled budget=%llu evicted=%llu | pooling=%d max=%d per system=%d cull=%.0f"),
+		Active.Num(), PeakActive, TotalRequested, TotalSpawned, TotalCulledDistance, TotalCulledBudget, TotalEvicted,
+		CVarVFXPooling.GetValueOnGameThread(), CVarVFXMaxActive.GetValueOnGameThread(),
+		CVarVFXMaxPerSystem.GetValueOnGameThread(), CVarVFXCullDistance.GetValueOnGameThread());
+
+	for (const TPair<TObjectKey<UNiagaraSystem>, int32>& Pair : ActivePerSystem)
+	{
+		UE_LOG(LogPolarityPerf, Log, TEXT("[VFX]   %s: active=%d"), *GetNameSafe(Pair.Key.ResolveObjectPtr()), Pair.Value);
+	}
+}
+
+// ==================== Internals ====================
+
+bool UVFXManagerSubsystem::Admit(UNiagaraSystem* System, const FVector& Location, EVFXSignificance Significance)
+{
+	++TotalRequested;
+
+	UWorld* World = GetWorld();
+	if (World->GetNetMode() == NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	if (Significance == EVFXSignificance::Critical)
+	{
+		return true;
+	}
+
+	const float CullDistance = CVarVFXCullDistance.GetValueOnGameThread();
+	if (CullDistance > 0.0f && DistanceToViewer(Location) > CullDistance * CullDistanceScale(Significance))
+	{
+		++TotalCulledDistance;
+		INC_DWORD_STAT(STAT_VFX_CulledDistance);
+		return false;
+	}
+
+	const int32 MaxActive = CVarVFXMaxActive.GetValueOnGameThread();
+	const int32 MaxPerSystem = CVarVFXMaxPerSystem.GetValueOnGameThread();
+	const int32* SystemCount = ActivePerSystem.Find(System);
+
+	const bool bOverSystem = MaxPerSystem > 0 && SystemCount && *SystemCount >= MaxPerSystem;
+	const bool bOverGlobal = MaxActive > 0 && Active.Num() >= MaxActive;
+	if (!bOverSystem && !bOverGlobal)
+	{
+		return true;
+	}
+
+	// Entries that finished since the last tick may be all the room we need
+	PruneFinished();
+
+	SystemCount = ActivePerSystem.Find(System);
+	const bool bStillOverSystem = MaxPerSystem > 0 && SystemCount && *SystemCount >= MaxPerSystem;
+	const bool bStillOverGlobal = MaxActive > 0 && Active.Num() >= MaxActive;
+	if (!bStillOverSystem && !bStillOverGlobal)
+	{
+		return true;
+	}
+
+	// Over the asset's cap only an effect of the same asset can make room; over the global cap any can
+	const TObjectKey<UNiagaraSystem> SystemKey(System);
+	int32 VictimIndex = INDEX_NONE;
+	float VictimScore = Score(Significance, Location);
+	for (int32 i = 0; i < Active.Num(); ++i)
+	{
+		const FActiveVFX& Entry = Active[i];
+		if (Entry.Significance == EVFXSignificance::Critical || (bStillOverSystem && Entry.System != SystemKey))
+		{
+			continue;
+		}
+
+		const float EntryScore = Score(Entry.Significance, Entry.Location);
+		if (EntryScore < VictimScore)
+		{
+			VictimScore = EntryScore;
+			VictimIndex = i;
+		}
+	}
+
+	if (VictimIndex == INDEX_NONE)
+	{
+		++TotalCulledBudget;
+		INC_DWORD_STAT(STAT_VFX_CulledBudget);
+		return false;
+	}
+
+	// Immediate: the slot is needed this frame, and a pooled component goes back as soon as it stops
+	if (UNiagaraComponent* VictimComponent = Active[VictimIndex].Component.Get())
+	{
+		VictimComponent->DeactivateImmediate();
+	}
+	RemoveActiveAt(VictimIndex);
+
+	++TotalEvicted;
+	INC_DWORD_STAT(STAT_VFX_Evicted);
+	return true;
+}
+
+void UVFXManagerSubsystem::Track(UNiagaraComponent* Component, UNiagaraSystem* System, const FVector& Location,
+	EVFXSignificance Significance)
+{
+	// A pooled component can come back before our tick noticed it finished; the old entry is stale
+	for (int32 i = Active.Num() - 1; i >= 0; --i)
+	{
+		if (Active[i].Component.Get() == Component)
+		{
+			RemoveActiveAt(i);
+			break;
+		}
+	}
+
+	FActiveVFX& Entry = Active.AddDefaulted_GetRef();
+	Entry.Component = Component;
+	Entry.System = System;
+	Entry.Location = Location;
+	Entry.Significance = Significance;
+	Entry.Serial = NextSerial++;
+	if (NextSerial == 0)
+	{
+		NextSerial = 1;
+	}
+
+	++ActivePerSystem.FindOrAdd(System);
+
+	++TotalSpawned;
+	INC_DWORD_STAT(STAT_VFX_Spawned);
+	PeakActive = FMath::Max(PeakActive, Active.Num());
+}
+
+void UVFXManagerSubsystem::PruneFinished()
+{
+	for (int32 i = Active.Num() - 1; i >= 0; --i)
+	{
+		const FActiveVFX& Entry = Active[i];
+		const UNiagaraComponent* Component = Entry.Component.Get();
+		if (!Component || !Component->IsActive() || TObjectKey<UNiagaraSystem>(Component->GetAsset()) != Entry.System)
+		{
+			RemoveActiveAt(i);
+		}
+	}
+}
+
+void UVFXManagerSubsystem::RemoveActiveAt(int32 Index)
+{
+	if (int32* Count = ActivePerSystem.Find(Active[Index].System))
+	{
+		if (--*Count <= 0)
+		{
+			ActivePerSystem.Remove(Active[Index].System);
+		}
+	}
+
+	// Order matters for GetHandle (newest last), so no swap
+	Active.RemoveAt(Index, EAllowShrinking::No);
+}
+
+float UVFXManagerSubsystem::Score(EVFXSignificance Significance, const FVector& Location) const
+{
+	return SignificanceWeight(Significance) / (1.0f + DistanceToViewer(Location) / 1000.0f);
+}
+
+float UVFXManagerSubsystem::DistanceToViewer(const FVector& Location) const
+{
+	RefreshViewpoints();
+
+	if (Viewpoints.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	float BestDistSq = TNumericLimits<float>::Max();
+	for (const FVector& Viewpoint : Viewpoints)
+	{
+		BestDistSq = FMath::Min(BestDistSq, FVector::DistSquared(Viewpoint, Location));
+	}
+	return FMath::Sqrt(BestDistSq);
+}
+
+void UVFXManagerSubsystem::RefreshViewpoints() const
+{
+	if (ViewpointsFrame == GFrameCounter)
+	{
+		return;
+	}
+	ViewpointsFrame = GFrameCounter;
+
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+		{
+			Viewpoints.Add(PC->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+}
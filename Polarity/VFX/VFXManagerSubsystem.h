@@ -0,0 +1,156 @@
+// VFXManagerSubsystem.h
+// Pooled Niagara spawns for combat effects, with per-system and global budgets
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VFXManagerSubsystem.generated.h"
+
+class UNiagaraSystem;
+class UNiagaraComponent;
+class USceneComponent;
+
+/** How much an effect matters when the budget is full. Critical effects are never culled. */
+UENUM(BlueprintType)
+enum class EVFXSignificance : uint8
+{
+	/** Decoration: wave fronts, secondary sparks */
+	Low,
+
+	/** Most impacts and hit reactions */
+	Medium,
+
+	/** What the local player caused or has to read: their own shots, big explosions */
+	High,
+
+	/** Gameplay depends on seeing it (a dodgeable bolt): always spawned, never evicted */
+	Critical
+};
+
+/** An effect handed out by the manager. Pooled components are reused, so Serial tells this effect from later ones. */
+struct FVFXHandle
+{
+	TWeakObjectPtr<UNiagaraComponent> Component;
+	uint32 Serial = 0;
+
+	bool IsSet() const { return Serial != 0; }
+	void Reset() { Component.Reset(); Serial = 0; }
+};
+
+/**
+ * Muzzle flashes, tracers, impacts and NPC collision effects used to be spawned with
+ * UNiagaraFunctionLibrary and ENCPoolMethod::None, so every one of them created and registered a
+ * fresh component and destroyed it a second later, and nothing bounded how many were alive. A
+ * shotgun volley into a crowd spawned a component per pellet per observer on top of everything the
+ * NPCs were doing.
+ *
+ * Effects spawned through here come out of Niagara's own component pool (AutoRelease: the
+ * component goes back to the pool when the system completes, with its user parameters reset to
+ * the asset defaults). Before spawning, the manager checks the effect against two budgets,
+ * VFX.MaxActive overall and VFX.MaxPerSystem for its asset, and against VFX.CullDistance from the
+ * nearest local viewpoint. An effect past the cull distance is not spawned. An effect over budget
+ * takes the place of the least significant active one if it scores higher (significance, falling
+ * off with distance), and is dropped otherwise. Critical effects skip all of it.
+ *
+ * A dedicated server draws nothing, so every spawn there is culled before Niagara sees it.
+ * Counters are in "stat VFXBudget" per frame and in VFX.Report since the level started.
+ */
+UCLASS()
+class POLARITY_API UVFXManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Active.Num() > 0; }
+
+	// ==================== API ====================
+
+	/**
+	 * Drop-in for UNiagaraFunctionLibrary::SpawnSystemAtLocation with pooling and budgets.
+	 * Null if the effect was culled, so call sites keep their null checks. An effect spawned with
+	 * bAutoActivate false must be activated by the caller in the same frame, or it never completes
+	 * and never goes back to the pool.
+	 */
+	static UNiagaraComponent* SpawnSystemAtLocation(const UObject* WorldContextObject, UNiagaraSystem* System,
+		const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator,
+		const FVector& Scale = FVector::OneVector, bool bAutoActivate = true,
+		EVFXSignificance Significance = EVFXSignificance::Medium);
+
+	/** Drop-in for UNiagaraFunctionLibrary::SpawnSystemAttached (snapped to the socket) with pooling and budgets */
+	static UNiagaraComponent* SpawnSystemAttached(UNiagaraSystem* System, USceneComponent* AttachTo,
+		FName SocketName, const FVector& Scale = FVector::OneVector,
+		EVFXSignificance Significance = EVFXSignificance::Medium);
+
+	/** Handle for a component this manager spawned and is still tracking; unset otherwise */
+	FVFXHandle GetHandle(UNiagaraComponent* Component) const;
+
+	/** Let an effect finish early (Deactivate, so what is drawn fades out). No-op if its component has moved on to another effect. */
+	void DeactivateEffect(const FVFXHandle& Handle);
+
+	int32 GetNumActive() const { return Active.Num(); }
+
+	/** Lifetime counters to the log (VFX.Report) */
+	void ReportStats() const;
+
+private:
+
+	struct FActiveVFX
+	{
+		TWeakObjectPtr<UNiagaraComponent> Component;
+
+		/** Asset it was spawned for; a pooled component that now runs another asset is no longer this effect */
+		TObjectKey<UNiagaraSystem> System;
+
+		FVector Location = FVector::ZeroVector;
+		EVFXSignificance Significance = EVFXSignificance::Medium;
+		uint32 Serial = 0;
+	};
+
+	/** Budget and distance check for one effect about to be spawned; may evict an active one to make room */
+	bool Admit(UNiagaraSystem* System, const FVector& Location, EVFXSignificance Significance);
+
+	void Track(UNiagaraComponent* Component, UNiagaraSystem* System, const FVector& Location, EVFXSignificance Significance);
+
+	/** Drop entries whose component finished, was destroyed or was reused for something else */
+	void PruneFinished();
+
+	void RemoveActiveAt(int32 Index);
+
+	/** Higher is more worth keeping */
+	float Score(EVFXSignificance Significance, const FVector& Location) const;
+
+	/** Distance to the nearest local player camera; 0 when there is none */
+	float DistanceToViewer(const FVector& Location) const;
+
+	/** Local player camera locations, gathered once per frame */
+	void RefreshViewpoints() const;
+
+	/** In spawn order */
+	TArray<FActiveVFX> Active;
+
+	/** Active entries per asset, for VFX.MaxPerSystem */
+	TMap<TObjectKey<UNiagaraSystem>, int32> ActivePerSystem;
+
+	mutable TArray<FVector, TInlineAllocator<4>> Viewpoints;
+	mutable uint64 ViewpointsFrame = MAX_uint64;
+
+	uint32 NextSerial = 1;
+
+	// Lifetime counters for ReportStats
+	uint64 TotalRequested = 0;
+	uint64 TotalSpawned = 0;
+	uint64 TotalCulledDistance = 0;
+	uint64 TotalCulledBudget = 0;
+	uint64 TotalEvicted = 0;
+	int32 PeakActive = 0;
+};
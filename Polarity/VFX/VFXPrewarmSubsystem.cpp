@@ -91,6 +91,19 @@ void UVFXPrewarmSubsystem::RegisterSystemForPrewarm(UNiagaraSystem* System)
 		{
 			SystemsToPrewarm.Add(System);
 			PrewarmSystem(System);
+
+			// The first cleanup may already have run; late components need one of their own
+			UWorld* World = GetWorld();
+			if (World && !World->GetTimerManager().IsTimerActive(PrewarmTimerHandle))
+			{
+				World->GetTimerManager().SetTimer(
+					PrewarmTimerHandle,
+					this,
+					&UVFXPrewarmSubsystem::OnPrewarmComplete,
+					PrewarmDuration,
+					false
+				);
+			}
 		}
 	}
 	else
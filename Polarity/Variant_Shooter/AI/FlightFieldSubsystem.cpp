@@ -0,0 +1,671 @@
+// FlightFieldSubsystem.cpp
+
+#include "FlightFieldSubsystem.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/Reverse.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarFlightFieldEnable(
+	TEXT("AI.FlightField.Enable"),
+	1,
+	TEXT("1=flying NPC height, ceiling and obstacle queries are answered from the voxel flight field where it is built, 0=always trace"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlightFieldVoxelSize(
+	TEXT("AI.FlightField.VoxelSize"),
+	50.0f,
+	TEXT("Edge of one flight field voxel (cm). Read when the world starts and on AI.FlightField.Rebuild."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlightFieldBuildBudgetMs(
+	TEXT("AI.FlightField.BuildBudgetMs"),
+	1.0f,
+	TEXT("Game thread time (ms) per frame spent building queued bricks; at least one is built per frame"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFlightFieldPathMaxNodes(
+	TEXT("AI.FlightField.PathMaxNodes"),
+	2048,
+	TEXT("Most cells one FindPath search may visit before giving up"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GFlightFieldReportCmd(
+	TEXT("AI.FlightField.Report"),
+	TEXT("Print flight field size, build cost and how many queries it answered since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UFlightFieldSubsystem* Field = World ? World->GetSubsystem<UFlightFieldSubsystem>() : nullptr)
+		{
+			Field->ReportStats();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GFlightFieldRebuildCmd(
+	TEXT("AI.FlightField.Rebuild"),
+	TEXT("Drop every flight field brick; they are rebuilt as they are asked about, at the current AI.FlightField.VoxelSize"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UFlightFieldSubsystem* Field = World ? World->GetSubsystem<UFlightFieldSubsystem>() : nullptr)
+		{
+			Field->Rebuild();
+		}
+	}));
+
+DECLARE_STATS_GROUP(TEXT("Flight Field"), STATGROUP_FlightField, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Build"), STAT_FlightField_Build, STATGROUP_FlightField);
+DECLARE_CYCLE_STAT(TEXT("Raycast"), STAT_FlightField_Raycast, STATGROUP_FlightField);
+DECLARE_CYCLE_STAT(TEXT("FindPath"), STAT_FlightField_Path, STATGROUP_FlightField);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Answered"), STAT_FlightField_Answered, STATGROUP_FlightField);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fallback Traces"), STAT_FlightField_Fallbacks, STATGROUP_FlightField);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Overlap Tests"), STAT_FlightField_Overlaps, STATGROUP_FlightField);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bricks"), STAT_FlightField_Bricks, STATGROUP_FlightField);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Build Queue"), STAT_FlightField_Queue, STATGROUP_FlightField);
+
+namespace FlightField
+{
+	/** Voxels along one edge of a brick, and of a path cell */
+	static constexpr int32 BrickVoxels = 8;
+	static constexpr int32 CellVoxels = 4;
+	static constexpr int32 CellsPerBrick = BrickVoxels / CellVoxels;
+
+	/** A region asking for more bricks than this at once is left to be built on demand */
+	static constexpr int64 MaxPrebuildBricks = 8192;
+
+	/** Division rounding towards negative infinity, so voxel -1 is in brick -1 */
+	static FORCEINLINE int32 FloorDiv(int32 Value, int32 Divisor)
+	{
+		return Value >= 0 ? Value / Divisor : (Value - Divisor + 1) / Divisor;
+	}
+
+	static FORCEINLINE FIntVector FloorDiv(const FIntVector& Value, int32 Divisor)
+	{
+		return FIntVector(FloorDiv(Value.X, Divisor), FloorDiv(Value.Y, Divisor), FloorDiv(Value.Z, Divisor));
+	}
+
+	static FORCEINLINE FIntVector ToGrid(const FVector& Location, double Size)
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Location.X / Size),
+			FMath::FloorToInt32(Location.Y / Size),
+			FMath::FloorToInt32(Location.Z / Size));
+	}
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UFlightFieldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UFlightFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	VoxelSize = FMath::Clamp(CVarFlightFieldVoxelSize.GetValueOnGameThread(), 10.0f, 200.0f);
+}
+
+void UFlightFieldSubsystem::Deinitialize()
+{
+	Bricks.Empty();
+	BrickLookup.Empty();
+	BuildQueue.Empty();
+	PathNodes.Empty();
+	PathLookup.Empty();
+	PathOpen.Empty();
+
+	Super::Deinitialize();
+}
+
+void UFlightFieldSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlightField_Build);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Deadline = StartTime + FMath::Max(CVarFlightFieldBuildBudgetMs.GetValueOnGameThread(), 0.0f) / 1000.0;
+
+	// Oldest first, and always at least one so a zero budget still makes progress
+	int32 Built = 0;
+	while (Built < BuildQueue.Num())
+	{
+		const int32 Index = BuildQueue[Built++];
+		BuildBrick(Index);
+
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+	BuildQueue.RemoveAt(0, Built, EAllowShrinking::No);
+
+	TotalBuildSeconds += FPlatformTime::Seconds() - StartTime;
+
+	SET_DWORD_STAT(STAT_FlightField_Bricks, Bricks.Num());
+	SET_DWORD_STAT(STAT_FlightField_Queue, BuildQueue.Num());
+}
+
+TStatId UFlightFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFlightFieldSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== Queries ====================
+
+UFlightFieldSubsystem* UFlightFieldSubsystem::Get(const UWorld* World)
+{
+	return World && CVarFlightFieldEnable.GetValueOnGameThread() != 0 ? World->GetSubsystem<UFlightFieldSubsystem>() : nullptr;
+}
+
+bool UFlightFieldSubsystem::LineTrace(UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End,
+	ECollisionChannel Channel, const FCollisionQueryParams& Params)
+{
+	if (!World)
+	{
+		return false;
+	}
+
+	// The field is WorldStatic objects only. Any other channel (Visibility, the obstacle channel) also
+	// blocks on pawns, props and WorldDynamic geometry the field knows nothing about, so it is traced.
+	if (Channel != ECC_WorldStatic)
+	{
+		return World->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+	}
+
+	if (UFlightFieldSubsystem* Field = Get(World))
+	{
+		const EFlightFieldTrace Result = Field->Raycast(Start, End, OutHit);
+		if (Result != EFlightFieldTrace::Unknown)
+		{
+			INC_DWORD_STAT(STAT_FlightField_Answered);
+			++Field->TotalAnswered;
+			return Result == EFlightFieldTrace::Hit;
+		}
+		++Field->TotalFallbacks;
+	}
+
+	INC_DWORD_STAT(STAT_FlightField_Fallbacks);
+	return World->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+}
+
+EFlightFieldTrace UFlightFieldSubsystem::Raycast(const FVector& Start, const FVector& End, FHitResult& OutHit)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlightField_Raycast);
+
+	OutHit = FHitResult(Start, End);
+
+	const FVector Delta = End - Start;
+	const FIntVector EndVoxel = FlightField::ToGrid(End, VoxelSize);
+	FIntVector Voxel = FlightField::ToGrid(Start, VoxelSize);
+
+	// Amanatides-Woo walk: per axis, the fraction of Delta at which the segment crosses into the
+	// next voxel, and how much that grows per voxel
+	FIntVector Step(0);
+	FVector NextT(UE_BIG_NUMBER);
+	FVector StepT(UE_BIG_NUMBER);
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (Delta[Axis] > UE_SMALL_NUMBER)
+		{
+			Step[Axis] = 1;
+			StepT[Axis] = VoxelSize / Delta[Axis];
+			NextT[Axis] = ((Voxel[Axis] + 1) * VoxelSize - Start[Axis]) / Delta[Axis];
+		}
+		else if (Delta[Axis] < -UE_SMALL_NUMBER)
+		{
+			Step[Axis] = -1;
+			StepT[Axis] = -VoxelSize / Delta[Axis];
+			NextT[Axis] = (Voxel[Axis] * VoxelSize - Start[Axis]) / Delta[Axis];
+		}
+	}
+
+	const int32 MaxSteps = FMath::Abs(EndVoxel.X - Voxel.X) + FMath::Abs(EndVoxel.Y - Voxel.Y) + FMath::Abs(EndVoxel.Z - Voxel.Z) + 1;
+	FIntVector PrevVoxel = Voxel;
+	double T = 0.0;
+	int32 EnteredAxis = INDEX_NONE;
+
+	for (int32 i = 0; i < MaxSteps; ++i)
+	{
+		const int32 State = GetVoxel(Voxel);
+		if (State < 0)
+		{
+			return EFlightFieldTrace::Unknown;
+		}
+
+		if (State > 0)
+		{
+			// Starting in a solid voxel means being within a voxel of a surface: too close to call
+			if (EnteredAxis == INDEX_NONE)
+			{
+				return EFlightFieldTrace::Unknown;
+			}
+
+			FVector FaceNormal(0.0);
+			FaceNormal[EnteredAxis] = -Step[EnteredAxis];
+
+			// A ray along an axis can only enter through a face square to it, so that face is the
+			// answer (a trace straight down finds a floor even at the foot of a wall). Slanted rays
+			// get the smoothed normal, which is what avoidance reflects off.
+			const bool bAxisAligned = FMath::Abs(Delta[EnteredAxis]) >= 0.99 * Delta.Size();
+
+			OutHit.bBlockingHit = true;
+			OutHit.Time = static_cast<float>(T);
+			OutHit.Distance = static_cast<float>(Delta.Size() * T);
+			OutHit.Location = Start + Delta * T;
+			OutHit.ImpactPoint = OutHit.Location;
+			OutHit.ImpactNormal = bAxisAligned ? FaceNormal : GetSurfaceNormal(PrevVoxel, FaceNormal);
+			OutHit.Normal = OutHit.ImpactNormal;
+			return EFlightFieldTrace::Hit;
+		}
+
+		if (Voxel == EndVoxel)
+		{
+			break;
+		}
+
+		const int32 Axis = NextT.X < NextT.Y ? (NextT.X < NextT.Z ? 0 : 2) : (NextT.Y < NextT.Z ? 1 : 2);
+		if (NextT[Axis] > 1.0)
+		{
+			break;
+		}
+
+		T = NextT[Axis];
+		NextT[Axis] += StepT[Axis];
+		PrevVoxel = Voxel;
+		Voxel[Axis] += Step[Axis];
+		EnteredAxis = Axis;
+	}
+
+	return EFlightFieldTrace::Clear;
+}
+
+bool UFlightFieldSubsystem::FindPath(const FVector& Start, const FVector& Goal, TArray<FVector>& OutPath)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlightField_Path);
+
+	OutPath.Reset();
+	++TotalPaths;
+
+	const double CellSize = VoxelSize * FlightField::CellVoxels;
+	const FIntVector StartCell = FlightField::ToGrid(Start, CellSize);
+	const FIntVector GoalCell = FlightField::ToGrid(Goal, CellSize);
+
+	if (GetCell(GoalCell) != 0)
+	{
+		++TotalPathsFailed;
+		return false;
+	}
+
+	PathNodes.Reset();
+	PathLookup.Reset();
+	PathOpen.Reset();
+
+	const int32 MaxNodes = FMath::Max(CVarFlightFieldPathMaxNodes.GetValueOnGameThread(), 64);
+	const auto OpenLess = [](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; };
+	const auto Heuristic = [&GoalCell](const FIntVector& Cell) { return static_cast<float>(FVector(Cell - GoalCell).Size()); };
+
+	// Step cost by how many axes a move changes: face, edge, corner neighbour
+	static const float StepCost[4] = { 0.0f, 1.0f, UE_SQRT_2, UE_SQRT_3 };
+
+	FPathNode& StartNode = PathNodes.AddDefaulted_GetRef();
+	StartNode.Cell = StartCell;
+	PathLookup.Add(StartCell, 0);
+	PathOpen.HeapPush(TPair<float, int32>(Heuristic(StartCell), 0), OpenLess);
+
+	int32 Found = INDEX_NONE;
+	while (PathOpen.Num() > 0)
+	{
+		TPair<float, int32> Top;
+		PathOpen.HeapPop(Top, OpenLess, EAllowShrinking::No);
+
+		const int32 NodeIndex = Top.Value;
+		if (PathNodes[NodeIndex].bClosed)
+		{
+			continue;
+		}
+		PathNodes[NodeIndex].bClosed = true;
+
+		const FIntVector Cell = PathNodes[NodeIndex].Cell;
+		const float Cost = PathNodes[NodeIndex].Cost;
+		if (Cell == GoalCell)
+		{
+			Found = NodeIndex;
+			break;
+		}
+
+		for (int32 DZ = -1; DZ <= 1; ++DZ)
+		{
+			for (int32 DY = -1; DY <= 1; ++DY)
+			{
+				for (int32 DX = -1; DX <= 1; ++DX)
+				{
+					const int32 Axes = (DX != 0) + (DY != 0) + (DZ != 0);
+					if (Axes == 0)
+					{
+						continue;
+					}
+
+					const FIntVector Next = Cell + FIntVector(DX, DY, DZ);
+					if (GetCell(Next) != 0)
+					{
+						continue;
+					}
+
+					// Diagonals only where each single-axis step is open too, so the line between
+					// cell centres cannot clip the edge of a blocked cell
+					if (Axes > 1
+						&& ((DX != 0 && GetCell(Cell + FIntVector(DX, 0, 0)) != 0)
+							|| (DY != 0 && GetCell(Cell + FIntVector(0, DY, 0)) != 0)
+							|| (DZ != 0 && GetCell(Cell + FIntVector(0, 0, DZ)) != 0)))
+					{
+						continue;
+					}
+
+					const float NextCost = Cost + StepCost[Axes];
+					if (const int32* Existing = PathLookup.Find(Next))
+					{
+						FPathNode& Node = PathNodes[*Existing];
+						if (Node.bClosed || Node.Cost <= NextCost)
+						{
+							continue;
+						}
+						Node.Cost = NextCost;
+						Node.Parent = NodeIndex;
+						PathOpen.HeapPush(TPair<float, int32>(NextCost + Heuristic(Next), *Existing), OpenLess);
+					}
+					else if (PathNodes.Num() < MaxNodes)
+					{
+						const int32 NewIndex = PathNodes.Num();
+						FPathNode& Node = PathNodes.AddDefaulted_GetRef();
+						Node.Cell = Next;
+						Node.Cost = NextCost;
+						Node.Parent = NodeIndex;
+						PathLookup.Add(Next, NewIndex);
+						PathOpen.HeapPush(TPair<float, int32>(NextCost + Heuristic(Next), NewIndex), OpenLess);
+					}
+				}
+			}
+		}
+	}
+
+	if (Found == INDEX_NONE)
+	{
+		++TotalPathsFailed;
+		return false;
+	}
+
+	for (int32 Index = Found; Index != INDEX_NONE; Index = PathNodes[Index].Parent)
+	{
+		OutPath.Add((FVector(PathNodes[Index].Cell) + 0.5) * CellSize);
+	}
+	Algo::Reverse(OutPath);
+
+	if (OutPath.Num() == 1)
+	{
+		OutPath[0] = Goal;
+		return true;
+	}
+
+	// String-pull: keep a cell centre only where the next one cannot be seen from the last kept point
+	OutPath[0] = Start;
+	OutPath.Last() = Goal;
+	int32 Kept = 0;
+	for (int32 i = 1; i < OutPath.Num() - 1; ++i)
+	{
+		FHitResult Hit;
+		if (Raycast(OutPath[Kept], OutPath[i + 1], Hit) != EFlightFieldTrace::Clear)
+		{
+			OutPath[++Kept] = OutPath[i];
+		}
+	}
+	OutPath[++Kept] = Goal;
+	OutPath.SetNum(Kept + 1, EAllowShrinking::No);
+
+	// The caller is already at Start
+	OutPath.RemoveAt(0, 1, EAllowShrinking::No);
+	return true;
+}
+
+// ==================== Building ====================
+
+void UFlightFieldSubsystem::PrebuildRegion(const FBox& Box)
+{
+	if (!Box.IsValid)
+	{
+		return;
+	}
+
+	const double BrickSize = VoxelSize * FlightField::BrickVoxels;
+	const FIntVector Min = FlightField::ToGrid(Box.Min, BrickSize);
+	const FIntVector Max = FlightField::ToGrid(Box.Max, BrickSize);
+
+	const int64 Count = static_cast<int64>(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) * (Max.Z - Min.Z + 1);
+	if (Count > FlightField::MaxPrebuildBricks)
+	{
+		UE_LOG(LogPolarityPerf, Warning, TEXT("[FLIGHT_FIELD] Prebuild of %lld bricks skipped, they will be built as they are asked about"), Count);
+		return;
+	}
+
+	for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				const int32 Index = FindOrAddBrick(FIntVector(X, Y, Z));
+				if (!Bricks[Index].bBuilt)
+				{
+					QueueBrick(Index);
+				}
+			}
+		}
+	}
+}
+
+void UFlightFieldSubsystem::Invalidate(const FBox& Box)
+{
+	if (!Box.IsValid)
+	{
+		return;
+	}
+
+	const double BrickSize = VoxelSize * FlightField::BrickVoxels;
+	const FIntVector Min = FlightField::ToGrid(Box.Min, BrickSize);
+	const FIntVector Max = FlightField::ToGrid(Box.Max, BrickSize);
+
+	// Only bricks that exist can be stale; the rest are built from the new geometry when asked
+	for (int32 Index = 0; Index < Bricks.Num(); ++Index)
+	{
+		FBrick& Brick = Bricks[Index];
+		if (Brick.bBuilt
+			&& Brick.Coord.X >= Min.X && Brick.Coord.X <= Max.X
+			&& Brick.Coord.Y >= Min.Y && Brick.Coord.Y <= Max.Y
+			&& Brick.Coord.Z >= Min.Z && Brick.Coord.Z <= Max.Z)
+		{
+			Brick.bBuilt = false;
+			QueueBrick(Index);
+		}
+	}
+}
+
+void UFlightFieldSubsystem::Rebuild()
+{
+	Bricks.Reset();
+	BrickLookup.Reset();
+	BuildQueue.Reset();
+	LastBrickCoord = FIntVector(MAX_int32);
+	LastBrickIndex = INDEX_NONE;
+
+	VoxelSize = FMath::Clamp(CVarFlightFieldVoxelSize.GetValueOnGameThread(), 10.0f, 200.0f);
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[FLIGHT_FIELD] Rebuilding at voxel size %.0f"), VoxelSize);
+}
+
+void UFlightFieldSubsystem::ReportStats() const
+{
+	const uint64 Queries = TotalAnswered + TotalFallbacks;
+	const double AnsweredPct = Queries > 0 ? 100.0 * static_cast<double>(TotalAnswered) / static_cast<double>(Queries) : 0.0;
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[FLIGHT_FIELD] voxel=%.0f bricks=%d queued=%d | built=%llu (empty=%llu) overlaps=%llu build=%.1f ms | answered=%llu fallback=%llu (%.1f%% from field) | paths=%llu failed=%llu | enabled=%d"),
+		VoxelSize, Bricks.Num(), BuildQueue.Num(), TotalBricksBuilt, TotalEmptyBricks, TotalOverlapTests, TotalBuildSeconds * 1000.0,
+		TotalAnswered, TotalFallbacks, AnsweredPct, TotalPaths, TotalPathsFailed, CVarFlightFieldEnable.GetValueOnGameThread());
+}
+
+// ==================== Internals ====================
+
+int32 UFlightFieldSubsystem::GetVoxel(const FIntVector& Voxel)
+{
+	const FIntVector Coord = FlightField::FloorDiv(Voxel, FlightField::BrickVoxels);
+	const FBrick* Brick = FindBuiltBrick(Coord);
+	if (!Brick)
+	{
+		return -1;
+	}
+
+	const FIntVector Local = Voxel - Coord * FlightField::BrickVoxels;
+	return static_cast<int32>((Brick->Layers[Local.Z] >> (Local.X + Local.Y * FlightField::BrickVoxels)) & 1);
+}
+
+int32 UFlightFieldSubsystem::GetCell(const FIntVector& Cell)
+{
+	const FIntVector Coord = FlightField::FloorDiv(Cell, FlightField::CellsPerBrick);
+	const FBrick* Brick = FindBuiltBrick(Coord);
+	if (!Brick)
+	{
+		return -1;
+	}
+
+	const FIntVector Local = Cell - Coord * FlightField::CellsPerBrick;
+	return (Brick->BlockedCells >> (Local.X + Local.Y * 2 + Local.Z * 4)) & 1;
+}
+
+const UFlightFieldSubsystem::FBrick* UFlightFieldSubsystem::FindBuiltBrick(const FIntVector& Coord)
+{
+	if (Coord != LastBrickCoord)
+	{
+		LastBrickIndex = FindOrAddBrick(Coord);
+		LastBrickCoord = Coord;
+	}
+
+	FBrick& Brick = Bricks[LastBrickIndex];
+	if (!Brick.bBuilt)
+	{
+		QueueBrick(LastBrickIndex);
+		return nullptr;
+	}
+	return &Brick;
+}
+
+int32 UFlightFieldSubsystem::FindOrAddBrick(const FIntVector& Coord)
+{
+	if (const int32* Existing = BrickLookup.Find(Coord))
+	{
+		return *Existing;
+	}
+
+	const int32 Index = Bricks.AddDefaulted();
+	Bricks[Index].Coord = Coord;
+	BrickLookup.Add(Coord, Index);
+	return Index;
+}
+
+void UFlightFieldSubsystem::QueueBrick(int32 Index)
+{
+	FBrick& Brick = Bricks[Index];
+	if (!Brick.bQueued)
+	{
+		Brick.bQueued = true;
+		BuildQueue.Add(Index);
+	}
+}
+
+void UFlightFieldSubsystem::BuildBrick(int32 Index)
+{
+	FBrick& Brick = Bricks[Index];
+	Brick.bQueued = false;
+	FMemory::Memzero(Brick.Layers);
+	Brick.BlockedCells = 0;
+
+	UWorld* World = GetWorld();
+	const double CellSize = VoxelSize * FlightField::CellVoxels;
+	const double BrickSize = VoxelSize * FlightField::BrickVoxels;
+	const FVector Origin = FVector(Brick.Coord) * BrickSize;
+
+	const FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(FlightFieldBuild), false);
+
+	int32 Overlaps = 0;
+	const auto IsSolid = [&](const FVector& Min, double Size)
+	{
+		++Overlaps;
+		const FVector HalfExtent(Size * 0.5);
+		return World->OverlapAnyTestByObjectType(Min + HalfExtent, FQuat::Identity, ObjectParams, FCollisionShape::MakeBox(HalfExtent), Params);
+	};
+
+	// Coarse to fine: open air is one test for the whole brick, 8 more for a brick that touches
+	// something, and voxel tests only inside the cells that do
+	if (IsSolid(Origin, BrickSize))
+	{
+		for (int32 CellIndex = 0; CellIndex < 8; ++CellIndex)
+		{
+			const FIntVector CellCoord(CellIndex & 1, (CellIndex >> 1) & 1, CellIndex >> 2);
+			const FIntVector CellVoxel = CellCoord * FlightField::CellVoxels;
+			if (!IsSolid(Origin + FVector(CellVoxel) * VoxelSize, CellSize))
+			{
+				continue;
+			}
+
+			Brick.BlockedCells |= static_cast<uint8>(1 << CellIndex);
+
+			for (int32 Z = CellVoxel.Z; Z < CellVoxel.Z + FlightField::CellVoxels; ++Z)
+			{
+				for (int32 Y = CellVoxel.Y; Y < CellVoxel.Y + FlightField::CellVoxels; ++Y)
+				{
+					for (int32 X = CellVoxel.X; X < CellVoxel.X + FlightField::CellVoxels; ++X)
+					{
+						if (IsSolid(Origin + FVector(X, Y, Z) * VoxelSize, VoxelSize))
+						{
+							Brick.Layers[Z] |= 1ull << (X + Y * FlightField::BrickVoxels);
+						}
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		++TotalEmptyBricks;
+	}
+
+	Brick.bBuilt = true;
+	++TotalBricksBuilt;
+	TotalOverlapTests += Overlaps;
+	INC_DWORD_STAT_BY(STAT_FlightField_Overlaps, Overlaps);
+}
+
+FVector UFlightFieldSubsystem::GetSurfaceNormal(const FIntVector& FreeVoxel, const FVector& FaceNormal)
+{
+	// Away from every solid neighbour: a flat floor gives straight up, a corner the diagonal out of it
+	FVector Sum(0.0);
+	for (int32 DZ = -1; DZ <= 1; ++DZ)
+	{
+		for (int32 DY = -1; DY <= 1; ++DY)
+		{
+			for (int32 DX = -1; DX <= 1; ++DX)
+			{
+				if ((DX | DY | DZ) != 0 && GetVoxel(FreeVoxel + FIntVector(DX, DY, DZ)) > 0)
+				{
+					Sum -= FVector(DX, DY, DZ);
+				}
+			}
+		}
+	}
+
+	const FVector Normal = Sum.GetSafeNormal();
+	return FVector::DotProduct(Normal, FaceNormal) > 0.0 ? Normal : FaceNormal;
+}
@@ -0,0 +1,180 @@
+// FlightFieldSubsystem.h
+// Sparse voxel occupancy of static geometry that flying NPCs sample instead of tracing
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "FlightFieldSubsystem.generated.h"
+
+struct FCollisionQueryParams;
+
+/** What the field knows about a segment */
+enum class EFlightFieldTrace : uint8
+{
+	/** Some of it is not built yet (now queued), or it starts inside a solid voxel: trace instead */
+	Unknown,
+	Clear,
+	Hit
+};
+
+/**
+ * Flying NPCs found their way with line traces every tick: UFlyingAIMovementComponent traced down
+ * and up from wherever it was heading to keep the hover height between floor and ceiling, and
+ * forward for obstacle avoidance, and the kamikaze drone traced for orbit space, predicted floors and
+ * clipping through the floor. A dozen drones chasing the player was several dozen traces a frame,
+ * all asking the same static geometry the same questions.
+ *
+ * This keeps the answers. Space is cut into voxels (AI.FlightField.VoxelSize, 50 cm) grouped in
+ * bricks of 8x8x8, and a brick is built the first time anything asks about it: one box overlap
+ * against WorldStatic objects for the whole brick, then one for each of its eight 4x4x4 cells, then
+ * one per voxel only inside the cells that touch something. Most of an arena is open air and costs
+ * a single overlap per brick. Builds are queued and run in Tick under AI.FlightField.BuildBudgetMs,
+ * and flying NPCs queue the area around their spawn at BeginPlay so the field is usually ready
+ * before they need it. Nothing is baked: destructible islands and streamed sublevels change the
+ * geometry at runtime, and Invalidate() drops the bricks a change touches so they are rebuilt.
+ *
+ * LineTrace() walks the voxels along a segment and answers when every brick on the way is built,
+ * otherwise it queues them and runs the real LineTraceSingleByChannel, so callers swap it in for
+ * their trace and never get a guess. Hits land on the voxel face, up to one voxel short of the real
+ * surface, with the normal taken from the solid voxels around the hit: floors still face up and
+ * ceilings down. Only static geometry is in the field; pawns, props and anything WorldDynamic are
+ * not, so only ECC_WorldStatic traces are answered from it (hover height, ceiling, floor checks).
+ * Traces on any other channel, such as the obstacle-avoidance ObstacleChannel (ECC_Visibility by
+ * default), block on those too and always go to the real trace.
+ *
+ * FindPath() is an A* over the 4x4x4 cells (26 neighbours, AI.FlightField.PathMaxNodes at most),
+ * string-pulled with the voxel walk, for flights whose straight line is blocked.
+ *
+ * AI.FlightField.Enable 0 sends every query to the trace. Cost in "stat FlightField", counters in
+ * AI.FlightField.Report, AI.FlightField.Rebuild drops everything (and picks up a new voxel size).
+ */
+UCLASS()
+class POLARITY_API UFlightFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return BuildQueue.Num() > 0; }
+
+	// ==================== Queries ====================
+
+	/** The world's field, or null when AI.FlightField.Enable is off */
+	static UFlightFieldSubsystem* Get(const UWorld* World);
+
+	/**
+	 * Drop-in for World->LineTraceSingleByChannel. Only ECC_WorldStatic is answered from the field,
+	 * and only when it covers the segment; every other channel, an uncovered segment or a missing
+	 * field is traced. OutHit carries no actor or component when the field answered.
+	 */
+	static bool LineTrace(UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End,
+		ECollisionChannel Channel, const FCollisionQueryParams& Params);
+
+	/** Walk the voxels from Start to End. OutHit is filled on Hit. */
+	EFlightFieldTrace Raycast(const FVector& Start, const FVector& End, FHitResult& OutHit);
+
+	/**
+	 * Cell path from Start to Goal around static geometry, string-pulled, Goal last and Start left
+	 * out. False if Goal is inside geometry or not built yet, or no path within the node budget.
+	 */
+	bool FindPath(const FVector& Start, const FVector& Goal, TArray<FVector>& OutPath);
+
+	// ==================== Building ====================
+
+	/** Queue every brick overlapping Box that is not built yet */
+	void PrebuildRegion(const FBox& Box);
+
+	/** Geometry inside Box changed: its bricks are rebuilt, and traced until they are */
+	void Invalidate(const FBox& Box);
+
+	/** Forget every brick and start over with the current AI.FlightField.VoxelSize (AI.FlightField.Rebuild) */
+	void Rebuild();
+
+	float GetVoxelSize() const { return VoxelSize; }
+
+	/** Lifetime counters to the log (AI.FlightField.Report) */
+	void ReportStats() const;
+
+private:
+
+	/** 8x8x8 voxels. Coordinates are in bricks: world origin of the brick is Coord * 8 * VoxelSize. */
+	struct FBrick
+	{
+		FIntVector Coord = FIntVector::ZeroValue;
+
+		/** Solid voxels, one layer per Z, bit X + Y * 8 */
+		uint64 Layers[8] = {};
+
+		/** 4x4x4 path cells with anything solid in them, bit CX + CY * 2 + CZ * 4 */
+		uint8 BlockedCells = 0;
+
+		bool bBuilt = false;
+		bool bQueued = false;
+	};
+
+	/** Voxel state: -1 unknown (not built, now queued), 0 free, 1 solid */
+	int32 GetVoxel(const FIntVector& Voxel);
+
+	/** Path cell state, same values as GetVoxel */
+	int32 GetCell(const FIntVector& Cell);
+
+	/** The brick at Coord, added and queued if it does not exist; null only if it is not built yet */
+	const FBrick* FindBuiltBrick(const FIntVector& Coord);
+
+	/** Index of the brick at Coord, adding it if needed */
+	int32 FindOrAddBrick(const FIntVector& Coord);
+
+	void QueueBrick(int32 Index);
+
+	/** Overlap tests for one brick, coarse to fine */
+	void BuildBrick(int32 Index);
+
+	/** Outward normal of the solid around a free voxel, from the occupancy of its 26 neighbours */
+	FVector GetSurfaceNormal(const FIntVector& FreeVoxel, const FVector& FaceNormal);
+
+	TArray<FBrick> Bricks;
+	TMap<FIntVector, int32> BrickLookup;
+
+	/** Brick indices waiting for BuildBrick, oldest first */
+	TArray<int32> BuildQueue;
+
+	/** Voxel walks ask about the same brick several times in a row */
+	FIntVector LastBrickCoord = FIntVector(MAX_int32);
+	int32 LastBrickIndex = INDEX_NONE;
+
+	float VoxelSize = 50.0f;
+
+	// FindPath scratch, kept to avoid reallocating per search
+	struct FPathNode
+	{
+		FIntVector Cell;
+		int32 Parent = INDEX_NONE;
+		float Cost = 0.0f;
+		bool bClosed = false;
+	};
+	TArray<FPathNode> PathNodes;
+	TMap<FIntVector, int32> PathLookup;
+	TArray<TPair<float, int32>> PathOpen;
+
+	// ==================== Lifetime Counters ====================
+
+	uint64 TotalAnswered = 0;
+	uint64 TotalFallbacks = 0;
+	uint64 TotalBricksBuilt = 0;
+	uint64 TotalEmptyBricks = 0;
+	uint64 TotalOverlapTests = 0;
+	uint64 TotalPaths = 0;
+	uint64 TotalPathsFailed = 0;
+	double TotalBuildSeconds = 0.0;
+};
@@ -2,6 +2,7 @@
 
 #include "FlyingAIMovementComponent.h"
 #include "FlyingDrone.h"
+#include "FlightFieldSubsystem.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -46,6 +47,13 @@ void UFlyingAIMovementComponent::BeginPlay()
 			MovementComponent->MaxSimulationIterations = 4;
 			MovementComponent->MaxSimulationTimeStep = 0.025f;
 		}
+
+		// Get the patrol area into the flight field before the first query asks for it
+		if (UFlightFieldSubsystem* Field = bUseFlightField ? UFlightFieldSubsystem::Get(GetWorld()) : nullptr)
+		{
+			const float Reach = PatrolRadius + ObstacleCheckDistance;
+			Field->PrebuildRegion(FBox::BuildAABB(SpawnLocation, FVector(Reach, Reach, MaxHoverHeight + CeilingClearance)));
+		}
 	}
 
 	// Randomize oscillation start phase
@@ -113,6 +121,20 @@ void UFlyingAIMovementComponent::FlyToLocation(const FVector& TargetLocation, fl
 	CurrentAcceptanceRadius = (CustomAcceptanceRadius > 0.0f) ? CustomAcceptanceRadius : AcceptanceRadius;
 	bIsMovingToTarget = true;
 
+	// Route around static geometry when the straight line is blocked. No path (not built yet, or
+	// none found) leaves it to obstacle avoidance as before.
+	PathPoints.Reset();
+	PathIndex = 0;
+	if (UFlightFieldSubsystem* Field = (bUseFlightField && bUseFlightFieldPaths) ? UFlightFieldSubsystem::Get(GetWorld()) : nullptr)
+	{
+		const FVector CurrentLocation = CharacterOwner->GetActorLocation();
+		FHitResult Hit;
+		if (Field->Raycast(CurrentLocation, CurrentTargetLocation, Hit) == EFlightFieldTrace::Hit)
+		{
+			Field->FindPath(CurrentLocation, CurrentTargetLocation, PathPoints);
+		}
+	}
+
 	// Reset stuck detection for new movement
 	StuckCheckTime = 0.0f;
 }
@@ -125,6 +147,7 @@ void UFlyingAIMovementComponent::FlyToActor(AActor* InTargetActor, float CustomA
 	}
 
 	TargetActor = InTargetActor;
+	PathPoints.Reset();
 	CurrentTargetLocation = ValidateTargetHeight(InTargetActor->GetActorLocation());
 	CurrentAcceptanceRadius = (CustomAcceptanceRadius > 0.0f) ? CustomAcceptanceRadius : AcceptanceRadius;
 	bIsMovingToTarget = true;
@@ -137,6 +160,7 @@ void UFlyingAIMovementComponent::StopMovement()
 {
 	bIsMovingToTarget = false;
 	TargetActor.Reset();
+	PathPoints.Reset();
 
 	if (MovementComponent)
 	{
@@ -274,7 +298,7 @@ bool UFlyingAIMovementComponent::GetRandomPointInVolume(const FVector& Center, f
 		float GroundZ = Center.Z - DefaultHoverHeight; // Fallback
 
 		// Trace down to find floor (surface facing up)
-		if (GetWorld()->LineTraceSingleByChannel(GroundHit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
+		if (TraceStatic(GroundHit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
 		{
 			if (GroundHit.ImpactNormal.Z > 0.7f) // Floor faces up
 			{
@@ -291,7 +315,7 @@ bool UFlyingAIMovementComponent::GetRandomPointInVolume(const FVector& Center, f
 		float ActualMinHeight = MinHeight;
 
 		// Trace up to find ceiling (surface facing down)
-		if (GetWorld()->LineTraceSingleByChannel(CeilingHit, CeilingTraceStart, CeilingTraceEnd, ECC_WorldStatic, QueryParams))
+		if (TraceStatic(CeilingHit, CeilingTraceStart, CeilingTraceEnd, ECC_WorldStatic, QueryParams))
 		{
 			if (CeilingHit.ImpactNormal.Z < -0.7f) // Ceiling faces down
 			{
@@ -322,7 +346,7 @@ bool UFlyingAIMovementComponent::GetRandomPointInVolume(const FVector& Center, f
 
 		// Validate the point is not inside geometry
 		FHitResult ObstacleHit;
-		if (GetWorld()->LineTraceSingleByChannel(ObstacleHit, Center, OutPoint, ObstacleChannel, QueryParams))
+		if (TraceStatic(ObstacleHit, Center, OutPoint, ObstacleChannel, QueryParams))
 		{
 			// Point is blocked, try to find a valid point along the line
 			OutPoint = ObstacleHit.ImpactPoint - (OutPoint - Center).GetSafeNormal() * 100.0f;
@@ -400,8 +424,20 @@ void UFlyingAIMovementComponent::UpdateMovement(float DeltaTime)
 		StuckCheckTime = CurrentTime;
 	}
 
+	// On a flight field path, steer at the next waypoint (the last one is the target itself)
+	FVector SteerTarget = CurrentTargetLocation;
+	if (PathPoints.IsValidIndex(PathIndex))
+	{
+		if (PathIndex < PathPoints.Num() - 1
+			&& FVector::DistSquared(CurrentLocation, PathPoints[PathIndex]) <= FMath::Square(CurrentAcceptanceRadius))
+		{
+			++PathIndex;
+		}
+		SteerTarget = PathPoints[PathIndex];
+	}
+
 	// Calculate desired direction
-	FVector DesiredDirection = ToTarget.GetSafeNormal();
+	FVector DesiredDirection = (SteerTarget - CurrentLocation).GetSafeNormal();
 
 	// Apply obstacle avoidance if enabled
 	if (bEnableObstacleAvoidance)
@@ -526,7 +562,7 @@ FVector UFlyingAIMovementComponent::GetAvoidanceAdjustedDirection(const FVector&
 
 	const FVector TraceEnd = CurrentLocation + DesiredDirection * ObstacleCheckDistance;
 
-	if (GetWorld()->LineTraceSingleByChannel(Hit, CurrentLocation, TraceEnd, ObstacleChannel, QueryParams))
+	if (TraceStatic(Hit, CurrentLocation, TraceEnd, ObstacleChannel, QueryParams))
 	{
 		// Obstacle detected, calculate avoidance direction
 		const FVector ObstacleNormal = Hit.ImpactNormal;
@@ -557,7 +593,7 @@ float UFlyingAIMovementComponent::GetHeightAboveGround(const FVector& Location)
 	const FVector TraceStart = Location;
 	const FVector TraceEnd = Location - FVector(0.0f, 0.0f, 10000.0f);
 
-	if (GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
+	if (TraceStatic(Hit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
 	{
 		// Only count as floor if surface faces up
 		if (Hit.ImpactNormal.Z > 0.7f)
@@ -597,7 +633,7 @@ FVector UFlyingAIMovementComponent::ValidateTargetHeight(const FVector& TargetLo
 	float GroundZ = TargetLocation.Z - DefaultHoverHeight;
 
 	// Trace DOWN to find the floor
-	if (GetWorld()->LineTraceSingleByChannel(GroundHit, GroundTraceStart, GroundTraceEnd, ECC_WorldStatic, QueryParams))
+	if (TraceStatic(GroundHit, GroundTraceStart, GroundTraceEnd, ECC_WorldStatic, QueryParams))
 	{
 		// Only accept surfaces facing UP (floors, not ceilings or walls)
 		if (GroundHit.ImpactNormal.Z > 0.7f) // Surface is mostly horizontal and facing up
@@ -620,7 +656,7 @@ FVector UFlyingAIMovementComponent::ValidateTargetHeight(const FVector& TargetLo
 	float ActualMinHeight = MinHoverHeight;
 
 	// Trace UP to find ceiling - use WorldStatic to hit actual geometry
-	if (GetWorld()->LineTraceSingleByChannel(CeilingHit, CeilingTraceStart, CeilingTraceEnd, ECC_WorldStatic, QueryParams))
+	if (TraceStatic(CeilingHit, CeilingTraceStart, CeilingTraceEnd, ECC_WorldStatic, QueryParams))
 	{
 		// Only count surfaces facing DOWN as ceilings
 		if (CeilingHit.ImpactNormal.Z < -0.7f)
@@ -684,6 +720,7 @@ void UFlyingAIMovementComponent::CompleteMovement(bool bSuccess)
 {
 	bIsMovingToTarget = false;
 	TargetActor.Reset();
+	PathPoints.Reset();
 
 	// Broadcast completion
 	OnMovementCompleted.Broadcast(bSuccess);
@@ -784,6 +821,15 @@ FVector UFlyingAIMovementComponent::GetCollisionSafeDirection(const FVector& Des
 	return DesiredDirection;
 }
 
+bool UFlyingAIMovementComponent::TraceStatic(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel, const FCollisionQueryParams& Params) const
+{
+	if (bUseFlightField)
+	{
+		return UFlightFieldSubsystem::LineTrace(GetWorld(), OutHit, Start, End, Channel, Params);
+	}
+	return GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+}
+
 float UFlyingAIMovementComponent::GetHeightToCeiling(const FVector& Location) const
 {
 	if (!GetWorld())
@@ -799,7 +845,7 @@ float UFlyingAIMovementComponent::GetHeightToCeiling(const FVector& Location) co
 	const FVector TraceStart = Location;
 	const FVector TraceEnd = Location + FVector(0.0f, 0.0f, 10000.0f);
 
-	if (GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
+	if (TraceStatic(Hit, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
 	{
 		// Only count as ceiling if surface faces down
 		if (Hit.ImpactNormal.Z < -0.7f)
@@ -8,6 +8,7 @@
 
 class UCharacterMovementComponent;
 class ACharacter;
+struct FCollisionQueryParams;
 
 /** Delegate called when movement to target is completed */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFlyingMovementCompleted, bool, bSuccess);
@@ -139,6 +140,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flying|Avoidance", meta = (EditCondition = "bEnableObstacleAvoidance"))
 	TEnumAsByte<ECollisionChannel> ObstacleChannel = ECC_Visibility;
 
+	// ==================== Flight Field ====================
+
+	/** Answer floor, ceiling and obstacle checks from the shared voxel flight field where it is built, instead of tracing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flying|FlightField")
+	bool bUseFlightField = true;
+
+	/** FlyToLocation follows a flight field path around static geometry when the straight line is blocked */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flying|FlightField", meta = (EditCondition = "bUseFlightField"))
+	bool bUseFlightFieldPaths = true;
+
 	// ==================== Ceiling Detection ====================
 
 	/** Minimum clearance from ceiling (cm) */
@@ -305,6 +316,12 @@ protected:
 	/** Time accumulator for oscillation */
 	float OscillationTime = 0.0f;
 
+	/** Flight field waypoints to CurrentTargetLocation (empty when flying straight) */
+	TArray<FVector> PathPoints;
+
+	/** Waypoint currently steered at */
+	int32 PathIndex = 0;
+
 	// ==================== Internal Methods ====================
 
 	/** Update movement towards target */
@@ -325,6 +342,10 @@ protected:
 	/** Validate and adjust target location to be within height bounds (floor and ceiling) */
 	FVector ValidateTargetHeight(const FVector& TargetLocation) const;
 
+	/** Line trace, answered from the flight field when bUseFlightField, Channel is ECC_WorldStatic and
+	 *  the field covers the segment; traced otherwise */
+	bool TraceStatic(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel, const FCollisionQueryParams& Params) const;
+
 	/** Get height to ceiling at given location (returns MAX_FLT if no ceiling) */
 	float GetHeightToCeiling(const FVector& Location) const;
 
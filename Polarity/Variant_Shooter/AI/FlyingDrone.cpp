@@ -15,6 +15,7 @@
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
 #include "../../AI/Components/AIAccuracyComponent.h"
+#include "../../AI/Coordination/AILineOfSightSubsystem.h"
 #include "ShooterGameMode.h"
 #include "EMFVelocityModifier.h"
 #include "EMF_FieldComponent.h"
@@ -31,7 +32,8 @@
 #include "GeometryCollection/GeometryCollectionActor.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
-#include "Field/FieldSystemObjects.h"
+#include "VFX/GibPoolSubsystem.h"
+#include "Pooling/ActorPoolSubsystem.h"
 #include "ShooterCharacter.h"
 #include "Polarity/Upgrades/UpgradeManagerComponent.h"
 
@@ -340,13 +342,10 @@ void AFlyingDrone::DroneDie()
 
 		if (Roll < DropChance)
 		{
-			FActorSpawnParameters WeaponSpawnParams;
-			WeaponSpawnParams.SpawnCollisionHandlingOverride =
-				ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
 			const FVector SpawnLoc = GetActorLocation() + DropSpawnOffset;
-			ADroppedMeleeWeapon* DroppedWeapon = GetWorld()->SpawnActor<ADroppedMeleeWeapon>(
-				DroppedMeleeWeaponClass, SpawnLoc, GetActorRotation(), WeaponSpawnParams);
+			UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+			ADroppedMeleeWeapon* DroppedWeapon = Pool ? Pool->Acquire<ADroppedMeleeWeapon>(
+				DroppedMeleeWeaponClass, FTransform(GetActorRotation(), SpawnLoc)) : nullptr;
 
 			if (DroppedWeapon)
 			{
@@ -360,7 +359,7 @@ void AFlyingDrone::DroneDie()
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("[WeaponDrop] DRONE %s: Melee drop FAILED - SpawnActor returned null"), *GetName());
+				UE_LOG(LogTemp, Error, TEXT("[WeaponDrop] DRONE %s: Melee drop FAILED - pool returned null"), *GetName());
 			}
 		}
 	}
@@ -377,13 +376,10 @@ void AFlyingDrone::DroneDie()
 			const float Roll = FMath::FRand();
 			if (Roll < Entry.DropChance)
 			{
-				FActorSpawnParameters RangedSpawnParams;
-				RangedSpawnParams.SpawnCollisionHandlingOverride =
-					ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
 				const FVector SpawnLoc = GetActorLocation() + DropSpawnOffset;
-				ADroppedRangedWeapon* DroppedRanged = GetWorld()->SpawnActor<ADroppedRangedWeapon>(
-					Entry.DroppedWeaponClass, SpawnLoc, GetActorRotation(), RangedSpawnParams);
+				UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+				ADroppedRangedWeapon* DroppedRanged = Pool ? Pool->Acquire<ADroppedRangedWeapon>(
+					Entry.DroppedWeaponClass, FTransform(GetActorRotation(), SpawnLoc)) : nullptr;
 
 				if (DroppedRanged)
 				{
@@ -405,7 +401,7 @@ void AFlyingDrone::DroneDie()
 				}
 				else
 				{
-					UE_LOG(LogTemp, Error, TEXT("[WeaponDrop] DRONE %s: Ranged drop FAILED - SpawnActor returned null for %s"),
+					UE_LOG(LogTemp, Error, TEXT("[WeaponDrop] DRONE %s: Ranged drop FAILED - pool returned null for %s"),
 						*GetName(), *Entry.DroppedWeaponClass->GetName());
 				}
 
@@ -531,12 +527,8 @@ void AFlyingDrone::DroneDie()
 	// Disable actor tick
 	SetActorTickEnabled(false);
 
-	// Destroy weapon
-	if (Weapon)
-	{
-		Weapon->Destroy();
-		Weapon = nullptr;
-	}
+	// Hand the weapon back to the pool
+	ReleaseNPCWeapon();
 
 	// Schedule fast destruction
 	GetWorld()->GetTimerManager().SetTimer(
@@ -742,44 +734,27 @@ void AFlyingDrone::SpawnDeathGeometryCollection(const FDeathModeConfig& Config)
 		return;
 	}
 
-	// Use DroneMesh transform (the actual visible mesh) instead of hidden SkeletalMesh
-	const FTransform MeshTransform = DroneMesh ? DroneMesh->GetComponentTransform()
-	                                           : FTransform(GetActorLocation());
-	const FVector Origin = MeshTransform.GetLocation();
-
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AGeometryCollectionActor* GCActor = GetWorld()->SpawnActor<AGeometryCollectionActor>(
-		Origin, MeshTransform.GetRotation().Rotator(), SpawnParams);
-
-	if (!GCActor)
+	UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>();
+	if (!GibPool)
 	{
 		return;
 	}
 
-	UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
-	if (!GCComp)
-	{
-		GCActor->Destroy();
-		return;
-	}
+	// Use DroneMesh transform (the actual visible mesh) instead of hidden SkeletalMesh
+	const FTransform MeshTransform = DroneMesh ? DroneMesh->GetComponentTransform()
+		: FTransform(GetActorLocation());
+	const FVector Origin = MeshTransform.GetLocation();
+
+	FGibSpawnParams Gibs;
+	Gibs.RestCollection = DeathGeometryCollection;
 
 	// Scale GC to match drone visual mesh
-	if (DroneMesh)
-	{
-		GCActor->SetActorScale3D(DroneMesh->GetComponentScale());
-	}
+	Gibs.Transform = FTransform(MeshTransform.GetRotation(), Origin,
+		DroneMesh ? DroneMesh->GetComponentScale() : FVector::OneVector);
 
 	// Collision: gibs collide with world but not pawns/camera
 	// Note: can't use RagdollCollisionProfile here — drone sets it to "NoCollision"
-	GCComp->SetCollisionProfileName(FName("Ragdoll"));
-	GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
-
-	// Assign GC asset and initialize physics
-	GCComp->SetRestCollection(DeathGeometryCollection);
+	Gibs.CollisionProfile = FName("Ragdoll");
 
 	// Copy materials from DroneMesh to GC gibs
 	if (DroneMesh)
@@ -787,51 +762,23 @@ void AFlyingDrone::SpawnDeathGeometryCollection(const FDeathModeConfig& Config)
 		const int32 NumMats = DroneMesh->GetNumMaterials();
 		for (int32 i = 0; i < NumMats; i++)
 		{
-			if (UMaterialInterface* Mat = DroneMesh->GetMaterial(i))
-			{
-				GCComp->SetMaterial(i, Mat);
-			}
+			Gibs.Materials.Add(DroneMesh->GetMaterial(i));
 		}
 	}
 
-	GCComp->SetSimulatePhysics(true);
-	GCComp->RecreatePhysicsState();
-
-	// Break all clusters
-	UUniformScalar* StrainField = NewObject<UUniformScalar>(GCActor);
-	StrainField->Magnitude = 999999.0f;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_ExternalClusterStrain,
-		nullptr, StrainField);
-
-	// Scatter pieces radially
-	URadialVector* RadialVelocity = NewObject<URadialVector>(GCActor);
-	RadialVelocity->Magnitude = Config.DismembermentImpulse;
-	RadialVelocity->Position = Origin;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-		nullptr, RadialVelocity);
-
-	// Angular velocity for tumbling
-	URadialVector* AngularVelocity = NewObject<URadialVector>(GCActor);
-	AngularVelocity->Magnitude = Config.DismembermentAngularImpulse;
-	AngularVelocity->Position = Origin;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_AngularVelocity,
-		nullptr, AngularVelocity);
-
-	// Directional bias from killing hit direction
+	// Scatter pieces radially, tumble them, and bias them along the killing hit
+	Gibs.FieldOrigin = Origin;
+	Gibs.RadialSpeed = Config.DismembermentImpulse;
+	Gibs.AngularSpeed = Config.DismembermentAngularImpulse;
 	if (!LastKillingHitDirection.IsNearlyZero() && Config.DirectionalBiasMultiplier > 0.0f)
 	{
-		UUniformVector* DirectionalBias = NewObject<UUniformVector>(GCActor);
-		DirectionalBias->Magnitude = Config.DismembermentImpulse * Config.DirectionalBiasMultiplier;
-		DirectionalBias->Direction = LastKillingHitDirection;
-		GCComp->ApplyPhysicsField(true,
-			EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-			nullptr, DirectionalBias);
+		Gibs.BiasDirection = LastKillingHitDirection;
+		Gibs.BiasSpeed = Config.DismembermentImpulse * Config.DirectionalBiasMultiplier;
 	}
 
-	GCActor->SetLifeSpan(GibLifetime);
+	// Back to the pool after GibLifetime
+	Gibs.Lifetime = GibLifetime;
+	GibPool->SpawnGibs(Gibs);
 
 	UE_LOG(LogTemp, Log, TEXT("Drone SpawnDeathGC: %s impulse=%.0f dir=[%.2f,%.2f,%.2f]"),
 		*GetName(), Config.DismembermentImpulse,
@@ -1049,21 +996,11 @@ bool AFlyingDrone::HasLineOfSightTo(AActor* Target) const
 		return false;
 	}
 
-	FHitResult Hit;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
 	const FVector Start = GetActorLocation();
 	const FVector End = Target->GetActorLocation();
 
-	bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility, QueryParams);
-
-	if (bHit)
-	{
-		return Hit.GetActor() == Target;
-	}
-
-	return true;
+	// The target is left out of the trace rather than accepted as the thing hit: same answer
+	return UAILineOfSightSubsystem::HasLineOfSight(this, Target, Start, End, UAILineOfSightSubsystem::SampleBody);
 }
 
 void AFlyingDrone::UpdateCombat()
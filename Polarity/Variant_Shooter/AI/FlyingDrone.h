@@ -312,6 +312,9 @@ public:
 	/** Check if we have line of sight to target (override from ShooterNPC) */
 	virtual bool HasLineOfSightTo(AActor* Target) const override;
 
+	/** A dead drone destroys itself (DeathDestroy), pooled or not */
+	virtual bool CanRecycleThroughPool() const override { return false; }
+
 	/** Get current combat target */
 	UFUNCTION(BlueprintPure, Category = "Drone|Combat")
 	AActor* GetCombatTarget() const { return CurrentAimTarget.Get(); }
@@ -7,6 +7,7 @@
 #include "Variant_Shooter/Weapons/DroppedRangedWeapon.h"
 #include "Variant_Shooter/ShooterCharacter.h"
 #include "ShooterWeapon.h"
+#include "Pooling/ActorPoolSubsystem.h"
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "TimerManager.h"
@@ -40,12 +41,7 @@ void AHumanoidNPC::BeginPlay()
 
 	if (WeaponInventory.IsValidIndex(0) && WeaponInventory[0])
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = this;
-		SpawnParams.Instigator = this;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		Weapon = GetWorld()->SpawnActor<AShooterWeapon>(WeaponInventory[0], GetActorTransform(), SpawnParams);
+		Weapon = AcquireNPCWeapon(WeaponInventory[0]);
 		if (Weapon)
 		{
 			Weapon->OnShotFired.AddDynamic(this, &AHumanoidNPC::OnWeaponShotFiredForward);
@@ -229,14 +225,12 @@ bool AHumanoidNPC::YankCurrentWeapon(AShooterCharacter* Puller)
 	ADroppedRangedWeapon* Dropped = nullptr;
 	if (WeaponDropMapping.IsValidIndex(CurrentWeaponIndex) && WeaponDropMapping[CurrentWeaponIndex])
 	{
-		FActorSpawnParameters Params;
-		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		Dropped = GetWorld()->SpawnActor<ADroppedRangedWeapon>(
-			WeaponDropMapping[CurrentWeaponIndex],
-			WeaponLocation,
-			WeaponRotation,
-			Params);
+		if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+		{
+			Dropped = Pool->Acquire<ADroppedRangedWeapon>(
+				WeaponDropMapping[CurrentWeaponIndex],
+				FTransform(WeaponRotation, WeaponLocation));
+		}
 
 		if (Dropped)
 		{
@@ -307,15 +301,7 @@ void AHumanoidNPC::SpawnNextWeapon()
 		return;
 	}
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = this;
-	SpawnParams.Instigator = this;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	Weapon = GetWorld()->SpawnActor<AShooterWeapon>(
-		WeaponInventory[CurrentWeaponIndex],
-		GetActorTransform(),
-		SpawnParams);
+	Weapon = AcquireNPCWeapon(WeaponInventory[CurrentWeaponIndex]);
 
 	if (Weapon)
 	{
@@ -327,11 +313,7 @@ void AHumanoidNPC::SpawnNextWeapon()
 
 void AHumanoidNPC::DespawnCurrentWeapon()
 {
-	if (Weapon)
-	{
-		Weapon->Destroy();
-		Weapon = nullptr;
-	}
+	ReleaseNPCWeapon();
 }
 
 void AHumanoidNPC::EnterMeleeMode()
@@ -478,12 +460,7 @@ void AHumanoidNPC::ResetForPool(const FVector& NewLocation, const FRotator& NewR
 	// Spawn first weapon fresh from inventory
 	if (WeaponInventory.IsValidIndex(0) && WeaponInventory[0])
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = this;
-		SpawnParams.Instigator = this;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		Weapon = GetWorld()->SpawnActor<AShooterWeapon>(WeaponInventory[0], GetActorTransform(), SpawnParams);
+		Weapon = AcquireNPCWeapon(WeaponInventory[0]);
 		if (Weapon)
 		{
 			Weapon->OnShotFired.AddDynamic(this, &AHumanoidNPC::OnWeaponShotFiredForward);
@@ -501,3 +478,23 @@ void AHumanoidNPC::ResetForPool(const FVector& NewLocation, const FRotator& NewR
 		EnterMeleeMode();
 	}
 }
+
+void AHumanoidNPC::GatherPoolPrewarm(TMap<TSubclassOf<AActor>, int32>& OutCounts, int32 Concurrent) const
+{
+	Super::GatherPoolPrewarm(OutCounts, Concurrent);
+
+	for (const TSubclassOf<AShooterWeapon>& InventoryWeapon : WeaponInventory)
+	{
+		if (InventoryWeapon)
+		{
+			OutCounts.FindOrAdd(InventoryWeapon) += Concurrent;
+		}
+	}
+	for (const TSubclassOf<ADroppedRangedWeapon>& YankDrop : WeaponDropMapping)
+	{
+		if (YankDrop)
+		{
+			OutCounts.FindOrAdd(YankDrop) += Concurrent;
+		}
+	}
+}
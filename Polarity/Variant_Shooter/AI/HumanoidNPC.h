@@ -135,6 +135,9 @@ public:
 	 *  virtual dispatch this method would be hidden and the parent's version would run instead. */
 	virtual void ResetForPool(const FVector& NewLocation, const FRotator& NewRotation) override;
 
+	/** Adds every inventory weapon and its yank drop; a humanoid can go through all of them in one life */
+	virtual void GatherPoolPrewarm(TMap<TSubclassOf<AActor>, int32>& OutCounts, int32 Concurrent) const override;
+
 protected:
 
 	virtual void BeginPlay() override;
@@ -25,6 +25,7 @@
 #include "../Pickups/HealthPickup.h"
 #include "ShooterGameMode.h"
 #include "AICombatCoordinator.h"
+#include "FlightFieldSubsystem.h"
 #include "DrawDebugHelpers.h"
 
 // Console variable: toggle with "Kamikaze.Debug 1" in console
@@ -36,7 +37,7 @@ static TAutoConsoleVariable<int32> CVarKamikazeDebug(
 #include "GeometryCollection/GeometryCollectionActor.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
-#include "Field/FieldSystemObjects.h"
+#include "VFX/GibPoolSubsystem.h"
 
 static const TCHAR* KamikazeStateToString(EKamikazeState S)
 {
@@ -767,7 +768,7 @@ void AKamikazeDroneNPC::UpdateOrbiting(float DeltaTime)
 		QueryParams.AddIgnoredActor(this);
 
 		const FVector GeoRayEnd = GetActorLocation() + ForwardDir * 200.0f;
-		if (GetWorld()->LineTraceSingleByChannel(Hit, GetActorLocation(), GeoRayEnd, ECC_WorldStatic, QueryParams))
+		if (UFlightFieldSubsystem::LineTrace(GetWorld(), Hit, GetActorLocation(), GeoRayEnd, ECC_WorldStatic, QueryParams))
 		{
 			// Obstacle ahead — track time unable to orbit
 			OrbitForcedTimer += GeometryCheckInterval;
@@ -1701,7 +1702,7 @@ void AKamikazeDroneNPC::EvaluateOrbitQuality()
 		const FVector SamplePos = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Radius;
 
 		FHitResult Hit;
-		const bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, Center, SamplePos, ECC_WorldStatic, QueryParams);
+		const bool bHit = UFlightFieldSubsystem::LineTrace(GetWorld(), Hit, Center, SamplePos, ECC_WorldStatic, QueryParams);
 
 		if (bHit)
 		{
@@ -2676,42 +2677,26 @@ void AKamikazeDroneNPC::SpawnDeathGeometryCollection(const FDeathModeConfig& Con
 		return;
 	}
 
-	// Use DroneMesh transform instead of SkeletalMesh
-	const FTransform MeshTransform = DroneMesh ? DroneMesh->GetComponentTransform()
-		: FTransform(GetActorLocation());
-	const FVector Origin = MeshTransform.GetLocation();
-
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AGeometryCollectionActor* GCActor = GetWorld()->SpawnActor<AGeometryCollectionActor>(
-		Origin, MeshTransform.GetRotation().Rotator(), SpawnParams);
-
-	if (!GCActor)
+	UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>();
+	if (!GibPool)
 	{
 		return;
 	}
 
-	UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
-	if (!GCComp)
-	{
-		GCActor->Destroy();
-		return;
-	}
+	// Use DroneMesh transform (the actual visible mesh) instead of hidden SkeletalMesh
+	const FTransform MeshTransform = DroneMesh ? DroneMesh->GetComponentTransform()
+		: FTransform(GetActorLocation());
+	const FVector Origin = MeshTransform.GetLocation();
+
+	FGibSpawnParams Gibs;
+	Gibs.RestCollection = DeathGeometryCollection;
 
 	// Scale GC to match drone visual mesh
-	if (DroneMesh)
-	{
-		GCActor->SetActorScale3D(DroneMesh->GetComponentScale());
-	}
+	Gibs.Transform = FTransform(MeshTransform.GetRotation(), Origin,
+		DroneMesh ? DroneMesh->GetComponentScale() : FVector::OneVector);
 
 	// Collision: gibs collide with world but not pawns/camera
-	GCComp->SetCollisionProfileName(FName("Ragdoll"));
-	GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
-	GCComp->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
-
-	GCComp->SetRestCollection(DeathGeometryCollection);
+	Gibs.CollisionProfile = FName("Ragdoll");
 
 	// Copy materials from DroneMesh to GC gibs
 	if (DroneMesh)
@@ -2719,52 +2704,24 @@ void AKamikazeDroneNPC::SpawnDeathGeometryCollection(const FDeathModeConfig& Con
 		const int32 NumMats = DroneMesh->GetNumMaterials();
 		for (int32 i = 0; i < NumMats; i++)
 		{
-			if (UMaterialInterface* Mat = DroneMesh->GetMaterial(i))
-			{
-				GCComp->SetMaterial(i, Mat);
-			}
+			Gibs.Materials.Add(DroneMesh->GetMaterial(i));
 		}
 	}
 
-	GCComp->SetSimulatePhysics(true);
-	GCComp->RecreatePhysicsState();
-
-	// Break all clusters
-	UUniformScalar* StrainField = NewObject<UUniformScalar>(GCActor);
-	StrainField->Magnitude = 999999.0f;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_ExternalClusterStrain,
-		nullptr, StrainField);
-
-	// Scatter pieces radially
-	URadialVector* RadialVelocity = NewObject<URadialVector>(GCActor);
-	RadialVelocity->Magnitude = Config.DismembermentImpulse;
-	RadialVelocity->Position = Origin;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-		nullptr, RadialVelocity);
-
-	// Angular velocity for tumbling
-	URadialVector* AngularVel = NewObject<URadialVector>(GCActor);
-	AngularVel->Magnitude = Config.DismembermentAngularImpulse;
-	AngularVel->Position = Origin;
-	GCComp->ApplyPhysicsField(true,
-		EGeometryCollectionPhysicsTypeEnum::Chaos_AngularVelocity,
-		nullptr, AngularVel);
-
-	// Directional bias from killing hit direction
+	// Scatter pieces radially, tumble them, and bias them along the killing hit
+	Gibs.FieldOrigin = Origin;
+	Gibs.RadialSpeed = Config.DismembermentImpulse;
+	Gibs.AngularSpeed = Config.DismembermentAngularImpulse;
 	if (!LastKillingHitDirection.IsNearlyZero() && Config.DirectionalBiasMultiplier > 0.0f)
 	{
-		UUniformVector* DirectionalBias = NewObject<UUniformVector>(GCActor);
-		DirectionalBias->Magnitude = Config.DismembermentImpulse * Config.DirectionalBiasMultiplier;
-		DirectionalBias->Direction = LastKillingHitDirection;
-		GCComp->ApplyPhysicsField(true,
-			EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-			nullptr, DirectionalBias);
+		Gibs.BiasDirection = LastKillingHitDirection;
+		Gibs.BiasSpeed = Config.DismembermentImpulse * Config.DirectionalBiasMultiplier;
 	}
 
-	// Auto-destroy gibs
-	GCActor->SetLifeSpan(GibLifetime);
+	// Back to the pool after GibLifetime
+	Gibs.Lifetime = GibLifetime;
+	GibPool->SpawnGibs(Gibs);
+
 }
 
 // ==================== Public Queries ====================
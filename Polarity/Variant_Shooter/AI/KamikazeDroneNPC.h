@@ -401,6 +401,9 @@ public:
 
 	// ==================== Public Interface ====================
 
+	/** A dead kamikaze destroys itself (DeathDestroy), pooled or not */
+	virtual bool CanRecycleThroughPool() const override { return false; }
+
 	/** Get current state */
 	UFUNCTION(BlueprintPure, Category = "Kamikaze")
 	EKamikazeState GetKamikazeState() const { return CurrentState; }
@@ -22,6 +22,7 @@
 #include "../../AI/Components/AIAccuracyComponent.h"
 #include "../../AI/Components/MeleeRetreatComponent.h"
 #include "../../AI/Coordination/AICombatCoordinator.h"
+#include "../../AI/Coordination/AILineOfSightSubsystem.h"
 #include "Variant_Shooter/Weapons/DroppedMeleeWeapon.h"
 #include "Variant_Shooter/Weapons/DroppedRangedWeapon.h"
 #include "EMFVelocityModifier.h"
@@ -51,7 +52,9 @@
 #include "GeometryCollection/GeometryCollectionActor.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
-#include "Field/FieldSystemObjects.h"
+#include "VFX/GibPoolSubsystem.h"
+#include "VFX/VFXManagerSubsystem.h"
+#include "Pooling/ActorPoolSubsystem.h"
 #include "CameraShakeComponent.h"
 
 namespace
@@ -176,12 +179,7 @@ void AShooterNPC::BeginPlay()
 	}
 
 	// spawn the weapon
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = this;
-	SpawnParams.Instigator = this;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	Weapon = GetWorld()->SpawnActor<AShooterWeapon>(WeaponClass, GetActorTransform(), SpawnParams);
+	Weapon = AcquireNPCWeapon(WeaponClass);
 
 	// Subscribe to weapon's shot fired delegate for burst counting
 	if (Weapon)
@@ -189,6 +187,15 @@ void AShooterNPC::BeginPlay()
 		Weapon->OnShotFired.AddDynamic(this, &AShooterNPC::OnWeaponShotFired);
 	}
 
+	// Gib actors for the death collection exist before anything dies (one per ULTRAGORE copy)
+	if (DeathGeometryCollection)
+	{
+		if (UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>())
+		{
+			GibPool->Prewarm(DeathGeometryCollection, bUltragore ? FMath::Max(2, UltragoreGCCount) : -1);
+		}
+	}
+
 	// Register with combat coordinator
 	RegisterWithCoordinator();
 
@@ -513,9 +520,9 @@ void AShooterNPC::Landed(const FHitResult& Hit)
 		}
 		if (WallSlamVFX)
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(), WallSlamVFX, Hit.ImpactPoint, Hit.ImpactNormal.Rotation(),
-				FVector(WallSlamVFXScale), true, true, ENCPoolMethod::AutoRelease);
+			UVFXManagerSubsystem::SpawnSystemAtLocation(
+				this, WallSlamVFX, Hit.ImpactPoint, Hit.ImpactNormal.Rotation(),
+				FVector(WallSlamVFXScale), true, EVFXSignificance::Medium);
 		}
 	}
 
@@ -1011,16 +1018,13 @@ void AShooterNPC::Die()
 
 		if (Roll < DropChance)
 		{
-			FActorSpawnParameters WeaponSpawnParams;
-			WeaponSpawnParams.SpawnCollisionHandlingOverride =
-				ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
 			const FVector SpawnLoc = GetActorLocation() + DropSpawnOffset;
 			UE_LOG(LogTemp, Warning, TEXT("[WeaponDrop] Spawning %s at %s"),
 				*DroppedMeleeWeaponClass->GetName(), *SpawnLoc.ToString());
 
-			ADroppedMeleeWeapon* DroppedWeapon = GetWorld()->SpawnActor<ADroppedMeleeWeapon>(
-				DroppedMeleeWeaponClass, SpawnLoc, GetActorRotation(), WeaponSpawnParams);
+			UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+			ADroppedMeleeWeapon* DroppedWeapon = Pool ? Pool->Acquire<ADroppedMeleeWeapon>(
+				DroppedMeleeWeaponClass, FTransform(GetActorRotation(), SpawnLoc)) : nullptr;
 
 			if (DroppedWeapon)
 			{
@@ -1034,7 +1038,7 @@ void AShooterNPC::Die()
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("[WeaponDrop] FAILED — SpawnActor returned null!"));
+				UE_LOG(LogTemp, Error, TEXT("[WeaponDrop] FAILED — pool returned null!"));
 			}
 		}
 		else
@@ -1062,14 +1066,11 @@ void AShooterNPC::Die()
 			const float Roll = FMath::FRand();
 			if (Roll < Entry.DropChance)
 			{
-				FActorSpawnParameters RangedSpawnParams;
-				RangedSpawnParams.SpawnCollisionHandlingOverride =
-					ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
 				const FVector SpawnLoc = GetActorLocation() + DropSpawnOffset;
 
-				ADroppedRangedWeapon* DroppedRanged = GetWorld()->SpawnActor<ADroppedRangedWeapon>(
-					Entry.DroppedWeaponClass, SpawnLoc, GetActorRotation(), RangedSpawnParams);
+				UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+				ADroppedRangedWeapon* DroppedRanged = Pool ? Pool->Acquire<ADroppedRangedWeapon>(
+					Entry.DroppedWeaponClass, FTransform(GetActorRotation(), SpawnLoc)) : nullptr;
 
 				if (DroppedRanged)
 				{
@@ -1121,9 +1122,10 @@ void AShooterNPC::Die()
 	{
 		// Armor only for the NPC that was directly channeled, NOT for NPCs hit by the thrown NPC
 		UE_LOG(LogTemp, Warning, TEXT("[HP_DROP] %s -> Spawning ARMOR (direct channeling target)"), *GetName());
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		GetWorld()->SpawnActor<AArmorPickup>(ArmorPickupClass, GetActorLocation(), FRotator::ZeroRotator, SpawnParams);
+		if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+		{
+			Pool->Acquire<AArmorPickup>(ArmorPickupClass, FTransform(GetActorLocation()));
+		}
 	}
 	else if (HealthPickupClass &&
 		(bStunnedByExplosion || AHealthPickup::ShouldDropHealth(LastKillingDamageType, LastKillingDamageCauser)))
@@ -1432,7 +1434,8 @@ void AShooterNPC::OnRep_CurrentHP()
 
 void AShooterNPC::OnRep_IsDead()
 {
-	if (bIsDead)
+	// A prewarmed NPC arrives parked: dead and hidden, with no death to show
+	if (bIsDead && !IsHidden())
 	{
 		PlayDeathVisuals();
 	}
@@ -1596,14 +1599,10 @@ void AShooterNPC::ResetForPool(const FVector& NewLocation, const FRotator& NewRo
 		MeleeRetreatComponent->SetComponentTickEnabled(true);
 	}
 
-	// --- Weapon (destroyed during death — spawn fresh) ---
+	// --- Weapon (released during death — take one from the pool) ---
 	if (!Weapon && WeaponClass)
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = this;
-		SpawnParams.Instigator = this;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		Weapon = World->SpawnActor<AShooterWeapon>(WeaponClass, GetActorTransform(), SpawnParams);
+		Weapon = AcquireNPCWeapon(WeaponClass);
 		if (Weapon)
 		{
 			Weapon->OnShotFired.AddDynamic(this, &AShooterNPC::OnWeaponShotFired);
@@ -1663,6 +1662,78 @@ void AShooterNPC::ResetForPool(const FVector& NewLocation, const FRotator& NewRo
 	UE_LOG(LogTemp, Warning, TEXT("ShooterNPC::ResetForPool — %s recycled at %s"), *GetName(), *NewLocation.ToString());
 }
 
+void AShooterNPC::ParkForPool()
+{
+	bIsPooled = true;
+	bIsDead = true;
+
+	// Not alive as far as checkpoint respawn is concerned; ResetForPool registers it again
+	if (UCheckpointSubsystem* CS = GetWorld()->GetSubsystem<UCheckpointSubsystem>())
+	{
+		CS->NotifyNPCDeath(this);
+	}
+
+	// The teardown a pooled death runs, then straight to the hidden state DeferredDestruction leaves
+	DeactivateForDeath(0.0f, true);
+	GetWorldTimerManager().ClearTimer(DeathTimer);
+	DeferredDestruction();
+}
+
+AShooterWeapon* AShooterNPC::AcquireNPCWeapon(TSubclassOf<AShooterWeapon> InWeaponClass)
+{
+	UWorld* World = GetWorld();
+	if (!InWeaponClass || !World)
+	{
+		return nullptr;
+	}
+
+	if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+	{
+		return Pool->Acquire<AShooterWeapon>(InWeaponClass, GetActorTransform(), this, this);
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = this;
+	SpawnParams.Instigator = this;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return World->SpawnActor<AShooterWeapon>(InWeaponClass, GetActorTransform(), SpawnParams);
+}
+
+void AShooterNPC::ReleaseNPCWeapon()
+{
+	if (Weapon)
+	{
+		UActorPoolSubsystem::ReleaseOrDestroy(Weapon);
+		Weapon = nullptr;
+	}
+}
+
+void AShooterNPC::GatherPoolPrewarm(TMap<TSubclassOf<AActor>, int32>& OutCounts, int32 Concurrent) const
+{
+	auto Add = [&OutCounts](TSubclassOf<AActor> ActorClass, int32 Count)
+	{
+		if (ActorClass && Count > 0)
+		{
+			OutCounts.FindOrAdd(ActorClass) += Count;
+		}
+	};
+
+	// Drops are rolled per death, so only the expected share of them is worth having ready
+	auto Expected = [Concurrent](float Chance)
+	{
+		return FMath::CeilToInt(Concurrent * FMath::Clamp(Chance, 0.0f, 1.0f));
+	};
+
+	Add(WeaponClass, Concurrent);
+	Add(DroppedMeleeWeaponClass, Expected(DropWeaponBaseChance));
+	for (const FDroppedRangedWeaponEntry& Entry : DroppedRangedWeaponTable)
+	{
+		Add(Entry.DroppedWeaponClass, Expected(Entry.DropChance));
+	}
+	Add(HealthPickupClass, Concurrent * HealthPickupDropCount);
+	Add(ArmorPickupClass, Concurrent);
+}
+
 // ==================== Death Effects Implementation ====================
 
 const FDeathModeConfig& AShooterNPC::ResolveDeathConfig() const
@@ -1695,23 +1766,42 @@ void AShooterNPC::SpawnDeathGeometryCollection(const FDeathModeConfig& Config)
 		return;
 	}
 
+	UGibPoolSubsystem* GibPool = GetWorld()->GetSubsystem<UGibPoolSubsystem>();
+	if (!GibPool)
+	{
+		return;
+	}
+
 	const FTransform MeshTransform = GetMesh()->GetComponentTransform();
 	const FVector Origin = MeshTransform.GetLocation();
-	const FRotator Rotation = MeshTransform.GetRotation().Rotator();
-	const FVector Scale = GetMesh()->GetComponentScale();
 
-	// Cache materials once
-	TArray<UMaterialInterface*> CachedMaterials;
+	FGibSpawnParams Gibs;
+	Gibs.RestCollection = DeathGeometryCollection;
+	Gibs.Transform = FTransform(MeshTransform.GetRotation(), Origin, GetMesh()->GetComponentScale());
+
+	// Fix collision: gibs should not push pawns
+	Gibs.CollisionProfile = RagdollCollisionProfile;
+
+	// Copy materials from skeletal mesh to GC gibs
 	if (USkeletalMeshComponent* SkelMesh = GetMesh())
 	{
 		const int32 NumMats = SkelMesh->GetNumMaterials();
-		CachedMaterials.Reserve(NumMats);
 		for (int32 i = 0; i < NumMats; i++)
 		{
-			CachedMaterials.Add(SkelMesh->GetMaterial(i));
+			Gibs.Materials.Add(SkelMesh->GetMaterial(i));
 		}
 	}
 
+	// Scatter pieces with config-driven radial velocity, tumbling, and a bias along the killing hit
+	Gibs.RadialSpeed = Config.DismembermentImpulse;
+	Gibs.AngularSpeed = Config.DismembermentAngularImpulse;
+	if (!LastKillingHitDirection.IsNearlyZero() && Config.DirectionalBiasMultiplier > 0.0f)
+	{
+		Gibs.BiasDirection = LastKillingHitDirection;
+		Gibs.BiasSpeed = Config.DismembermentImpulse * Config.DirectionalBiasMultiplier;
+	}
+	Gibs.Lifetime = GibLifetime;
+
 	const int32 CopyCount = bUltragore ? FMath::Max(2, UltragoreGCCount) : 1;
 
 	for (int32 CopyIdx = 0; CopyIdx < CopyCount; CopyIdx++)
@@ -1723,86 +1813,9 @@ void AShooterNPC::SpawnDeathGeometryCollection(const FDeathModeConfig& Config)
 			SpawnLocation += FMath::VRand() * UltragoreSpawnOffset;
 		}
 
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		AGeometryCollectionActor* GCActor = GetWorld()->SpawnActor<AGeometryCollectionActor>(
-			SpawnLocation, Rotation, SpawnParams);
-
-		if (!GCActor)
-		{
-			continue;
-		}
-
-		UGeometryCollectionComponent* GCComp = GCActor->GetGeometryCollectionComponent();
-		if (!GCComp)
-		{
-			GCActor->Destroy();
-			continue;
-		}
-
-		GCActor->SetActorScale3D(Scale);
-
-		// Fix collision: gibs should not push pawns
-		GCComp->SetCollisionProfileName(RagdollCollisionProfile);
-		GCComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
-		GCComp->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
-		GCComp->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
-
-		// Assign GC asset and initialize physics
-		GCComp->SetRestCollection(DeathGeometryCollection);
-
-		// Copy materials from skeletal mesh to GC gibs
-		for (int32 i = 0; i < CachedMaterials.Num(); i++)
-		{
-			if (CachedMaterials[i])
-			{
-				GCComp->SetMaterial(i, CachedMaterials[i]);
-			}
-		}
-
-		GCComp->SetSimulatePhysics(true);
-		GCComp->RecreatePhysicsState();
-
-		// Break all clusters with massive external strain
-		UUniformScalar* StrainField = NewObject<UUniformScalar>(GCActor);
-		StrainField->Magnitude = 999999.0f;
-
-		GCComp->ApplyPhysicsField(true,
-			EGeometryCollectionPhysicsTypeEnum::Chaos_ExternalClusterStrain,
-			nullptr, StrainField);
-
-		// Scatter pieces with config-driven radial velocity
-		URadialVector* RadialVelocity = NewObject<URadialVector>(GCActor);
-		RadialVelocity->Magnitude = Config.DismembermentImpulse;
-		RadialVelocity->Position = SpawnLocation;
-
-		GCComp->ApplyPhysicsField(true,
-			EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-			nullptr, RadialVelocity);
-
-		// Angular velocity for tumbling
-		URadialVector* AngularVelocity = NewObject<URadialVector>(GCActor);
-		AngularVelocity->Magnitude = Config.DismembermentAngularImpulse;
-		AngularVelocity->Position = SpawnLocation;
-
-		GCComp->ApplyPhysicsField(true,
-			EGeometryCollectionPhysicsTypeEnum::Chaos_AngularVelocity,
-			nullptr, AngularVelocity);
-
-		// Directional bias from killing hit direction
-		if (!LastKillingHitDirection.IsNearlyZero() && Config.DirectionalBiasMultiplier > 0.0f)
-		{
-			UUniformVector* DirectionalBias = NewObject<UUniformVector>(GCActor);
-			DirectionalBias->Magnitude = Config.DismembermentImpulse * Config.DirectionalBiasMultiplier;
-			DirectionalBias->Direction = LastKillingHitDirection;
-
-			GCComp->ApplyPhysicsField(true,
-				EGeometryCollectionPhysicsTypeEnum::Chaos_LinearVelocity,
-				nullptr, DirectionalBias);
-		}
-
-		GCActor->SetLifeSpan(GibLifetime);
+		Gibs.Transform.SetLocation(SpawnLocation);
+		Gibs.FieldOrigin = SpawnLocation;
+		GibPool->SpawnGibs(Gibs);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("SpawnDeathGC: %s copies=%d impulse=%.0f angular=%.0f dir=[%.2f,%.2f,%.2f]*%.1f"),
@@ -1994,12 +2007,8 @@ void AShooterNPC::DeactivateForDeath(float DestructionDelay, bool bHideMesh)
 	// Disable actor tick
 	SetActorTickEnabled(false);
 
-	// Destroy weapon
-	if (Weapon)
-	{
-		Weapon->Destroy();
-		Weapon = nullptr;
-	}
+	// Hand the weapon back to the pool
+	ReleaseNPCWeapon();
 
 	// Schedule destruction
 	GetWorld()->GetTimerManager().SetTimer(DeathTimer, this, &AShooterNPC::DeferredDestruction, DestructionDelay, false);
@@ -2139,24 +2148,11 @@ bool AShooterNPC::HasLineOfSightTo(AActor* Target) const
 		return false;
 	}
 
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-	QueryParams.AddIgnoredActor(Target);
-
-	FHitResult HitResult;
 	const FVector Start = GetActorLocation() + FVector(0.0f, 0.0f, 50.0f); // Offset up from center
 	const FVector End = Target->GetActorLocation();
 
-	const bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		Start,
-		End,
-		ECC_Visibility,
-		QueryParams
-	);
-
-	// No blocking hit means we have line of sight
-	return !bHit;
+	// Shared and memoised: tasks and conditions ask this several times a frame
+	return UAILineOfSightSubsystem::HasLineOfSight(this, Target, Start, End, UAILineOfSightSubsystem::SampleBody);
 }
 
 void AShooterNPC::PlayHitReaction(const FVector& DamageDirection)
@@ -2934,15 +2930,14 @@ void AShooterNPC::HandleKnockbackWallHit(const FHitResult& WallHit)
 				// Offset slightly away from wall to prevent clipping
 				FVector VFXLocation = WallHit.ImpactPoint + WallHit.ImpactNormal * 5.0f;
 
-				UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-					GetWorld(),
+				UVFXManagerSubsystem::SpawnSystemAtLocation(
+					this,
 					WallSlamVFX,
 					VFXLocation,
 					VFXRotation,
 					FVector(WallSlamVFXScale),
 					true,
-					true,
-					ENCPoolMethod::None
+					EVFXSignificance::Medium
 				);
 			}
 		}
@@ -3366,15 +3361,14 @@ void AShooterNPC::HandleElasticNPCCollisionWithSpeed(AShooterNPC* OtherNPC, cons
 		// Spawn EMF discharge VFX
 		if (EMFDischargeVFX)
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(),
+			UVFXManagerSubsystem::SpawnSystemAtLocation(
+				this,
 				EMFDischargeVFX,
 				CollisionPoint,
 				FRotator::ZeroRotator,
 				FVector(EMFDischargeVFXScale),
-				true,  // bAutoDestroy
-				true,  // bAutoActivate
-				ENCPoolMethod::None
+				true,
+				EVFXSignificance::Medium
 			);
 		}
 	}
@@ -3390,15 +3384,14 @@ void AShooterNPC::HandleElasticNPCCollisionWithSpeed(AShooterNPC* OtherNPC, cons
 		// Spawn VFX at collision point
 		if (WallSlamVFX)
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(),
+			UVFXManagerSubsystem::SpawnSystemAtLocation(
+				this,
 				WallSlamVFX,
 				CollisionPoint,
 				FRotator::ZeroRotator,
 				FVector(WallSlamVFXScale),
-				true,  // bAutoDestroy
-				true,  // bAutoActivate
-				ENCPoolMethod::None
+				true,
+				EVFXSignificance::Medium
 			);
 		}
 	}
@@ -3406,15 +3399,14 @@ void AShooterNPC::HandleElasticNPCCollisionWithSpeed(AShooterNPC* OtherNPC, cons
 	// NPC-NPC specific impact shockwave (always spawns, separate from EMF/wallslam effects)
 	if (NPCCollisionImpactVFX)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
+		UVFXManagerSubsystem::SpawnSystemAtLocation(
+			this,
 			NPCCollisionImpactVFX,
 			CollisionPoint,
 			FRotator::ZeroRotator,
 			FVector(NPCCollisionImpactVFXScale),
 			true,
-			true,
-			ENCPoolMethod::None
+			EVFXSignificance::Medium
 		);
 	}
 	if (NPCCollisionImpactSound)
@@ -4505,15 +4497,14 @@ void AShooterNPC::OnCapsuleHit(UPrimitiveComponent* HitComponent, AActor* OtherA
 			// Offset slightly away from wall to prevent clipping
 			FVector VFXLocation = Hit.ImpactPoint + Hit.ImpactNormal * 5.0f;
 
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(),
+			UVFXManagerSubsystem::SpawnSystemAtLocation(
+				this,
 				WallSlamVFX,
 				VFXLocation,
 				VFXRotation,
 				FVector(WallSlamVFXScale),
-				true,  // bAutoDestroy
-				true,  // bAutoActivate
-				ENCPoolMethod::None
+				true,
+				EVFXSignificance::Medium
 			);
 		}
 
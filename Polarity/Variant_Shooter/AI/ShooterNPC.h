@@ -267,6 +267,12 @@ protected:
 	/** Pointer to the equipped weapon */
 	TObjectPtr<AShooterWeapon> Weapon;
 
+	/** Take a weapon of this class from the actor pool, owned and instigated by this NPC. Null if the class is. */
+	AShooterWeapon* AcquireNPCWeapon(TSubclassOf<AShooterWeapon> InWeaponClass);
+
+	/** Hand Weapon back to the pool (destroyed if it is not pooled) and clear it */
+	void ReleaseNPCWeapon();
+
 	/** Type of weapon to spawn for this character */
 	UPROPERTY(EditAnywhere, Category = "Weapon")
 	TSubclassOf<AShooterWeapon> WeaponClass;
@@ -1239,6 +1245,20 @@ public:
 	 *  invokes through AShooterNPC* — without virtual, derived overrides are static-dispatch hidden. */
 	virtual void ResetForPool(const FVector& NewLocation, const FRotator& NewRotation);
 
+	/** Take a freshly spawned NPC straight out of play, into the hidden, controller-less state a pooled
+	 *  NPC is left in after its death, without the death itself (no drops, events or effects).
+	 *  ArenaManager prewarms its NPC pool this way so that spawning a wave only recycles. */
+	void ParkForPool();
+
+	/** Whether a dead NPC of this class stays around for ResetForPool. Classes whose death always
+	 *  destroys the actor say no, and ArenaManager neither prewarms nor waits for them. */
+	virtual bool CanRecycleThroughPool() const { return true; }
+
+	/** Add the actor classes this NPC takes from UActorPoolSubsystem (weapon, drops, pickups) to OutCounts,
+	 *  sized for Concurrent of these NPCs alive at once. ArenaManager prewarms the totals.
+	 *  Virtual so subclasses with their own weapon lists can add them. */
+	virtual void GatherPoolPrewarm(TMap<TSubclassOf<AActor>, int32>& OutCounts, int32 Concurrent) const;
+
 	/** Returns true if this NPC is currently shooting */
 	UFUNCTION(BlueprintPure, Category = "Status")
 	bool IsCurrentlyShooting() const { return bIsShooting && !bIsDead; }
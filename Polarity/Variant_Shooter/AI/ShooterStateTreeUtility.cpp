@@ -9,6 +9,7 @@
 #include "Perception/AIPerceptionComponent.h"
 #include "ShooterAIController.h"
 #include "StateTreeAsyncExecutionContext.h"
+#include "AI/Coordination/AILineOfSightSubsystem.h"
 
 bool FStateTreeLineOfSightToTargetCondition::TestCondition(FStateTreeExecutionContext& Context) const
 {
@@ -42,23 +43,16 @@ bool FStateTreeLineOfSightToTargetCondition::TestCondition(FStateTreeExecutionCo
 	// get the character's camera location as the source for the line checks
 	const FVector Start = InstanceData.Character->GetFirstPersonCameraComponent()->GetComponentLocation();
 
-	// ignore the character and target. We want to ensure there's an unobstructed trace not counting them
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(InstanceData.Character);
-	QueryParams.AddIgnoredActor(InstanceData.Target);
-
-	FHitResult OutHit;
-
-	// run a number of vertically offset line traces to the target location
+	// run a number of vertically offset line traces to the target location. The character and target
+	// are ignored: we want an unobstructed trace not counting them. Each height is its own memoised
+	// sample, shared with every other asker this frame.
 	for (int32 i = 0; i < InstanceData.NumberOfVerticalLineOfSightChecks - 1; ++i)
 	{
 		// calculate the endpoint for the trace
 		const FVector End = CenterOfMass + FVector(0.0f, 0.0f, Extent.Z - ExtentZOffset * i);
 
-		InstanceData.Character->GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, QueryParams);
-
 		// is the trace unobstructed?
-		if (!OutHit.bBlockingHit)
+		if (UAILineOfSightSubsystem::HasLineOfSight(InstanceData.Character, InstanceData.Target, Start, End, static_cast<uint8>(UAILineOfSightSubsystem::SampleHeightsFirst + i)))
 		{
 			// we only need one unobstructed trace, so terminate early
 			return InstanceData.bMustHaveLineOfSight;
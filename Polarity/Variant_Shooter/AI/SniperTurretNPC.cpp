@@ -9,6 +9,7 @@
 #include "Engine/SkeletalMesh.h"
 #include "EMFVelocityModifier.h"
 #include "Curves/CurveFloat.h"
+#include "../../AI/Coordination/AILineOfSightSubsystem.h"
 
 ASniperTurretNPC::ASniperTurretNPC(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -488,9 +489,6 @@ bool ASniperTurretNPC::HasLineOfSightTo(AActor* Target) const
 		return false;
 	}
 
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
 	// Start trace from muzzle socket (where the weapon actually fires from)
 	FVector Start;
 	if (TurretMesh && TurretMesh->DoesSocketExist(TurretWeaponSocket))
@@ -516,14 +514,6 @@ bool ASniperTurretNPC::HasLineOfSightTo(AActor* Target) const
 		}
 	}
 
-	FHitResult Hit;
-	const bool bHit = GetWorld()->LineTraceSingleByChannel(
-		Hit, Start, End, ECC_Visibility, QueryParams);
-
-	if (bHit)
-	{
-		return Hit.GetActor() == Target;
-	}
-
-	return true;
+	// The target is left out of the trace rather than accepted as the thing hit: same answer
+	return UAILineOfSightSubsystem::HasLineOfSight(this, Target, Start, End, UAILineOfSightSubsystem::SampleBody);
 }
@@ -8,6 +8,7 @@
 #include "Variant_Shooter/AI/ShooterNPC.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Pooling/ActorPoolSubsystem.h"
 
 AArmorPickup::AArmorPickup()
 {
@@ -44,9 +45,12 @@ void AArmorPickup::BeginPlay()
 	PickupCollision->OnComponentBeginOverlap.AddDynamic(this, &AArmorPickup::OnPickupOverlap);
 	MagnetTrigger->OnComponentBeginOverlap.AddDynamic(this, &AArmorPickup::OnMagnetOverlap);
 
-	// Start lifetime timer
-	GetWorld()->GetTimerManager().SetTimer(
-		LifetimeTimer, this, &AArmorPickup::OnLifetimeExpired, Lifetime, false);
+	// Pooled pickups start the clock when they are handed out
+	if (!bIsPooled)
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			LifetimeTimer, this, &AArmorPickup::OnLifetimeExpired, Lifetime, false);
+	}
 }
 
 void AArmorPickup::Tick(float DeltaTime)
@@ -124,14 +128,37 @@ void AArmorPickup::OnPickupOverlap(UPrimitiveComponent* OverlappedComponent, AAc
 			true, true, ENCPoolMethod::None);
 	}
 
-	Destroy();
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
 }
 
 // ==================== Lifetime ====================
 
 void AArmorPickup::OnLifetimeExpired()
 {
-	Destroy();
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
+// ==================== Pooling ====================
+
+void AArmorPickup::OnPoolActivate()
+{
+	GetWorld()->GetTimerManager().SetTimer(
+		LifetimeTimer, this, &AArmorPickup::OnLifetimeExpired, Lifetime, false);
+
+	// Collision came back on after the teleport, so nothing overlapping us has been noticed yet
+	PickupCollision->UpdateOverlaps();
+	MagnetTrigger->UpdateOverlaps();
+}
+
+void AArmorPickup::OnPoolDeactivate()
+{
+	GetWorld()->GetTimerManager().ClearTimer(LifetimeTimer);
+}
+
+void AArmorPickup::OnPoolReset()
+{
+	MagnetTarget.Reset();
+	CurrentVelocity = FVector::ZeroVector;
 }
 
 // ==================== Static Helpers ====================
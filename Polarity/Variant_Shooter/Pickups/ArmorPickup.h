@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Pooling/PoolableActor.h"
 #include "ArmorPickup.generated.h"
 
 class USphereComponent;
@@ -20,7 +21,7 @@ class USoundBase;
  * when they enter MagnetRadius. Restores armor on contact.
  */
 UCLASS(Blueprintable)
-class POLARITY_API AArmorPickup : public AActor
+class POLARITY_API AArmorPickup : public AActor, public IPoolableActor
 {
 	GENERATED_BODY()
 
@@ -81,6 +82,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Armor Pickup")
 	static bool ShouldDropArmor(const AShooterNPC* DyingNPC);
 
+	// ==================== IPoolableActor ====================
+
+	virtual void OnPoolCreated() override { bIsPooled = true; }
+	virtual void OnPoolActivate() override;
+	virtual void OnPoolDeactivate() override;
+	virtual void OnPoolReset() override;
+
 protected:
 
 	virtual void BeginPlay() override;
@@ -97,6 +105,9 @@ private:
 	/** Lifetime self-destruct timer */
 	FTimerHandle LifetimeTimer;
 
+	/** Owned by UActorPoolSubsystem: the lifetime starts on activation, not in BeginPlay */
+	bool bIsPooled = false;
+
 	/** Called when player enters magnet trigger radius */
 	UFUNCTION()
 	void OnMagnetOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -105,6 +116,6 @@ private:
 	UFUNCTION()
 	void OnPickupOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
-	/** Destroy after lifetime expires */
+	/** Back to the pool (or destroyed) after lifetime expires */
 	void OnLifetimeExpired();
 };
@@ -11,6 +11,7 @@
 #include "Upgrades/UpgradeManagerComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Pooling/ActorPoolSubsystem.h"
 
 AHealthPickup::AHealthPickup()
 {
@@ -47,16 +48,12 @@ void AHealthPickup::BeginPlay()
 	PickupCollision->OnComponentBeginOverlap.AddDynamic(this, &AHealthPickup::OnPickupOverlap);
 	MagnetTrigger->OnComponentBeginOverlap.AddDynamic(this, &AHealthPickup::OnMagnetOverlap);
 
-	// If bursting, disable overlaps until the arc flight completes
-	if (bIsBursting)
+	// Pooled pickups start the clock when they are handed out
+	if (!bIsPooled)
 	{
-		PickupCollision->SetGenerateOverlapEvents(false);
-		MagnetTrigger->SetGenerateOverlapEvents(false);
+		GetWorld()->GetTimerManager().SetTimer(
+			LifetimeTimer, this, &AHealthPickup::OnLifetimeExpired, Lifetime, false);
 	}
-
-	// Start lifetime timer
-	GetWorld()->GetTimerManager().SetTimer(
-		LifetimeTimer, this, &AHealthPickup::OnLifetimeExpired, Lifetime, false);
 }
 
 void AHealthPickup::Tick(float DeltaTime)
@@ -124,6 +121,11 @@ void AHealthPickup::InitBurst(const FVector& TargetLocation)
 	BurstStartLocation = GetActorLocation();
 	BurstTargetLocation = TargetLocation;
 	BurstElapsedTime = 0.0f;
+
+	// Disable overlaps until the arc flight completes. InitBurst runs after BeginPlay (spawned)
+	// or OnPoolActivate (pooled), so this is the one place both paths pass through.
+	PickupCollision->SetGenerateOverlapEvents(false);
+	MagnetTrigger->SetGenerateOverlapEvents(false);
 }
 
 void AHealthPickup::OnBurstComplete()
@@ -198,14 +200,38 @@ void AHealthPickup::OnPickupOverlap(UPrimitiveComponent* OverlappedComponent, AA
 			true, true, ENCPoolMethod::None);
 	}
 
-	Destroy();
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
 }
 
 // ==================== Lifetime ====================
 
 void AHealthPickup::OnLifetimeExpired()
 {
-	Destroy();
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
+// ==================== Pooling ====================
+
+void AHealthPickup::OnPoolActivate()
+{
+	GetWorld()->GetTimerManager().SetTimer(
+		LifetimeTimer, this, &AHealthPickup::OnLifetimeExpired, Lifetime, false);
+}
+
+void AHealthPickup::OnPoolDeactivate()
+{
+	GetWorld()->GetTimerManager().ClearTimer(LifetimeTimer);
+}
+
+void AHealthPickup::OnPoolReset()
+{
+	bIsBursting = false;
+	BurstElapsedTime = 0.0f;
+	MagnetTarget.Reset();
+	CurrentVelocity = FVector::ZeroVector;
+
+	PickupCollision->SetGenerateOverlapEvents(true);
+	MagnetTrigger->SetGenerateOverlapEvents(true);
 }
 
 // ==================== Static Helpers ====================
@@ -243,8 +269,11 @@ void AHealthPickup::SpawnHealthPickups(UWorld* World, TSubclassOf<AHealthPickup>
 	// Add a random rotation so the pattern isn't always aligned to world axes
 	const float RandomBaseAngle = FMath::FRandRange(0.0f, 360.0f);
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>();
+	if (!Pool)
+	{
+		return;
+	}
 
 	for (int32 i = 0; i < Count; ++i)
 	{
@@ -288,7 +317,7 @@ void AHealthPickup::SpawnHealthPickups(UWorld* World, TSubclassOf<AHealthPickup>
 		}
 
 		// Spawn at the kill center, then burst-fly to the landing spot
-		AHealthPickup* Pickup = World->SpawnActor<AHealthPickup>(PickupClass, KillLocation, FRotator::ZeroRotator, SpawnParams);
+		AHealthPickup* Pickup = Pool->Acquire<AHealthPickup>(PickupClass, FTransform(KillLocation));
 		if (Pickup)
 		{
 			Pickup->InitBurst(LandingLocation);
@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Pooling/PoolableActor.h"
 #include "HealthPickup.generated.h"
 
 class USphereComponent;
@@ -21,7 +22,7 @@ class AEMFPhysicsProp;
  * when they enter MagnetRadius. Restores HP on contact.
  */
 UCLASS(Blueprintable)
-class POLARITY_API AHealthPickup : public AActor
+class POLARITY_API AHealthPickup : public AActor, public IPoolableActor
 {
 	GENERATED_BODY()
 
@@ -115,6 +116,13 @@ public:
 	static void SpawnHealthPickups(UWorld* World, TSubclassOf<AHealthPickup> PickupClass,
 		const FVector& KillLocation, int32 Count, float ScatterRadius, float FloorOffset);
 
+	// ==================== IPoolableActor ====================
+
+	virtual void OnPoolCreated() override { bIsPooled = true; }
+	virtual void OnPoolActivate() override;
+	virtual void OnPoolDeactivate() override;
+	virtual void OnPoolReset() override;
+
 protected:
 
 	virtual void BeginPlay() override;
@@ -150,6 +158,9 @@ private:
 	/** Lifetime self-destruct timer */
 	FTimerHandle LifetimeTimer;
 
+	/** Owned by UActorPoolSubsystem: the lifetime starts on activation, not in BeginPlay */
+	bool bIsPooled = false;
+
 	/** Called when player enters magnet trigger radius */
 	UFUNCTION()
 	void OnMagnetOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -158,6 +169,6 @@ private:
 	UFUNCTION()
 	void OnPickupOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
-	/** Destroy after lifetime expires */
+	/** Back to the pool (or destroyed) after lifetime expires */
 	void OnLifetimeExpired();
 };
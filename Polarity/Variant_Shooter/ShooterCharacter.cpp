@@ -7,6 +7,7 @@
 #include "ShooterWeapon.h"
 #include "Upgrades/Upgrades/Upgrade_ChargedPunch.h"
 #include "Weapons/ShooterWeapon_Melee.h"
+#include "Weapons/ShooterWeapon_Shotgun.h"
 #include "Weapons/DroppedRangedWeapon.h"
 #include "Weapons/RiotShield.h"
 #include "UI/EMFChargeWidgetSubsystem.h"
@@ -898,8 +899,7 @@ void AShooterCharacter::DealDamage(AActor* HitActor, float Damage, TSubclassOf<U
 	Server_ReportDamage(HitActor, Damage, DamageTypeClass, Weapon);
 }
 
-void AShooterCharacter::Server_FireProjectile_Implementation(AShooterWeapon* Weapon,
-	const FTransform& ProjectileTransform, float ChargeMultiplier)
+bool AShooterCharacter::IsPlausibleShotOrigin(AShooterWeapon* Weapon, const FVector& MuzzleLocation) const
 {
 	// Same trust model as a reported hit: the client decided where its shot came from, and the server
 	// checks that the answer is possible rather than re-deriving it.
@@ -907,23 +907,45 @@ void AShooterCharacter::Server_FireProjectile_Implementation(AShooterWeapon* Wea
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[NET_DEBUG] %s asked to fire a projectile from a weapon it does not own (%s) - rejected"),
 			*GetName(), *GetNameSafe(Weapon));
-		return;
+		return false;
 	}
 
 	// A muzzle sits on the character holding it. The margin is loose on purpose: the character has
 	// moved on this machine since the client fired, and the muzzle is an arm's length out in front.
 	static constexpr float MuzzleMarginCm = 500.0f;
-	const float MuzzleDistance = FVector::Dist(GetActorLocation(), ProjectileTransform.GetLocation());
+	const float MuzzleDistance = FVector::Dist(GetActorLocation(), MuzzleLocation);
 	if (MuzzleDistance > MuzzleMarginCm)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[NET_DEBUG] %s reported a muzzle %.0f cm away from itself - rejected"),
 			*GetName(), MuzzleDistance);
+		return false;
+	}
+
+	return true;
+}
+
+void AShooterCharacter::Server_FireProjectile_Implementation(AShooterWeapon* Weapon,
+	const FTransform& ProjectileTransform, float ChargeMultiplier)
+{
+	if (!IsPlausibleShotOrigin(Weapon, ProjectileTransform.GetLocation()))
+	{
 		return;
 	}
 
 	Weapon->SpawnProjectileAtTransform(ProjectileTransform, ChargeMultiplier, /*bCosmeticOnly*/ false);
 }
 
+void AShooterCharacter::Server_FirePellets_Implementation(AShooterWeapon_Shotgun* Weapon,
+	const FTransform& AimTransform, float ChargeMultiplier)
+{
+	if (!IsPlausibleShotOrigin(Weapon, AimTransform.GetLocation()))
+	{
+		return;
+	}
+
+	Weapon->SpawnPelletProjectiles(AimTransform, ChargeMultiplier, /*bCosmeticOnly*/ false);
+}
+
 void AShooterCharacter::Server_ReportDamage_Implementation(AActor* HitActor, float Damage,
 	TSubclassOf<UDamageType> DamageTypeClass, AShooterWeapon* Weapon)
 {
@@ -1148,6 +1170,15 @@ void AShooterCharacter::Server_ReportBeamEffect_Implementation(AShooterWeapon* W
 	}
 }
 
+void AShooterCharacter::Server_ReportPelletVolley_Implementation(AShooterWeapon_Shotgun* Weapon,
+	FVector_NetQuantize Start, FVector_NetQuantizeNormal AimDirection, int32 VolleySeed)
+{
+	if (Weapon && OwnedWeapons.Contains(Weapon))
+	{
+		Weapon->Multicast_PlayPelletVolley(Start, AimDirection, VolleySeed);
+	}
+}
+
 void AShooterCharacter::Server_CaptureProp_Implementation(AEMFPhysicsProp* Prop, float ReportedCaptureRange)
 {
 	if (!Prop || !Prop->bCanBeCaptured)
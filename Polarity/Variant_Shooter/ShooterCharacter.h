@@ -11,6 +11,7 @@
 #include "ShooterCharacter.generated.h"
 
 class AShooterWeapon;
+class AShooterWeapon_Shotgun;
 class UInputAction;
 class UInputComponent;
 class UPawnNoiseEmitterComponent;
@@ -1177,6 +1178,19 @@ public:
 	void Server_FireProjectile(AShooterWeapon* Weapon, const FTransform& ProjectileTransform,
 		float ChargeMultiplier);
 
+	/** Server_FireProjectile for a whole shotgun blast: one call with the aim, and the server turns
+	 *  it into pellets through the same fixed pattern the client used. Checked the same way. */
+	UFUNCTION(Server, Reliable)
+	void Server_FirePellets(AShooterWeapon_Shotgun* Weapon, const FTransform& AimTransform,
+		float ChargeMultiplier);
+
+private:
+	/** What both fire requests check: the weapon is one this character owns and the muzzle is
+	 *  somewhere near it. Logs the rejection under [NET_DEBUG]. */
+	bool IsPlausibleShotOrigin(AShooterWeapon* Weapon, const FVector& MuzzleLocation) const;
+
+public:
+
 	/** Tell the server this client's weapon fired, so it can multicast the muzzle flash and sound
 	 *  to everyone else. A miss carries no damage, so effects need their own way upstream.
 	 *  Unreliable: cosmetic, and a lost one costs a single frame of flash. */
@@ -1189,6 +1203,12 @@ public:
 		float EnergyMultiplier, float OverrideBoltSpeed, float OverrideBoltSpeedVariance,
 		float OverrideBoltLength, float OverrideRandomSeed);
 
+	/** The tracers of a whole shotgun blast in one call: aim line and seed, from which every
+	 *  machine rebuilds the pattern instead of receiving each pellet's endpoints. */
+	UFUNCTION(Server, Unreliable)
+	void Server_ReportPelletVolley(AShooterWeapon_Shotgun* Weapon, FVector_NetQuantize Start,
+		FVector_NetQuantizeNormal AimDirection, int32 VolleySeed);
+
 	// ==================== Coop HUD ====================
 	// A HUD belongs to a screen, and there is one screen per machine. The GameMode used to build a
 	// single widget for player zero, which is the host: clients had no HUD at all. Each character
@@ -1,6 +1,7 @@
 // ShooterDoor.cpp
 
 #include "ShooterDoor.h"
+#include "ShooterDoorRegistry.h"
 #include "Components/BoxComponent.h"
 #include "ShooterKey.h"
 #include "ShooterCharacter.h"
@@ -39,6 +40,12 @@ void AShooterDoor::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Explosions look breakable doors up here instead of scanning the world
+	if (UShooterDoorRegistry* Registry = GetWorld()->GetSubsystem<UShooterDoorRegistry>())
+	{
+		Registry->RegisterDoor(this);
+	}
+
 	// Cache checkpoint subsystem
 	CheckpointSubsystem = GetWorld()->GetSubsystem<UCheckpointSubsystem>();
 
@@ -67,6 +74,11 @@ void AShooterDoor::BeginPlay()
 
 void AShooterDoor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UShooterDoorRegistry* Registry = GetWorld()->GetSubsystem<UShooterDoorRegistry>())
+	{
+		Registry->UnregisterDoor(this);
+	}
+
 	// Unbind from checkpoint subsystem
 	if (CheckpointSubsystem)
 	{
@@ -0,0 +1,48 @@
+// ShooterDoorRegistry.cpp
+
+#include "ShooterDoorRegistry.h"
+#include "ShooterDoor.h"
+#include "Engine/World.h"
+
+bool UShooterDoorRegistry::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Create for all game worlds, skip editor preview worlds
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UShooterDoorRegistry::Deinitialize()
+{
+	Doors.Empty();
+
+	Super::Deinitialize();
+}
+
+void UShooterDoorRegistry::RegisterDoor(AShooterDoor* Door)
+{
+	if (Door)
+	{
+		Doors.AddUnique(Door);
+	}
+}
+
+void UShooterDoorRegistry::UnregisterDoor(AShooterDoor* Door)
+{
+	Doors.RemoveSwap(Door, EAllowShrinking::No);
+}
+
+void UShooterDoorRegistry::GetBreakableDoorsInRadius(const FVector& Center, float Radius, TArray<AShooterDoor*>& OutDoors) const
+{
+	const float RadiusSq = FMath::Square(Radius);
+	for (const TWeakObjectPtr<AShooterDoor>& DoorPtr : Doors)
+	{
+		AShooterDoor* Door = DoorPtr.Get();
+		if (Door && Door->bCanBeBrokenByDrop && FVector::DistSquared(Center, Door->GetActorLocation()) <= RadiusSq)
+		{
+			OutDoors.Add(Door);
+		}
+	}
+}
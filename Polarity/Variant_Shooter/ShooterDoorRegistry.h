@@ -0,0 +1,40 @@
+// ShooterDoorRegistry.h
+// Every door in the world, so explosions find breakable ones without scanning actors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterDoorRegistry.generated.h"
+
+class AShooterDoor;
+
+/**
+ * Doors register in BeginPlay and leave in EndPlay. A prop explosion used to call
+ * GetAllActorsOfClass(AShooterDoor) for the handful of breakable doors in a level, walking every
+ * actor in the world each time, and once per prop in a chain reaction.
+ *
+ * Registers every door rather than only the breakable ones: bCanBeBrokenByDrop is Blueprint
+ * writable, so it is read at query time.
+ */
+UCLASS()
+class POLARITY_API UShooterDoorRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	void RegisterDoor(AShooterDoor* Door);
+	void UnregisterDoor(AShooterDoor* Door);
+
+	/** Doors with bCanBeBrokenByDrop whose actor location is within Radius of Center */
+	void GetBreakableDoorsInRadius(const FVector& Center, float Radius, TArray<AShooterDoor*>& OutDoors) const;
+
+	int32 GetNumDoors() const { return Doors.Num(); }
+
+private:
+	TArray<TWeakObjectPtr<AShooterDoor>> Doors;
+};
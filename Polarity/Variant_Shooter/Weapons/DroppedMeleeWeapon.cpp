@@ -6,6 +6,7 @@
 #include "Variant_Shooter/ShooterCharacter.h"
 #include "Variant_Shooter/UI/EMFChargeWidgetSubsystem.h"
 #include "EMF_FieldComponent.h"
+#include "EMFSourceIndexSubsystem.h"
 #include "EMFVelocityModifier.h"
 #include "Components/StaticMeshComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -14,6 +15,7 @@
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "GeometryCollection/GeometryCollectionObject.h"
 #include "Field/FieldSystemObjects.h"
+#include "Pooling/ActorPoolSubsystem.h"
 
 ADroppedMeleeWeapon::ADroppedMeleeWeapon()
 {
@@ -39,6 +41,22 @@ void ADroppedMeleeWeapon::BeginPlay()
 		FieldComponent ? *FieldComponent->GetName() : TEXT("NULL"),
 		WeaponMesh ? *WeaponMesh->GetName() : TEXT("NULL"));
 
+	DefaultCharge = GetCharge();
+
+	// Same as ADroppedRangedWeapon: a stable source id for the LOS cache, for every later trip into the registry
+	if (FieldComponent)
+	{
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(FieldComponent);
+		}
+	}
+
+	// Parked until the pool hands it out; a charge sitting under the level is still a field source
+	if (bIsPooled && FieldComponent)
+	{
+		FieldComponent->UnregisterFromRegistry();
+	}
 }
 
 void ADroppedMeleeWeapon::Tick(float DeltaTime)
@@ -176,7 +194,7 @@ void ADroppedMeleeWeapon::CompletePull()
 
 	if (!PullingCharacter.IsValid() || !MeleeWeaponClass)
 	{
-		Destroy();
+		UActorPoolSubsystem::ReleaseOrDestroy(this);
 		return;
 	}
 
@@ -218,7 +236,51 @@ void ADroppedMeleeWeapon::CompletePull()
 	}
 
 	// Destroy this world actor (weapon is now in player's inventory)
-	Destroy();
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
+// ==================== Pooling ====================
+
+void ADroppedMeleeWeapon::OnPoolActivate()
+{
+	WeaponMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	WeaponMesh->SetSimulatePhysics(true);
+
+	if (FieldComponent)
+	{
+		FieldComponent->RegisterWithRegistry();
+	}
+}
+
+void ADroppedMeleeWeapon::OnPoolDeactivate()
+{
+	WeaponMesh->SetSimulatePhysics(false);
+
+	if (FieldComponent)
+	{
+		FieldComponent->UnregisterFromRegistry();
+	}
+
+	if (UEMFChargeWidgetSubsystem* WidgetSub = GetWorld()->GetSubsystem<UEMFChargeWidgetSubsystem>())
+	{
+		WidgetSub->UnregisterDroppedWeapon(this);
+	}
+}
+
+void ADroppedMeleeWeapon::OnPoolReset()
+{
+	bIsBeingPulled = false;
+	bPullComplete = false;
+	PullElapsed = 0.0f;
+	PullingCharacter.Reset();
+
+	// Straight into the field component: SetCharge would also register a charge widget
+	if (FieldComponent)
+	{
+		FEMSourceDescription Desc = FieldComponent->GetSourceDescription();
+		Desc.PointChargeParams.Charge = DefaultCharge;
+		FieldComponent->SetSourceDescription(Desc);
+	}
 }
 
 // ==================== Geometry Collection Break ====================
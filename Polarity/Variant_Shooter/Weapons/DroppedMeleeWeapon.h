@@ -7,6 +7,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Pooling/PoolableActor.h"
 #include "DroppedMeleeWeapon.generated.h"
 
 class UStaticMeshComponent;
@@ -17,7 +18,7 @@ class UGeometryCollection;
 class USoundBase;
 
 UCLASS(Blueprintable)
-class POLARITY_API ADroppedMeleeWeapon : public AActor
+class POLARITY_API ADroppedMeleeWeapon : public AActor, public IPoolableActor
 {
 	GENERATED_BODY()
 
@@ -114,6 +115,13 @@ public:
 	 *  Called by ShooterWeapon_Melee when weapon breaks. */
 	void SpawnBreakGC(const FTransform& BreakTransform);
 
+	// ==================== IPoolableActor ====================
+
+	virtual void OnPoolCreated() override { bIsPooled = true; }
+	virtual void OnPoolActivate() override;
+	virtual void OnPoolDeactivate() override;
+	virtual void OnPoolReset() override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
@@ -135,4 +143,12 @@ private:
 
 	/** Called when pull interpolation completes: hide self, grant weapon */
 	void CompletePull();
+
+	// ==================== Pooling ====================
+
+	/** Owned by UActorPoolSubsystem: stays out of the EMF registry until handed out */
+	bool bIsPooled = false;
+
+	/** Charge the blueprint gave the field component; a reused drop starts from it again */
+	float DefaultCharge = 0.0f;
 };
@@ -7,6 +7,7 @@
 #include "Variant_Shooter/AI/ShooterNPC.h"
 #include "Variant_Shooter/UI/EMFChargeWidgetSubsystem.h"
 #include "EMF_FieldComponent.h"
+#include "EMFSourceIndexSubsystem.h"
 #include "EMFVelocityModifier.h"
 #include "Upgrades/UpgradeManagerComponent.h"
 #include "Upgrades/Upgrades/Upgrade_AirKick.h"
@@ -17,6 +18,7 @@
 #include "Camera/PlayerCameraManager.h"
 #include "Engine/DamageEvents.h"
 #include "Net/UnrealNetwork.h"
+#include "Pooling/ActorPoolSubsystem.h"
 
 ADroppedRangedWeapon::ADroppedRangedWeapon()
 {
@@ -56,6 +58,16 @@ void ADroppedRangedWeapon::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 
 void ADroppedRangedWeapon::OnRep_DropCharge()
 {
+	// A drop the server just put back in its pool arrives hidden with its charge reset; no widget for it
+	if (IsHidden())
+	{
+		if (UEMFChargeWidgetSubsystem* WidgetSub = GetWorld()->GetSubsystem<UEMFChargeWidgetSubsystem>())
+		{
+			WidgetSub->UnregisterDroppedRangedWeapon(this);
+		}
+		return;
+	}
+
 	// Through the normal setter so anything hanging off charge (widget, visuals) behaves as it does
 	// on the server.
 	SetCharge(ReplicatedCharge);
@@ -95,6 +107,28 @@ void ADroppedRangedWeapon::BeginPlay()
 		WeaponMesh->OnComponentHit.AddDynamic(this, &ADroppedRangedWeapon::OnWeaponMeshHit);
 	}
 
+	DefaultCharge = GetCharge();
+
+	// A drop tumbles and gets pulled around; known to the source index it keeps one id for the LOS
+	// cache. Once is enough: while the field is out of the registry (parked, being pulled) the index skips it.
+	if (FieldComponent)
+	{
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(FieldComponent);
+		}
+	}
+
+	// Parked until the pool hands it out; OnPoolActivate registers the field and rolls the ammo
+	if (bIsPooled)
+	{
+		if (FieldComponent)
+		{
+			FieldComponent->UnregisterFromRegistry();
+		}
+		return;
+	}
+
 	// Opt-in yank-style limited ammo for death drops. Skip if the yank path already rolled
 	// (SpawnedBulletCount >= 0 means RollSpawnedBulletCount ran before BeginPlay, e.g. via
 	// SpawnActorDeferred — though current callers don't use that pattern).
@@ -429,7 +463,7 @@ void ADroppedRangedWeapon::CompletePull()
 
 	if (!PullingCharacter.IsValid() || !WeaponClass)
 	{
-		Destroy();
+		UActorPoolSubsystem::ReleaseOrDestroy(this);
 		return;
 	}
 
@@ -537,5 +571,66 @@ void ADroppedRangedWeapon::CompletePull()
 	}
 
 	// Destroy this world actor (weapon is now in player's inventory)
-	Destroy();
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
+// ==================== Pooling ====================
+
+void ADroppedRangedWeapon::OnPoolActivate()
+{
+	// The pool lives on the authority, which is the side that simulates
+	WeaponMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	WeaponMesh->SetSimulatePhysics(true);
+
+	if (FieldComponent)
+	{
+		FieldComponent->RegisterWithRegistry();
+	}
+
+	if (bForceLimitedAmmo && SpawnedBulletCount < 0)
+	{
+		RollSpawnedBulletCount();
+	}
+}
+
+void ADroppedRangedWeapon::OnPoolDeactivate()
+{
+	WeaponMesh->SetSimulatePhysics(false);
+
+	if (FieldComponent)
+	{
+		FieldComponent->UnregisterFromRegistry();
+	}
+
+	if (UEMFChargeWidgetSubsystem* WidgetSub = GetWorld()->GetSubsystem<UEMFChargeWidgetSubsystem>())
+	{
+		WidgetSub->UnregisterDroppedRangedWeapon(this);
+	}
+}
+
+void ADroppedRangedWeapon::OnPoolReset()
+{
+	const ADroppedRangedWeapon* Defaults = GetClass()->GetDefaultObject<ADroppedRangedWeapon>();
+
+	bIsBeingPulled = false;
+	bPullComplete = false;
+	PullElapsed = 0.0f;
+	PullingCharacter.Reset();
+	PullingClientCurrentWeaponClass = nullptr;
+
+	SpawnedBulletCount = -1;
+	bCanStunOnImpact = Defaults->bCanStunOnImpact;
+	LastStunTime = -10.0f;
+	PreImpactVelocity = FVector::ZeroVector;
+	bAirMailBounceConsumed = false;
+	Tags.Remove(UUpgrade_AirKick::TAG_AirMailKicked);
+
+	// Straight into the field component: SetCharge would also register a charge widget
+	if (FieldComponent)
+	{
+		FEMSourceDescription Desc = FieldComponent->GetSourceDescription();
+		Desc.PointChargeParams.Charge = DefaultCharge;
+		FieldComponent->SetSourceDescription(Desc);
+	}
+	ReplicatedCharge = DefaultCharge;
 }
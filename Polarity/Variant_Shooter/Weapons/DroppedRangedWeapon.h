@@ -8,6 +8,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Pooling/PoolableActor.h"
 #include "DroppedRangedWeapon.generated.h"
 
 class UStaticMeshComponent;
@@ -21,7 +22,7 @@ class UCurveFloat;
 struct FHitResult;
 
 UCLASS(Blueprintable)
-class POLARITY_API ADroppedRangedWeapon : public AActor
+class POLARITY_API ADroppedRangedWeapon : public AActor, public IPoolableActor
 {
 	GENERATED_BODY()
 
@@ -160,6 +161,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ammo")
 	void RollSpawnedBulletCount();
 
+	// ==================== IPoolableActor ====================
+
+	virtual void OnPoolCreated() override { bIsPooled = true; }
+	virtual void OnPoolActivate() override;
+	virtual void OnPoolDeactivate() override;
+	virtual void OnPoolReset() override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
@@ -219,4 +227,13 @@ private:
 
 	/** Called when pull interpolation completes: hide self, grant weapon */
 	void CompletePull();
+
+	// ==================== Pooling ====================
+
+	/** Owned by UActorPoolSubsystem (authority only): stays out of the EMF registry until handed out,
+	 *  and the limited-ammo roll happens per use rather than once in BeginPlay */
+	bool bIsPooled = false;
+
+	/** Charge the blueprint gave the field component; a reused drop starts from it again */
+	float DefaultCharge = 0.0f;
 };
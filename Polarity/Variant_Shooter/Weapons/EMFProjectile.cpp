@@ -24,6 +24,8 @@
 // Damage types
 #include "Variant_Shooter/DamageTypes/DamageType_EMFWeapon.h"
 #include "EMFPhysicsProp.h"
+#include "EMFStats.h"
+#include "EMFSourceIndexSubsystem.h"
 
 AEMFProjectile::AEMFProjectile()
 {
@@ -67,6 +69,13 @@ void AEMFProjectile::BeginPlay()
 	if (!bIsPooled && FieldComponent)
 	{
 		FieldComponent->RegisterWithRegistry();
+
+		// A moving source the index does not know gets a new position-hashed id every frame, which
+		// defeats the LOS cache; registered, it keeps its component id
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(FieldComponent);
+		}
 	}
 
 	bDiagnosticLogged = false;
@@ -76,9 +85,9 @@ void AEMFProjectile::BeginPlay()
 		GetProjectileCharge(), GetProjectileMass(), bAffectedByExternalFields);
 }
 
-void AEMFProjectile::Tick(float DeltaTime)
+void AEMFProjectile::TickFlight(float DeltaTime)
 {
-	Super::Tick(DeltaTime);
+	Super::TickFlight(DeltaTime);
 
 	// Charge homing takes over steering: lock onto ONE charged target and curve into it
 	// (guaranteed hit). This replaces the summed field-force steering, which can point the
@@ -309,6 +318,11 @@ void AEMFProjectile::NotifyHit(UPrimitiveComponent* MyComp, AActor* Other, UPrim
 	if (FieldComponent && FieldComponent->IsRegistered())
 	{
 		FieldComponent->UnregisterFromRegistry();
+
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->UnregisterFieldComponent(FieldComponent);
+		}
 	}
 
 	// Critical velocity check — broadcast arena destruction event
@@ -443,6 +457,12 @@ void AEMFProjectile::ResetProjectileState()
 		{
 			FieldComponent->RegisterWithRegistry();
 		}
+
+		// Stable source id for the LOS cache while it flies (see BeginPlay)
+		if (UEMFSourceIndexSubsystem* SourceIndex = GetWorld()->GetSubsystem<UEMFSourceIndexSubsystem>())
+		{
+			SourceIndex->RegisterFieldComponent(FieldComponent);
+		}
 	}
 
 	bDiagnosticLogged = false;
@@ -605,6 +625,8 @@ void AEMFProjectile::TransferChargeToActor(AActor* HitActor)
 
 void AEMFProjectile::ApplyEMForces(float DeltaTime)
 {
+	EMF_SCOPE_CYCLE_COUNTER(ReceiverUpdate);
+
 	if (!FieldComponent || !ProjectileMovement)
 	{
 		return;
@@ -712,6 +734,7 @@ void AEMFProjectile::ApplyEMForces(float DeltaTime)
 			{
 				LOSEnd = Source.Position - ToSource.GetSafeNormal() * LOSEndShrink;
 
+				EMF_INC_DWORD_STAT(LOSSyncTraces);
 				FHitResult LOSHit;
 				FCollisionQueryParams LOSParams(SCENE_QUERY_STAT(EMFProjectile_LOS), true, this);
 				bBlocked = GetWorld()->LineTraceSingleByChannel(
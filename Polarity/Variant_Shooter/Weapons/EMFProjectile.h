@@ -38,7 +38,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void TickFlight(float DeltaTime) override;
 	virtual void NotifyHit(class UPrimitiveComponent* MyComp, AActor* Other, UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
 
 public:
@@ -284,7 +284,7 @@ protected:
 	/** Apply electromagnetic forces to projectile velocity */
 	void ApplyEMForces(float DeltaTime);
 
-	/** Update single-target charge-scaled homing (called from Tick when bUseChargeHoming). */
+	/** Update single-target charge-scaled homing (called from TickFlight when bUseChargeHoming). */
 	void UpdateChargeHoming(float DeltaTime);
 
 	/** Select the best homing target by charge-weighted cone score, with stickiness toward the current target.
@@ -3,13 +3,298 @@
 #include "EnemyBeamBoltSubsystem.h"
 #include "ShooterWeapon.h"
 #include "NiagaraComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarBoltAsyncEnemyTraces(
+	TEXT("Bolt.AsyncEnemyTraces"),
+	1,
+	TEXT("1=enemy hitscan shots are traced async and resolved when the traces land next frame, 0=traced synchronously when fired"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBoltVectorised(
+	TEXT("Bolt.Vectorised"),
+	1,
+	TEXT("1=bolt windows are tested four at a time with vector instructions, 0=one at a time"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GBoltTraceReportCmd(
+	TEXT("Bolt.TraceReport"),
+	TEXT("Print enemy fire traces per source class since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UEnemyBeamBoltSubsystem* Bolts = World ? World->GetSubsystem<UEnemyBeamBoltSubsystem>() : nullptr)
+		{
+			Bolts->ReportStats();
+		}
+	}));
+
+DECLARE_STATS_GROUP(TEXT("Enemy Fire"), STATGROUP_EnemyFire, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sync Traces"), STAT_EnemyFire_SyncTraces, STATGROUP_EnemyFire);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Traces"), STAT_EnemyFire_AsyncTraces, STATGROUP_EnemyFire);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Shots"), STAT_EnemyFire_PendingShots, STATGROUP_EnemyFire);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Bolts"), STAT_EnemyFire_ActiveBolts, STATGROUP_EnemyFire);
+
+namespace EnemyBeamBolt
+{
+	static void RunBenchmark(int32 NumBolts);
+
+	/** A shot whose traces have not come back after this long is dropped (world paused, traces flushed) */
+	static constexpr double PendingShotTimeout = 1.0;
+
+	/** UserData packs which of its two traces this is (bit 0), the pending slot (bits 1-15) and the
+	 *  slot's serial (bits 16-31) */
+	static constexpr int32 MaxPendingShots = 1 << 15;
+
+	static uint32 MakeTraceUserData(int32 Slot, uint16 Serial, bool bPawnTrace)
+	{
+		return (static_cast<uint32>(Serial) << 16) | (static_cast<uint32>(Slot) << 1) | (bPawnTrace ? 1u : 0u);
+	}
+}
+
+static FAutoConsoleCommand GBoltBenchmarkCmd(
+	TEXT("Bolt.Benchmark"),
+	TEXT("Time the bolt advance/window pass on synthetic bolts, scalar and vectorised; timing only, nothing is checked. Bolt.Benchmark [NumBolts] (default 1000 and 10000)"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0)
+		{
+			EnemyBeamBolt::RunBenchmark(FMath::Max(FCString::Atoi(*Args[0]), 1));
+			return;
+		}
+		EnemyBeamBolt::RunBenchmark(1000);
+		EnemyBeamBolt::RunBenchmark(10000);
+	}));
+
+// ==================== Hot Bolt Storage ====================
+
+void FEnemyBeamBoltHot::Add(const FVector& Start, const FVector& Dir, float InFront, float InSpeed, float InMaxDist,
+	float InBeamLength, float HitRadius, int32 InVictimSlot)
+{
+	StartX.Add(Start.X);
+	StartY.Add(Start.Y);
+	StartZ.Add(Start.Z);
+	DirX.Add(Dir.X);
+	DirY.Add(Dir.Y);
+	DirZ.Add(Dir.Z);
+	Front.Add(InFront);
+	Speed.Add(InSpeed);
+	MaxDist.Add(InMaxDist);
+	BeamLength.Add(InBeamLength);
+	HitRadiusSq.Add(HitRadius * HitRadius);
+	VictimSlot.Add(InVictimSlot);
+	VictimX.Add(0.0f);
+	VictimY.Add(0.0f);
+	VictimZ.Add(0.0f);
+	HasVictim.Add(0.0f);
+}
+
+void FEnemyBeamBoltHot::RemoveAtSwap(int32 Index)
+{
+	StartX.RemoveAtSwap(Index, EAllowShrinking::No);
+	StartY.RemoveAtSwap(Index, EAllowShrinking::No);
+	StartZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	DirX.RemoveAtSwap(Index, EAllowShrinking::No);
+	DirY.RemoveAtSwap(Index, EAllowShrinking::No);
+	DirZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	Front.RemoveAtSwap(Index, EAllowShrinking::No);
+	Speed.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxDist.RemoveAtSwap(Index, EAllowShrinking::No);
+	BeamLength.RemoveAtSwap(Index, EAllowShrinking::No);
+	HitRadiusSq.RemoveAtSwap(Index, EAllowShrinking::No);
+	VictimSlot.RemoveAtSwap(Index, EAllowShrinking::No);
+	VictimX.RemoveAtSwap(Index, EAllowShrinking::No);
+	VictimY.RemoveAtSwap(Index, EAllowShrinking::No);
+	VictimZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	HasVictim.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void FEnemyBeamBoltHot::Reset()
+{
+	StartX.Reset();
+	StartY.Reset();
+	StartZ.Reset();
+	DirX.Reset();
+	DirY.Reset();
+	DirZ.Reset();
+	Front.Reset();
+	Speed.Reset();
+	MaxDist.Reset();
+	BeamLength.Reset();
+	HitRadiusSq.Reset();
+	VictimSlot.Reset();
+	VictimX.Reset();
+	VictimY.Reset();
+	VictimZ.Reset();
+	HasVictim.Reset();
+}
+
+void FEnemyBeamBoltHot::GatherVictims(TConstArrayView<FVector4f> VictimLocations)
+{
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		const int32 Slot = VictimSlot[i];
+		if (VictimLocations.IsValidIndex(Slot))
+		{
+			const FVector4f& Location = VictimLocations[Slot];
+			VictimX[i] = Location.X;
+			VictimY[i] = Location.Y;
+			VictimZ[i] = Location.Z;
+			HasVictim[i] = Location.W;
+		}
+		else
+		{
+			HasVictim[i] = 0.0f;
+		}
+	}
+}
+
+EEnemyBeamBoltOutcome FEnemyBeamBoltHot::Classify(int32 Index) const
+{
+	const float F = Front[Index];
+
+	// Arrival wins: a bolt at the end of its line is done whoever is standing in the window
+	if (F >= MaxDist[Index])
+	{
+		return EEnemyBeamBoltOutcome::Arrived;
+	}
+
+	if (HasVictim[Index] <= 0.0f)
+	{
+		return EEnemyBeamBoltOutcome::InFlight;
+	}
+
+	// Project the victim's CURRENT position onto the frozen beam line
+	const float RelX = VictimX[Index] - StartX[Index];
+	const float RelY = VictimY[Index] - StartY[Index];
+	const float RelZ = VictimZ[Index] - StartZ[Index];
+	const float Dp = RelX * DirX[Index] + RelY * DirY[Index] + RelZ * DirZ[Index];
+	const float PerpSq = RelX * RelX + RelY * RelY + RelZ * RelZ - Dp * Dp;
+
+	const bool bInWindow = (Dp >= 0.0f) && (Dp <= F) && (Dp >= F - BeamLength[Index]);
+	return (bInWindow && PerpSq <= HitRadiusSq[Index]) ? EEnemyBeamBoltOutcome::HitVictim : EEnemyBeamBoltOutcome::InFlight;
+}
+
+void FEnemyBeamBoltHot::Advance(float DeltaTime, TArray<uint8>& OutOutcomes, bool bVectorised)
+{
+	const int32 Count = Num();
+	OutOutcomes.SetNumUninitialized(Count, EAllowShrinking::No);
+
+	int32 i = 0;
+	if (bVectorised)
+	{
+		// Same test as Classify, four lanes at a time. Every lane computes everything and the masks
+		// pick the answer: no branches until the outcome bytes are written.
+		const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+		const VectorRegister4Float Zero = VectorSetFloat1(0.0f);
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			const VectorRegister4Float F = VectorMultiplyAdd(VectorLoad(Speed.GetData() + i), Dt, VectorLoad(Front.GetData() + i));
+			VectorStore(F, Front.GetData() + i);
+
+			const VectorRegister4Float RelX = VectorSubtract(VectorLoad(VictimX.GetData() + i), VectorLoad(StartX.GetData() + i));
+			const VectorRegister4Float RelY = VectorSubtract(VectorLoad(VictimY.GetData() + i), VectorLoad(StartY.GetData() + i));
+			const VectorRegister4Float RelZ = VectorSubtract(VectorLoad(VictimZ.GetData() + i), VectorLoad(StartZ.GetData() + i));
+
+			const VectorRegister4Float Dp = VectorMultiplyAdd(RelZ, VectorLoad(DirZ.GetData() + i),
+				VectorMultiplyAdd(RelY, VectorLoad(DirY.GetData() + i), VectorMultiply(RelX, VectorLoad(DirX.GetData() + i))));
+			const VectorRegister4Float RelSq = VectorMultiplyAdd(RelZ, RelZ, VectorMultiplyAdd(RelY, RelY, VectorMultiply(RelX, RelX)));
+			const VectorRegister4Float PerpSq = VectorSubtract(RelSq, VectorMultiply(Dp, Dp));
+
+			const VectorRegister4Float Arrived = VectorCompareGE(F, VectorLoad(MaxDist.GetData() + i));
+
+			VectorRegister4Float Hit = VectorCompareGT(VectorLoad(HasVictim.GetData() + i), Zero);
+			Hit = VectorBitwiseAnd(Hit, VectorCompareGE(Dp, Zero));
+			Hit = VectorBitwiseAnd(Hit, VectorCompareLE(Dp, F));
+			Hit = VectorBitwiseAnd(Hit, VectorCompareGE(Dp, VectorSubtract(F, VectorLoad(BeamLength.GetData() + i))));
+			Hit = VectorBitwiseAnd(Hit, VectorCompareLE(PerpSq, VectorLoad(HitRadiusSq.GetData() + i)));
+
+			const uint32 ArrivedBits = static_cast<uint32>(VectorMaskBits(Arrived));
+			const uint32 HitBits = static_cast<uint32>(VectorMaskBits(Hit));
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const EEnemyBeamBoltOutcome Outcome = (ArrivedBits & (1u << Lane)) ? EEnemyBeamBoltOutcome::Arrived
+					: (HitBits & (1u << Lane)) ? EEnemyBeamBoltOutcome::HitVictim
+					: EEnemyBeamBoltOutcome::InFlight;
+				OutOutcomes[i + Lane] = static_cast<uint8>(Outcome);
+			}
+		}
+	}
+
+	for (; i < Count; ++i)
+	{
+		Front[i] += Speed[i] * DeltaTime;
+		OutOutcomes[i] = static_cast<uint8>(Classify(i));
+	}
+}
+
+namespace EnemyBeamBolt
+{
+	static void RunBenchmark(int32 NumBolts)
+	{
+		constexpr int32 Iterations = 200;
+		constexpr float DeltaTime = 1.0f / 60.0f;
+
+		// A few players and bolts fired at them from all around, as in a late wave
+		FRandomStream Random(12345);
+		TArray<FVector4f> VictimLocations;
+		for (int32 Victim = 0; Victim < 4; ++Victim)
+		{
+			VictimLocations.Add(FVector4f(Random.FRandRange(-2000.0f, 2000.0f), Random.FRandRange(-2000.0f, 2000.0f), 100.0f, 1.0f));
+		}
+
+		FEnemyBeamBoltHot Source;
+		for (int32 i = 0; i < NumBolts; ++i)
+		{
+			const int32 Slot = Random.RandRange(0, VictimLocations.Num() - 1);
+			const FVector Target(VictimLocations[Slot].X, VictimLocations[Slot].Y, VictimLocations[Slot].Z);
+			const FVector Start = Target + Random.VRand() * Random.FRandRange(500.0f, 8000.0f);
+			const FVector Dir = (Target + Random.VRand() * 150.0f - Start).GetSafeNormal();
+			Source.Add(Start, Dir, 0.0f, Random.FRandRange(2000.0f, 10000.0f), 10000.0f, 500.0f, 80.0f, Slot);
+		}
+		Source.GatherVictims(VictimLocations);
+
+		TArray<uint8> Outcomes;
+		double Seconds[2] = { 0.0, 0.0 };
+		int32 Counts[2][3] = {};
+
+		for (int32 Mode = 0; Mode < 2; ++Mode)
+		{
+			// Copied fresh for each mode so both see the same fronts
+			FEnemyBeamBoltHot Bolts = Source;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Bolts.Advance(DeltaTime, Outcomes, Mode == 1);
+			}
+			Seconds[Mode] = FPlatformTime::Seconds() - StartTime;
+
+			for (uint8 Outcome : Outcomes)
+			{
+				++Counts[Mode][Outcome];
+			}
+		}
+
+		// Times are per pass over all bolts. The outcome counts are printed so a reader can see both
+		// paths classified the same bolts; nothing here compares them.
+		UE_LOG(LogPolarityPerf, Log, TEXT("[BOLT] benchmark %d bolts x %d passes: scalar %.3f us/pass, vectorised %.3f us/pass (%.2fx) | last pass in flight/hit/arrived: scalar %d/%d/%d vectorised %d/%d/%d"),
+			NumBolts, Iterations,
+			Seconds[0] * 1.0e6 / Iterations, Seconds[1] * 1.0e6 / Iterations,
+			Seconds[1] > 0.0 ? Seconds[0] / Seconds[1] : 0.0,
+			Counts[0][0], Counts[0][1], Counts[0][2], Counts[1][0], Counts[1][1], Counts[1][2]);
+	}
+}
+
+// ==================== Bolts ====================
 
 void UEnemyBeamBoltSubsystem::RegisterBolt(AShooterWeapon* Weapon, AActor* Victim,
 	const FVector& Start, const FVector& Dir, float MaxDist, float RandSpeed,
 	float BeamLength, float HitRadius, float EnergyMultiplier,
 	float DamageMultiplier, FName HitBoneName,
 	const FHitResult& ImpactHit, bool bHasImpact,
-	UNiagaraComponent* Tracer)
+	UNiagaraComponent* Tracer, float InitialAge)
 {
 	// A victimless bolt is legitimate: it carries an impact that has to wait until it arrives.
 	if (!Weapon || (!Victim && !bHasImpact))
@@ -17,47 +302,355 @@ void UEnemyBeamBoltSubsystem::RegisterBolt(AShooterWeapon* Weapon, AActor* Victi
 		return;
 	}
 
-	FEnemyBeamBolt Bolt;
+	const float Speed = FMath::Max(RandSpeed, 1.0f);
+	HotBolts.Add(Start, Dir.GetSafeNormal(), Speed * FMath::Max(InitialAge, 0.0f), Speed, MaxDist,
+		FMath::Max(BeamLength, 1.0f), HitRadius, Victim ? AcquireVictimSlot(Victim) : INDEX_NONE);
+
+	FEnemyBeamBoltCold& Bolt = ColdBolts.AddDefaulted_GetRef();
 	Bolt.Weapon = Weapon;
 	Bolt.Victim = Victim;
-	Bolt.Start = Start;
-	Bolt.Dir = Dir.GetSafeNormal();
-	Bolt.MaxDist = MaxDist;
-	Bolt.RandSpeed = FMath::Max(RandSpeed, 1.0f);
-	Bolt.BeamLength = FMath::Max(BeamLength, 1.0f);
-	Bolt.HitRadius = HitRadius;
 	Bolt.EnergyMultiplier = EnergyMultiplier;
 	Bolt.DamageMultiplier = DamageMultiplier;
 	Bolt.HitBoneName = HitBoneName;
 	Bolt.ImpactHit = ImpactHit;
 	Bolt.bHasImpact = bHasImpact;
-	Bolt.Tracer = Tracer;
-	Bolt.Age = 0.0f;
+	if (UVFXManagerSubsystem* VFX = GetWorld()->GetSubsystem<UVFXManagerSubsystem>())
+	{
+		Bolt.Tracer = VFX->GetHandle(Tracer);
+	}
+}
 
-	ActiveBolts.Add(Bolt);
+int32 UEnemyBeamBoltSubsystem::AcquireVictimSlot(AActor* Victim)
+{
+	if (const int32* Found = VictimSlotLookup.Find(Victim))
+	{
+		++VictimBoltCounts[*Found];
+		return *Found;
+	}
+
+	int32 Slot;
+	if (FreeVictimSlots.Num() > 0)
+	{
+		Slot = FreeVictimSlots.Pop(EAllowShrinking::No);
+		Victims[Slot] = Victim;
+		VictimBoltCounts[Slot] = 1;
+	}
+	else
+	{
+		Slot = Victims.Add(Victim);
+		VictimBoltCounts.Add(1);
+	}
+	VictimSlotLookup.Add(Victim, Slot);
+	return Slot;
+}
+
+void UEnemyBeamBoltSubsystem::ReleaseVictimSlot(int32 Slot)
+{
+	if (--VictimBoltCounts[Slot] > 0)
+	{
+		return;
+	}
+
+	// Weak pointers compare by object index and serial, so this still finds a destroyed victim's entry
+	VictimSlotLookup.Remove(Victims[Slot]);
+	Victims[Slot].Reset();
+	FreeVictimSlots.Add(Slot);
+}
+
+void UEnemyBeamBoltSubsystem::RemoveBoltAt(int32 Index)
+{
+	const int32 Slot = HotBolts.VictimSlot[Index];
+
+	HotBolts.RemoveAtSwap(Index);
+	ColdBolts.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Slot != INDEX_NONE)
+	{
+		ReleaseVictimSlot(Slot);
+	}
+}
+
+// ==================== Async Enemy Traces ====================
+
+bool UEnemyBeamBoltSubsystem::QueueEnemyShot(AShooterWeapon* Weapon, const FVector& Start, const FVector& Dir, float EnergyMultiplier)
+{
+	UWorld* World = GetWorld();
+	if (!Weapon || !World || !CVarBoltAsyncEnemyTraces.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	if (!ShotTraceDelegate.IsBound())
+	{
+		ShotTraceDelegate.BindUObject(this, &UEnemyBeamBoltSubsystem::OnShotTraceCompleted);
+	}
+
+	int32 Slot;
+	if (FreePendingSlots.Num() > 0)
+	{
+		Slot = FreePendingSlots.Pop(EAllowShrinking::No);
+	}
+	else if (PendingShots.Num() < EnemyBeamBolt::MaxPendingShots)
+	{
+		Slot = PendingShots.AddDefaulted();
+	}
+	else
+	{
+		// No slot number left to put in UserData: this one is traced synchronously
+		return false;
+	}
+
+	FPendingShot& Shot = PendingShots[Slot];
+	const uint16 Serial = static_cast<uint16>(Shot.Serial + 1);
+	Shot = FPendingShot();
+	Shot.Serial = Serial;
+	Shot.Weapon = Weapon;
+	Shot.Start = Start;
+	Shot.Dir = Dir;
+	Shot.EnergyMultiplier = EnergyMultiplier;
+	Shot.IssueTime = World->GetTimeSeconds();
+	Shot.bInUse = true;
+	++NumPendingShots;
+
+	const FVector End = Start + Dir * (Weapon->MaxHitscanRange * EnergyMultiplier);
+
+	// Same queries as the synchronous path, see AShooterWeapon::PerformSimpleHitscan
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemyHitscan_Async), false);
+	QueryParams.AddIgnoredActor(Weapon);
+	QueryParams.AddIgnoredActor(Weapon->GetOwner());
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ECC_Visibility, QueryParams,
+		FCollisionResponseParams::DefaultResponseParam, &ShotTraceDelegate,
+		EnemyBeamBolt::MakeTraceUserData(Slot, Serial, false));
+
+	// The sync path stops the pawn trace at the wall. Both go out together here, so this one runs the
+	// full range and a pawn behind the wall is thrown away when the two are put together.
+	FCollisionObjectQueryParams PawnObjectParams;
+	PawnObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+	World->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Start, End, PawnObjectParams, QueryParams,
+		&ShotTraceDelegate, EnemyBeamBolt::MakeTraceUserData(Slot, Serial, true));
+
+	NoteEnemyTraces(Weapon->PawnOwner ? Weapon->PawnOwner->GetClass() : Weapon->GetClass(), 2, /*bAsync*/ true);
+	++TotalAsyncShots;
+	return true;
+}
+
+void UEnemyBeamBoltSubsystem::OnShotTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 Slot = static_cast<int32>((Datum.UserData >> 1) & 0x7fffu);
+	const uint16 Serial = static_cast<uint16>(Datum.UserData >> 16);
+	const bool bPawnTrace = (Datum.UserData & 1u) != 0;
+
+	// Timed out, and possibly reused by a later shot since
+	if (!PendingShots.IsValidIndex(Slot) || !PendingShots[Slot].bInUse || PendingShots[Slot].Serial != Serial)
+	{
+		return;
+	}
+
+	FPendingShot& Shot = PendingShots[Slot];
+	const FHitResult* Hit = Datum.OutHits.FindByPredicate([](const FHitResult& H) { return H.bBlockingHit; });
+
+	if (bPawnTrace)
+	{
+		Shot.bPawnDone = true;
+		Shot.bHitPawn = Hit != nullptr;
+		if (Hit)
+		{
+			Shot.PawnHit = *Hit;
+		}
+	}
+	else
+	{
+		Shot.bWallDone = true;
+		Shot.bHitWall = Hit != nullptr;
+		if (Hit)
+		{
+			Shot.WallHit = *Hit;
+		}
+	}
+
+	if (Shot.bWallDone && Shot.bPawnDone)
+	{
+		ResolvePendingShot(Slot);
+	}
+}
+
+void UEnemyBeamBoltSubsystem::ResolvePendingShot(int32 Slot)
+{
+	// Copy out first: resolving registers bolts and may fire more shots, which can grow PendingShots
+	const FPendingShot Shot = PendingShots[Slot];
+	FreePendingShot(Slot);
+
+	AShooterWeapon* Weapon = Shot.Weapon.Get();
+	if (!Weapon)
+	{
+		++TotalDroppedShots;
+		return;
+	}
+
+	// Only a pawn in front of the wall counts, as it would have with the trace stopped there
+	const bool bHitPawn = Shot.bHitPawn && (!Shot.bHitWall || Shot.PawnHit.Distance <= Shot.WallHit.Distance);
+	const float ShotAge = static_cast<float>(GetWorld()->GetTimeSeconds() - Shot.IssueTime);
+
+	Weapon->ResolveSimpleHitscan(Shot.Start, Shot.Dir, Shot.EnergyMultiplier,
+		Shot.WallHit, Shot.bHitWall, bHitPawn ? Shot.PawnHit : FHitResult(), bHitPawn, ShotAge);
+}
+
+void UEnemyBeamBoltSubsystem::DropPendingShots(const AShooterWeapon* Weapon)
+{
+	if (NumPendingShots == 0)
+	{
+		return;
+	}
+
+	// The slot's serial moves on when it is taken again, so the traces still out find nothing
+	for (int32 Slot = 0; Slot < PendingShots.Num(); ++Slot)
+	{
+		if (PendingShots[Slot].bInUse && PendingShots[Slot].Weapon.Get() == Weapon)
+		{
+			FreePendingShot(Slot);
+			++TotalDroppedShots;
+		}
+	}
+}
+
+void UEnemyBeamBoltSubsystem::FreePendingShot(int32 Slot)
+{
+	FPendingShot& Shot = PendingShots[Slot];
+	Shot.bInUse = false;
+	Shot.Weapon.Reset();
+	FreePendingSlots.Add(Slot);
+	--NumPendingShots;
+}
+
+// ==================== Stats ====================
+
+void UEnemyBeamBoltSubsystem::NoteEnemyTraces(const UClass* SourceClass, int32 NumTraces, bool bAsync)
+{
+	if (bAsync)
+	{
+		INC_DWORD_STAT_BY(STAT_EnemyFire_AsyncTraces, NumTraces);
+	}
+	else
+	{
+		INC_DWORD_STAT_BY(STAT_EnemyFire_SyncTraces, NumTraces);
+	}
+
+	FTraceSourceStats& Stats = TraceStatsByClass.FindOrAdd(TObjectKey<UClass>(SourceClass));
+	if (Stats.Frame != GFrameCounter)
+	{
+		Stats.Frame = GFrameCounter;
+		Stats.ThisFrame = 0;
+		++Stats.FramesActive;
+	}
+
+	Stats.ThisFrame += NumTraces;
+	Stats.PeakPerFrame = FMath::Max(Stats.PeakPerFrame, Stats.ThisFrame);
+	(bAsync ? Stats.TotalAsync : Stats.TotalSync) += NumTraces;
+}
+
+void UEnemyBeamBoltSubsystem::ReportStats() const
+{
+	UE_LOG(LogPolarityPerf, Log, TEXT("[BOLT] bolts=%d pending shots=%d | async shots=%llu dropped=%llu | async enemy traces enabled=%d"),
+		HotBolts.Num(), NumPendingShots, TotalAsyncShots, TotalDroppedShots,
+		CVarBoltAsyncEnemyTraces.GetValueOnGameThread());
+
+	for (const TPair<TObjectKey<UClass>, FTraceSourceStats>& Pair : TraceStatsByClass)
+	{
+		const FTraceSourceStats& Stats = Pair.Value;
+		const uint64 Total = Stats.TotalSync + Stats.TotalAsync;
+		const double AvgPerFrame = Stats.FramesActive > 0 ? static_cast<double>(Total) / static_cast<double>(Stats.FramesActive) : 0.0;
+
+		UE_LOG(LogPolarityPerf, Log, TEXT("[BOLT]   %s: traces=%llu (sync=%llu async=%llu) frames=%llu avg/frame=%.1f peak/frame=%d"),
+			*GetNameSafe(Pair.Key.ResolveObjectPtr()), Total, Stats.TotalSync, Stats.TotalAsync,
+			Stats.FramesActive, AvgPerFrame, Stats.PeakPerFrame);
+	}
+}
+
+// ==================== Subsystem Lifecycle ====================
+
+void UEnemyBeamBoltSubsystem::Deinitialize()
+{
+	// A shot's wall or pawn trace may still be out; unbound, it resolves no damage after the world tears down
+	ShotTraceDelegate.Unbind();
+	PendingShots.Empty();
+	FreePendingSlots.Empty();
+	NumPendingShots = 0;
+	HotBolts.Reset();
+	ColdBolts.Empty();
+	Victims.Empty();
+	VictimBoltCounts.Empty();
+	VictimSlotLookup.Empty();
+	FreeVictimSlots.Empty();
+
+	Super::Deinitialize();
 }
 
 void UEnemyBeamBoltSubsystem::Tick(float DeltaTime)
 {
-	for (int32 i = ActiveBolts.Num() - 1; i >= 0; --i)
+	SET_DWORD_STAT(STAT_EnemyFire_PendingShots, NumPendingShots);
+	SET_DWORD_STAT(STAT_EnemyFire_ActiveBolts, HotBolts.Num());
+
+	// Traces that never came back would hold their slot and keep this ticking forever
+	if (NumPendingShots > 0)
 	{
-		FEnemyBeamBolt& Bolt = ActiveBolts[i];
-		Bolt.Age += DeltaTime;
+		const double Now = GetWorld()->GetTimeSeconds();
+		for (int32 Slot = 0; Slot < PendingShots.Num(); ++Slot)
+		{
+			if (PendingShots[Slot].bInUse && Now - PendingShots[Slot].IssueTime > EnemyBeamBolt::PendingShotTimeout)
+			{
+				FreePendingShot(Slot);
+				++TotalDroppedShots;
+			}
+		}
+	}
 
-		AActor* Victim = Bolt.Victim.Get();
-		AShooterWeapon* Weapon = Bolt.Weapon.Get();
-		if (!Weapon || (!Victim && !Bolt.bHasImpact))
+	const int32 NumBolts = HotBolts.Num();
+	if (NumBolts == 0)
+	{
+		return;
+	}
+
+	// One weak pointer resolve per victim, not per bolt
+	VictimLocations.SetNumUninitialized(Victims.Num(), EAllowShrinking::No);
+	for (int32 Slot = 0; Slot < Victims.Num(); ++Slot)
+	{
+		const AActor* Victim = Victims[Slot].Get();
+		VictimLocations[Slot] = Victim ? FVector4f(FVector3f(Victim->GetActorLocation()), 1.0f) : FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+	}
+	HotBolts.GatherVictims(VictimLocations);
+
+	HotBolts.Advance(DeltaTime, Outcomes, CVarBoltVectorised.GetValueOnGameThread() != 0);
+
+	// Back to front, so the bolt swapped into a removed slot has already had its turn. Whatever a hit
+	// or an impact does can register new bolts; they land past NumBolts and wait for next frame.
+	for (int32 i = NumBolts - 1; i >= 0; --i)
+	{
+		const EEnemyBeamBoltOutcome Outcome = static_cast<EEnemyBeamBoltOutcome>(Outcomes[i]);
+		if (Outcome == EEnemyBeamBoltOutcome::InFlight)
 		{
-			ActiveBolts.RemoveAtSwap(i);
 			continue;
 		}
 
-		const float Front = Bolt.RandSpeed * Bolt.Age;
+		const FVector BoltDir(HotBolts.DirX[i], HotBolts.DirY[i], HotBolts.DirZ[i]);
+		const FVector BoltStart(HotBolts.StartX[i], HotBolts.StartY[i], HotBolts.StartZ[i]);
+
+		// Out of the arrays before anything runs that could add to them
+		const FEnemyBeamBoltCold Bolt = MoveTemp(ColdBolts[i]);
+		RemoveBoltAt(i);
+
+		// A bolt whose shooter is gone lands nothing, same as it never would have
+		AShooterWeapon* Weapon = Bolt.Weapon.Get();
+		if (!Weapon)
+		{
+			continue;
+		}
 
 		// Arrived at the end of its line without anybody intercepting it. THIS is when a shot that
 		// hit nothing but scenery is allowed to mark the wall, and when a prop takes the damage:
 		// the pellet is only here now. Something that stepped out of the way is not hurt by it.
-		if (Front >= Bolt.MaxDist)
+		if (Outcome == EEnemyBeamBoltOutcome::Arrived)
 		{
 			if (Bolt.bHasImpact)
 			{
@@ -71,45 +664,32 @@ void UEnemyBeamBoltSubsystem::Tick(float DeltaTime)
 				}
 				Weapon->SpawnImpactEffect(Bolt.ImpactHit);
 			}
-
-			ActiveBolts.RemoveAtSwap(i);
 			continue;
 		}
 
+		AActor* Victim = Bolt.Victim.Get();
 		if (!Victim)
 		{
 			continue;
 		}
 
-		// Project the victim's CURRENT position onto the frozen beam line.
-		const FVector Rel = Victim->GetActorLocation() - Bolt.Start;
-		const float Dp = FVector::DotProduct(Rel, Bolt.Dir);
-		const float Perp = (Rel - Bolt.Dir * Dp).Size();
+		// Synthesize a hit on the victim's CURRENT position and route through the normal
+		// hitscan damage path (friend access to the protected method). The bone is the one the
+		// shot was on course for: there is no trace to ask on arrival.
+		const float Dp = FVector::DotProduct(Victim->GetActorLocation() - BoltStart, BoltDir);
+		FHitResult Hit(Victim, nullptr, Victim->GetActorLocation(), -BoltDir);
+		Hit.Distance = Dp;
+		Hit.BoneName = Bolt.HitBoneName;
+		Weapon->ApplyHitscanDamage(Hit, Bolt.EnergyMultiplier, Dp, 0.0f, Bolt.DamageMultiplier);
 
-		const bool bInWindow = (Dp >= 0.0f) && (Dp <= Bolt.MaxDist)
-			&& (Dp <= Front) && (Dp >= Front - Bolt.BeamLength);
-
-		if (bInWindow && Perp <= Bolt.HitRadius)
+		// The pellet stopped in the body: the impact belongs here and now, whatever was behind
+		// never gets hit, and the streak stops here rather than carrying on to the wall it was
+		// pointed at. Deactivate, not destroy, so the part already drawn fades out instead of
+		// blinking away.
+		Weapon->SpawnImpactEffect(Hit);
+		if (UVFXManagerSubsystem* VFX = GetWorld()->GetSubsystem<UVFXManagerSubsystem>())
 		{
-			// Synthesize a hit on the victim's CURRENT position and route through the normal
-			// hitscan damage path (friend access to the protected method). The bone is the one the
-			// shot was on course for: there is no trace to ask on arrival.
-			FHitResult Hit(Victim, nullptr, Victim->GetActorLocation(), -Bolt.Dir);
-			Hit.Distance = Dp;
-			Hit.BoneName = Bolt.HitBoneName;
-			Weapon->ApplyHitscanDamage(Hit, Bolt.EnergyMultiplier, Dp, 0.0f, Bolt.DamageMultiplier);
-
-			// The pellet stopped in the body: the impact belongs here and now, whatever was behind
-			// never gets hit, and the streak stops here rather than carrying on to the wall it was
-			// pointed at. Deactivate, not destroy, so the part already drawn fades out instead of
-			// blinking away.
-			Weapon->SpawnImpactEffect(Hit);
-			if (UNiagaraComponent* BoltTracer = Bolt.Tracer.Get())
-			{
-				BoltTracer->Deactivate();
-			}
-
-			ActiveBolts.RemoveAtSwap(i);
+			VFX->DeactivateEffect(Bolt.Tracer);
 		}
 	}
 }
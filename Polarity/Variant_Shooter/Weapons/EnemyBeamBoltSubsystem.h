@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Engine/HitResult.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "VFX/VFXManagerSubsystem.h"
 #include "EnemyBeamBoltSubsystem.generated.h"
 
 class AShooterWeapon;
@@ -20,20 +23,16 @@ class UNiagaraComponent;
  * The bolt's leading edge advances at RandSpeed; it only damages the victim if their CURRENT
  * position is still within HitRadius of the line when the window [Front - BeamLength, Front] covers
  * their projected distance — so the victim can dodge by stepping off the line before it arrives.
+ *
+ * Split in two. The geometry every bolt is tested against every frame lives in FEnemyBeamBoltHot,
+ * one array per field; this is the rest, only read when the bolt hits or arrives. Same index in both.
  * All references are weak (no GC keep needed).
  */
-struct FEnemyBeamBolt
+struct FEnemyBeamBoltCold
 {
 	TWeakObjectPtr<AShooterWeapon> Weapon;
 	TWeakObjectPtr<AActor> Victim;
-	FVector Start = FVector::ZeroVector;
-	FVector Dir = FVector::ForwardVector;
-	float MaxDist = 0.0f;
-	float RandSpeed = 1.0f;
-	float BeamLength = 500.0f;
-	float HitRadius = 80.0f;
 	float EnergyMultiplier = 1.0f;
-	float Age = 0.0f;
 
 	/** Everything about the damage that was true when the trigger was pulled and cannot be worked
 	 *  out on arrival: heat, height advantage, target tags, the shooter's upgrades. Folded into one
@@ -53,13 +52,82 @@ struct FEnemyBeamBolt
 
 	/** The streak drawn for this bolt on this machine, if there is one. The bolt puts it out when it
 	 *  stops, so a pellet that buries itself in somebody does not go on flying towards the wall it
-	 *  was aimed at. Weak: the tracer is free to finish and clean itself up on its own. */
-	TWeakObjectPtr<UNiagaraComponent> Tracer;
+	 *  was aimed at. A handle, not a pointer: the tracer is free to finish on its own, and the
+	 *  pooled component may be somebody else's effect by the time the bolt stops. */
+	FVFXHandle Tracer;
+};
+
+/** What a bolt's frame came to */
+enum class EEnemyBeamBoltOutcome : uint8
+{
+	InFlight,
+	HitVictim,
+	Arrived
+};
+
+/**
+ * The per-frame half of every bolt, structure-of-arrays. The tick advances all fronts and tests all
+ * windows in one pass over these (four bolts at a time), then touches FEnemyBeamBoltCold only for
+ * the few that hit or arrived. Positions are float, relative math only: a bolt line is at most
+ * MaxHitscanRange long, well inside float precision at centimetre scale.
+ *
+ * Kept free of the world so Bolt.Benchmark can fill one with synthetic bolts and time it. That is a
+ * timing command and nothing more: it checks no results, and the repo has no automated tests.
+ */
+struct FEnemyBeamBoltHot
+{
+	TArray<float> StartX, StartY, StartZ;
+	TArray<float> DirX, DirY, DirZ;
+
+	/** Distance the leading edge has travelled */
+	TArray<float> Front;
+	TArray<float> Speed;
+	TArray<float> MaxDist;
+	TArray<float> BeamLength;
+	TArray<float> HitRadiusSq;
+
+	/** Index into the subsystem's victim table, INDEX_NONE for a bolt aimed at nobody */
+	TArray<int32> VictimSlot;
+
+	/** Where the victim stood this frame, gathered before the test; HasVictim is 1 when they exist */
+	TArray<float> VictimX, VictimY, VictimZ;
+	TArray<float> HasVictim;
+
+	int32 Num() const { return Front.Num(); }
+
+	void Add(const FVector& Start, const FVector& Dir, float InFront, float InSpeed, float InMaxDist,
+		float InBeamLength, float HitRadius, int32 InVictimSlot);
+
+	/** Same order as TArray::RemoveAtSwap, so a parallel cold array stays in step */
+	void RemoveAtSwap(int32 Index);
+
+	void Reset();
+
+	/** Copy each bolt's victim position out of the per-victim snapshot (XYZ, W = 1 if the victim still exists) */
+	void GatherVictims(TConstArrayView<FVector4f> VictimLocations);
+
+	/** Move every front forward and classify every bolt into OutOutcomes (one EEnemyBeamBoltOutcome each) */
+	void Advance(float DeltaTime, TArray<uint8>& OutOutcomes, bool bVectorised);
+
+private:
+
+	/** Scalar version of one lane; the vectorised loop uses it for the tail */
+	EEnemyBeamBoltOutcome Classify(int32 Index) const;
 };
 
 /**
  * Ticks all active bolts. Centralised in a world subsystem so a bolt outlives the firing weapon's
  * frame and we avoid spawning a per-shot actor. Only ticks while bolts are in flight.
+ *
+ * Also where enemy hitscan shots are traced. An NPC shot used to run its wall trace and its pawn
+ * trace synchronously on the game thread inside the weapon's fire call, so a wave of NPCs firing on
+ * the same frame stalled that frame on physics queries. Since the shot only becomes a bolt that
+ * lands later anyway, QueueEnemyShot issues both traces async instead and resolves the shot through
+ * AShooterWeapon::ResolveSimpleHitscan when they come back next frame, with the bolt starting as
+ * far along as the delay says it should be. Bolt.AsyncEnemyTraces switches back to the old path.
+ *
+ * Traces are counted per frame by the class of whoever fired them ("stat EnemyFire" for totals,
+ * Bolt.TraceReport for the breakdown by class).
  */
 UCLASS()
 class POLARITY_API UEnemyBeamBoltSubsystem : public UTickableWorldSubsystem
@@ -69,7 +137,7 @@ class POLARITY_API UEnemyBeamBoltSubsystem : public UTickableWorldSubsystem
 public:
 
 	/** Register a new travelling bolt down an aim line. Damage is applied to Victim only if/when the
-	 *  moving window reaches their current position within HitRadius. See FEnemyBeamBolt.
+	 *  moving window reaches their current position within HitRadius. See FEnemyBeamBoltCold.
 	 *
 	 *  Victim may be null: a shot that is on course to hit nobody still travels, and still has to
 	 *  arrive somewhere before its impact is allowed to happen. Pass ImpactHit for what is at the
@@ -79,14 +147,110 @@ public:
 		float BeamLength, float HitRadius, float EnergyMultiplier,
 		float DamageMultiplier = 1.0f, FName HitBoneName = NAME_None,
 		const FHitResult& ImpactHit = FHitResult(), bool bHasImpact = false,
-		UNiagaraComponent* Tracer = nullptr);
+		UNiagaraComponent* Tracer = nullptr, float InitialAge = 0.0f);
+
+	/** Trace an enemy hitscan shot async and resolve it when both traces are back. False if async
+	 *  enemy traces are off, in which case the weapon traces synchronously as before. */
+	bool QueueEnemyShot(AShooterWeapon* Weapon, const FVector& Start, const FVector& Dir, float EnergyMultiplier);
+
+	/** Forget Weapon's shots still waiting for their traces (it went back to the pool: a shot fired
+	 *  for its last holder must not resolve for the next one) */
+	void DropPendingShots(const AShooterWeapon* Weapon);
+
+	/** Count traces issued for an enemy shot against the class that fired it (stat EnemyFire, Bolt.TraceReport) */
+	void NoteEnemyTraces(const UClass* SourceClass, int32 NumTraces, bool bAsync);
+
+	/** Per-class trace counts since the level started to the log (Bolt.TraceReport) */
+	void ReportStats() const;
+
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
 
 	// UTickableWorldSubsystem interface
 	virtual void Tick(float DeltaTime) override;
 	virtual TStatId GetStatId() const override;
-	virtual bool IsTickable() const override { return ActiveBolts.Num() > 0; }
+	virtual bool IsTickable() const override { return HotBolts.Num() > 0 || NumPendingShots > 0; }
 
 private:
 
-	TArray<FEnemyBeamBolt> ActiveBolts;
+	/** An enemy shot waiting for its two traces */
+	struct FPendingShot
+	{
+		TWeakObjectPtr<AShooterWeapon> Weapon;
+		FVector Start = FVector::ZeroVector;
+		FVector Dir = FVector::ForwardVector;
+		float EnergyMultiplier = 1.0f;
+		double IssueTime = 0.0;
+
+		/** Bumped each time the slot is taken, and carried in the traces' UserData, so a trace that
+		 *  comes back after its shot timed out cannot land on the shot now using the slot */
+		uint16 Serial = 0;
+
+		FHitResult WallHit;
+		FHitResult PawnHit;
+		bool bHitWall = false;
+		bool bHitPawn = false;
+		bool bWallDone = false;
+		bool bPawnDone = false;
+		bool bInUse = false;
+	};
+
+	/** Trace counts for one source class */
+	struct FTraceSourceStats
+	{
+		uint64 TotalSync = 0;
+		uint64 TotalAsync = 0;
+
+		/** Traces in the frame being counted, and which frame that is */
+		int32 ThisFrame = 0;
+		uint64 Frame = MAX_uint64;
+
+		int32 PeakPerFrame = 0;
+		uint64 FramesActive = 0;
+	};
+
+	void OnShotTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Both traces are in: hand the shot back to its weapon and free the slot */
+	void ResolvePendingShot(int32 Slot);
+
+	void FreePendingShot(int32 Slot);
+
+	/** Slot in Victims for this actor, reusing a free one if it has none, with one more bolt counted on it */
+	int32 AcquireVictimSlot(AActor* Victim);
+
+	/** One bolt aimed at Slot is gone; the last one frees the slot */
+	void ReleaseVictimSlot(int32 Slot);
+
+	void RemoveBoltAt(int32 Index);
+
+	FEnemyBeamBoltHot HotBolts;
+	TArray<FEnemyBeamBoltCold> ColdBolts;
+
+	/** Everybody some bolt is aimed at: a handful of players, so bolts share one weak pointer each.
+	 *  A slot is freed when the last bolt aimed at it retires and reused by the next new victim, so
+	 *  this never holds more than the victims of the bolts in flight. */
+	TArray<TWeakObjectPtr<AActor>> Victims;
+
+	/** Bolts in flight per slot in Victims, 0 for a free slot */
+	TArray<int32> VictimBoltCounts;
+
+	TMap<TWeakObjectPtr<AActor>, int32> VictimSlotLookup;
+	TArray<int32> FreeVictimSlots;
+
+	/** Scratch for Tick */
+	TArray<FVector4f> VictimLocations;
+	TArray<uint8> Outcomes;
+
+	TArray<FPendingShot> PendingShots;
+	TArray<int32> FreePendingSlots;
+	int32 NumPendingShots = 0;
+
+	FTraceDelegate ShotTraceDelegate;
+
+	TMap<TObjectKey<UClass>, FTraceSourceStats> TraceStatsByClass;
+
+	// Lifetime counters for ReportStats
+	uint64 TotalAsyncShots = 0;
+	uint64 TotalDroppedShots = 0;
 };
@@ -0,0 +1,24 @@
+// ManagedProjectileMovementComponent.cpp
+
+#include "ManagedProjectileMovementComponent.h"
+
+FVector UManagedProjectileMovementComponent::ComputeManagedBounce(const FHitResult& Hit, float TimeSlice, const FVector& MoveDelta)
+{
+	return ComputeBounceDelta(Hit, TimeSlice, MoveDelta);
+}
+
+bool UManagedProjectileMovementComponent::SlideAlongSurface(FHitResult& Hit, float& SubTickTimeRemaining)
+{
+	Velocity = ComputeSlideVector(Velocity, 1.0f, Hit.Normal, Hit);
+	if (Velocity.SizeSquared() < FMath::Square(BounceVelocityStopSimulatingThreshold))
+	{
+		StopSimulating(Hit);
+		return false;
+	}
+
+	if (SubTickTimeRemaining <= UE_KINDA_SMALL_NUMBER)
+	{
+		return true;
+	}
+	return HandleSliding(Hit, SubTickTimeRemaining) && !HasStoppedSimulation();
+}
@@ -0,0 +1,36 @@
+// ManagedProjectileMovementComponent.h
+// Projectile movement whose bounce and slide handling UProjectileSimulationSubsystem can call
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "ManagedProjectileMovementComponent.generated.h"
+
+/**
+ * The movement component AShooterProjectile creates. It behaves exactly like
+ * UProjectileMovementComponent when it ticks itself; what it adds is access for
+ * UProjectileSimulationSubsystem to the pieces of the component's own hit handling that are
+ * protected, so a managed projectile bounces and slides through the same code (and the same
+ * overrides) as one that is not, instead of through a copy of it.
+ *
+ * Gravity, homing (ComputeHomingAcceleration) and the speed limit need no access: the subsystem
+ * reaches them through the public ComputeMoveDelta and ComputeVelocity.
+ */
+UCLASS(ClassGroup = Movement, meta = (BlueprintSpawnableComponent))
+class POLARITY_API UManagedProjectileMovementComponent : public UProjectileMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	/** ComputeBounceDelta: the velocity after bouncing off Hit */
+	FVector ComputeManagedBounce(const FHitResult& Hit, float TimeSlice, const FVector& MoveDelta);
+
+	/**
+	 * The sliding case of HandleDeflection, for a projectile whose bounce still points into the
+	 * surface (a grazing hit, or no bounciness): velocity turned along the surface, then the
+	 * component's HandleSliding for the rest of the sub-step. False if the projectile stopped.
+	 */
+	bool SlideAlongSurface(FHitResult& Hit, float& SubTickTimeRemaining);
+};
@@ -0,0 +1,289 @@
+// ProjectileSimulationSubsystem.cpp
+
+#include "ProjectileSimulationSubsystem.h"
+#include "ShooterProjectile.h"
+#include "ManagedProjectileMovementComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "PolarityPerfLog.h"
+
+static TAutoConsoleVariable<int32> CVarProjectileBatchSimulation(
+	TEXT("Projectile.BatchSimulation"),
+	1,
+	TEXT("1=pooled projectiles are moved by the projectile simulation subsystem in one update, 0=each ticks its own movement component (applies to projectiles activated afterwards)"),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GProjectileSimReportCmd(
+	TEXT("Projectile.SimReport"),
+	TEXT("Print managed projectile counts and simulation cost since the level started"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UProjectileSimulationSubsystem* Sim = World ? World->GetSubsystem<UProjectileSimulationSubsystem>() : nullptr)
+		{
+			Sim->ReportStats();
+		}
+	}));
+
+DECLARE_STATS_GROUP(TEXT("Projectile Simulation"), STATGROUP_ProjectileSim, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Steering"), STAT_ProjectileSim_Steering, STATGROUP_ProjectileSim);
+DECLARE_CYCLE_STAT(TEXT("Movement"), STAT_ProjectileSim_Movement, STATGROUP_ProjectileSim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Projectiles"), STAT_ProjectileSim_Managed, STATGROUP_ProjectileSim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Moves"), STAT_ProjectileSim_Moves, STATGROUP_ProjectileSim);
+
+// ==================== Subsystem Lifecycle ====================
+
+bool UProjectileSimulationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Create for all game worlds, skip editor preview worlds
+	if (UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UProjectileSimulationSubsystem::Deinitialize()
+{
+	// Projectiles are destroyed with the world
+	Projectiles.Empty();
+	NumManaged = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UProjectileSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void UProjectileSimulationSubsystem::Tick(float DeltaTime)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Projectiles registered by a hit during this update start flying next frame
+	const int32 Count = Projectiles.Num();
+
+	// Steering first, all of it, so every projectile moves on forces worked out from the same frame
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ProjectileSim_Steering);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (AShooterProjectile* Projectile = Projectiles[i].Get())
+			{
+				Projectile->TickFlight(DeltaTime);
+			}
+		}
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ProjectileSim_Movement);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			AShooterProjectile* Projectile = Projectiles[i].Get();
+			if (!Projectile)
+			{
+				bNeedsCompaction = true;
+				continue;
+			}
+			Simulate(Projectile, DeltaTime);
+		}
+	}
+
+	if (bNeedsCompaction)
+	{
+		Compact();
+	}
+
+	SET_DWORD_STAT(STAT_ProjectileSim_Managed, NumManaged);
+
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+	TotalSeconds += Seconds;
+	PeakSeconds = FMath::Max(PeakSeconds, Seconds);
+	PeakManaged = FMath::Max(PeakManaged, NumManaged);
+	++TotalFrames;
+}
+
+// ==================== API ====================
+
+bool UProjectileSimulationSubsystem::Register(AShooterProjectile* Projectile)
+{
+	// Bounces and slides go through the component's own handling, which only the managed subclass exposes
+	if (!Projectile || !Cast<UManagedProjectileMovementComponent>(Projectile->ProjectileMovement)
+		|| !CVarProjectileBatchSimulation.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	if (Projectile->SimulationIndex == INDEX_NONE)
+	{
+		Projectile->SimulationIndex = Projectiles.Add(Projectile);
+		++NumManaged;
+		++TotalRegistered;
+	}
+	return true;
+}
+
+void UProjectileSimulationSubsystem::Unregister(AShooterProjectile* Projectile)
+{
+	if (!Projectile || !Projectiles.IsValidIndex(Projectile->SimulationIndex))
+	{
+		return;
+	}
+
+	// Leave a hole rather than swapping: this can be called from inside Simulate, when a hit
+	// returns the projectile to its pool, and the update is still walking the array
+	Projectiles[Projectile->SimulationIndex].Reset();
+	Projectile->SimulationIndex = INDEX_NONE;
+	--NumManaged;
+	bNeedsCompaction = true;
+}
+
+void UProjectileSimulationSubsystem::ReportStats() const
+{
+	const double AvgMs = TotalFrames > 0 ? 1000.0 * TotalSeconds / static_cast<double>(TotalFrames) : 0.0;
+
+	UE_LOG(LogPolarityPerf, Log, TEXT("[PROJECTILE_SIM] managed=%d peak=%d | registered=%llu moves=%llu bounces=%llu slides=%llu stops=%llu | avg=%.3f ms peak=%.3f ms over %llu frames | batch=%d"),
+		NumManaged, PeakManaged, TotalRegistered, TotalMoves, TotalBounces, TotalSlides, TotalStops,
+		AvgMs, PeakSeconds * 1000.0, TotalFrames, CVarProjectileBatchSimulation.GetValueOnGameThread());
+}
+
+// ==================== Internals ====================
+
+void UProjectileSimulationSubsystem::Simulate(AShooterProjectile* Projectile, float DeltaTime)
+{
+	UManagedProjectileMovementComponent* Movement = Cast<UManagedProjectileMovementComponent>(Projectile->ProjectileMovement);
+	USceneComponent* Updated = Movement ? Movement->UpdatedComponent.Get() : nullptr;
+
+	// Stopped (StopSimulating clears the updated component) or switched off: nothing to move
+	if (!Updated || !Movement->bSimulationEnabled || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// Same sub-stepping rule as the component: anything that curves is stepped finely enough to curve
+	const bool bSubStep = Movement->bForceSubStepping || Movement->GetGravityZ() != 0.0f
+		|| (Movement->bIsHomingProjectile && Movement->HomingTargetComponent.IsValid());
+	const float MaxTimeStep = FMath::Max(Movement->MaxSimulationTimeStep, 0.0005f);
+	const int32 MaxIterations = FMath::Max(Movement->MaxSimulationIterations, 1);
+
+	float RemainingTime = DeltaTime;
+	int32 Iterations = 0;
+
+	while (RemainingTime > UE_KINDA_SMALL_NUMBER && Iterations < MaxIterations)
+	{
+		++Iterations;
+
+		// The last permitted iteration takes whatever time is left, as the component does
+		const float TimeTick = (bSubStep && Iterations < MaxIterations) ? FMath::Min(RemainingTime, MaxTimeStep) : RemainingTime;
+		RemainingTime -= TimeTick;
+
+		// The component's own integration: gravity, ComputeHomingAcceleration and the speed limit
+		// through ComputeAcceleration, midpoint move delta
+		const FVector OldVelocity = Movement->Velocity;
+		const FVector MoveDelta = Movement->ComputeMoveDelta(OldVelocity, TimeTick);
+		const FVector NewVelocity = Movement->ComputeVelocity(OldVelocity, TimeTick);
+
+		const FQuat NewRotation = (Movement->bRotationFollowsVelocity && !NewVelocity.IsNearlyZero())
+			? NewVelocity.ToOrientationQuat()
+			: Updated->GetComponentQuat();
+
+		FHitResult Hit(1.0f);
+		Updated->MoveComponent(MoveDelta, NewRotation, Movement->bSweepCollision, &Hit);
+		++TotalMoves;
+		INC_DWORD_STAT(STAT_ProjectileSim_Moves);
+
+		// NotifyHit may have returned the projectile to its pool or stopped it
+		if (!IsValid(Projectile) || Projectile->SimulationIndex == INDEX_NONE || !Movement->UpdatedComponent)
+		{
+			return;
+		}
+
+		// As in the component, a velocity changed by a hit or overlap event is kept
+		if (!Hit.bBlockingHit)
+		{
+			if (Movement->Velocity == OldVelocity)
+			{
+				Movement->Velocity = NewVelocity;
+			}
+			continue;
+		}
+
+		if (Movement->Velocity == OldVelocity)
+		{
+			Movement->Velocity = Hit.Time > UE_KINDA_SMALL_NUMBER ? Movement->ComputeVelocity(OldVelocity, TimeTick * Hit.Time) : OldVelocity;
+		}
+
+		float SubTickTimeRemaining = TimeTick * (1.0f - Hit.Time);
+		const bool bStillFlying = HandleImpact(Movement, Hit, TimeTick, MoveDelta, SubTickTimeRemaining);
+
+		// A bounce or slide event may have returned it as well
+		if (!bStillFlying || !IsValid(Projectile) || Projectile->SimulationIndex == INDEX_NONE || !Movement->UpdatedComponent)
+		{
+			return;
+		}
+
+		// The rest of this step is flown on the bounced velocity
+		RemainingTime += SubTickTimeRemaining;
+	}
+
+	// What replicated movement and GetVelocity read
+	Movement->UpdateComponentVelocity();
+}
+
+bool UProjectileSimulationSubsystem::HandleImpact(UManagedProjectileMovementComponent* Movement, FHitResult& Hit,
+	float TimeSlice, const FVector& MoveDelta, float& SubTickTimeRemaining)
+{
+	if (!Movement->bShouldBounce)
+	{
+		Movement->StopSimulating(Hit);
+		++TotalStops;
+		return false;
+	}
+
+	const FVector OldVelocity = Movement->Velocity;
+	Movement->Velocity = Movement->ComputeManagedBounce(Hit, TimeSlice, MoveDelta);
+	++TotalBounces;
+	Movement->OnProjectileBounce.Broadcast(Hit, OldVelocity);
+
+	// A bounce handler may have stopped or returned it
+	if (!Movement->UpdatedComponent)
+	{
+		return false;
+	}
+
+	Movement->Velocity = Movement->LimitVelocity(Movement->Velocity);
+	if (Movement->Velocity.SizeSquared() < FMath::Square(Movement->BounceVelocityStopSimulatingThreshold))
+	{
+		Movement->StopSimulating(Hit);
+		++TotalStops;
+		return false;
+	}
+
+	// Still heading into the surface (a grazing hit, or too little bounce): slide along it for the
+	// rest of the sub-step, as HandleDeflection does
+	if ((Movement->Velocity.GetSafeNormal() | Hit.Normal) <= 0.01f)
+	{
+		++TotalSlides;
+		if (!Movement->SlideAlongSurface(Hit, SubTickTimeRemaining))
+		{
+			++TotalStops;
+			return false;
+		}
+
+		// The slide used up the rest of the sub-step
+		SubTickTimeRemaining = 0.0f;
+	}
+	return true;
+}
+
+void UProjectileSimulationSubsystem::Compact()
+{
+	bNeedsCompaction = false;
+
+	Projectiles.RemoveAll([](const TWeakObjectPtr<AShooterProjectile>& Projectile) { return !Projectile.IsValid(); });
+	for (int32 i = 0; i < Projectiles.Num(); ++i)
+	{
+		Projectiles[i]->SimulationIndex = i;
+	}
+	NumManaged = Projectiles.Num();
+}
@@ -0,0 +1,104 @@
+// ProjectileSimulationSubsystem.h
+// Moves every active pooled projectile in one update instead of one actor and component tick each
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectileSimulationSubsystem.generated.h"
+
+class AShooterProjectile;
+class UManagedProjectileMovementComponent;
+struct FHitResult;
+
+/**
+ * Pooled projectiles used to fly themselves: every one ticked its actor (EMF steering, the bypass
+ * bolt's target scan) and its UProjectileMovementComponent separately, so 500 rockets in the air
+ * were 1000 tick functions dispatched one by one, each walking the component's general-purpose
+ * path (interpolation, sliding, physics volume lookups) for a straight line with a bit of gravity.
+ *
+ * A projectile taken out of UProjectilePoolSubsystem now registers here instead, and its actor and
+ * movement ticks are switched off (the actor keeps ticking only if its Blueprint has a Tick event).
+ * Once per frame the subsystem runs each projectile's TickFlight (EMF forces, charge homing, target
+ * scans), then integrates and moves all of them, sub-stepped on the component's settings. The
+ * integration is the component's own ComputeMoveDelta and ComputeVelocity (gravity,
+ * ComputeHomingAcceleration, speed limit), and hits go through its ComputeBounceDelta and
+ * HandleSliding, which UManagedProjectileMovementComponent exposes, so bounces, slides and stops
+ * come out the same, OnProjectileBounce and OnProjectileStop included.
+ *
+ * The movement component stays on the actor as the record of the projectile's flight: its
+ * Velocity, homing target and bounce settings are what this reads and writes, so code that steers a
+ * projectile through it (LaunchAt, ApplyEMForces) works the same whether it is managed or not. The
+ * sweep is still the projectile's own MoveComponent, one scene query per projectile per sub-step:
+ * that is what dispatches NotifyHit, and the hit handling every projectile class builds on starts
+ * there. So what is batched is the tick dispatch and the integration, not the collision queries.
+ * Replicated and non-pooled projectiles keep their own ticks.
+ *
+ * The 500-projectile case this was written for has not been measured yet. To measure it, hold 500
+ * pooled projectiles in the air and compare "stat ProjectileSim" and Projectile.SimReport with
+ * Projectile.BatchSimulation at 1 against "stat Game" with it at 0 (it applies to projectiles
+ * activated afterwards). Cost is in "stat ProjectileSim", counters in Projectile.SimReport.
+ */
+UCLASS()
+class POLARITY_API UProjectileSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// ==================== Subsystem Lifecycle ====================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return NumManaged > 0; }
+
+	// ==================== API ====================
+
+	/** Take over flying this projectile. False if batch simulation is off, in which case it flies itself. */
+	bool Register(AShooterProjectile* Projectile);
+
+	/** Stop flying it (back to the pool, or gone). Safe to call from inside a hit this subsystem caused. */
+	void Unregister(AShooterProjectile* Projectile);
+
+	int32 GetNumManaged() const { return NumManaged; }
+
+	/** Lifetime counters to the log (Projectile.SimReport) */
+	void ReportStats() const;
+
+private:
+
+	/** One frame of flight for one projectile, sub-stepped like UProjectileMovementComponent::TickComponent */
+	void Simulate(AShooterProjectile* Projectile, float DeltaTime);
+
+	/**
+	 * Bounce, slide or stop after a blocking hit, through the component's ComputeBounceDelta and
+	 * HandleSliding. SubTickTimeRemaining is what is left of the sub-step to fly on. True if the
+	 * projectile is still flying.
+	 */
+	bool HandleImpact(UManagedProjectileMovementComponent* Movement, FHitResult& Hit, float TimeSlice,
+		const FVector& MoveDelta, float& SubTickTimeRemaining);
+
+	/** Drop the holes Unregister left and renumber what is left */
+	void Compact();
+
+	/** Index is each projectile's SimulationIndex. Unregistered entries are nulled and compacted after the update. */
+	TArray<TWeakObjectPtr<AShooterProjectile>> Projectiles;
+
+	int32 NumManaged = 0;
+	bool bNeedsCompaction = false;
+
+	// Lifetime counters for ReportStats
+	uint64 TotalRegistered = 0;
+	uint64 TotalMoves = 0;
+	uint64 TotalBounces = 0;
+	uint64 TotalSlides = 0;
+	uint64 TotalStops = 0;
+	uint64 TotalFrames = 0;
+	double TotalSeconds = 0.0;
+	double PeakSeconds = 0.0;
+	int32 PeakManaged = 0;
+};
@@ -64,9 +64,9 @@ void AShieldBypassProjectile::LaunchAt(AActor* Target, float Speed, float Damage
 	ProjectileMovement->Velocity = GetActorForwardVector() * Speed;
 }
 
-void AShieldBypassProjectile::Tick(float DeltaSeconds)
+void AShieldBypassProjectile::TickFlight(float DeltaSeconds)
 {
-	Super::Tick(DeltaSeconds);
+	Super::TickFlight(DeltaSeconds);
 
 	// Only the authority hunts. A client's copy follows the replicated flight and must not pick a
 	// different victim than the machine that decides.
@@ -53,7 +53,7 @@ protected:
 	UFUNCTION(NetMulticast, Reliable)
 	void Multicast_PlayImpactVFX(FVector Location);
 
-	virtual void Tick(float DeltaSeconds) override;
+	virtual void TickFlight(float DeltaSeconds) override;
 
 	/** Look for the nearest live enemy within ScanRadius and latch onto it. */
 	void ScanForTarget();
@@ -4,6 +4,8 @@
 #include "ShooterProjectile.h"
 #include "Coop/CoopPlayers.h"
 #include "ProjectilePoolSubsystem.h"
+#include "ProjectileSimulationSubsystem.h"
+#include "ManagedProjectileMovementComponent.h"
 #include "ApexMovementComponent.h"
 #include "Polarity/Variant_Shooter/ShootableButtonComponent.h"
 #include "Components/SphereComponent.h"
@@ -40,7 +42,8 @@ AShooterProjectile::AShooterProjectile()
 	CollisionComponent->CanCharacterStepUpOn = ECanBeCharacterBase::ECB_No;
 
 	// create the projectile movement component. No need to attach it because it's not a Scene Component
-	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(TEXT("Projectile Movement"));
+	// (the managed subclass lets UProjectileSimulationSubsystem reuse its bounce and slide handling)
+	ProjectileMovement = CreateDefaultSubobject<UManagedProjectileMovementComponent>(TEXT("Projectile Movement"));
 
 	ProjectileMovement->InitialSpeed = 3000.0f;
 	ProjectileMovement->MaxSpeed = 3000.0f;
@@ -103,12 +106,25 @@ void AShooterProjectile::BeginPlay()
 
 void AShooterProjectile::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
+	StopManagedFlight();
+
 	Super::EndPlay(EndPlayReason);
 
 	// clear the destruction timer
 	GetWorld()->GetTimerManager().ClearTimer(DestructionTimer);
 }
 
+void AShooterProjectile::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// A managed projectile only ticks for its Blueprint; its steering runs in the simulation update
+	if (!IsSimulatedByManager())
+	{
+		TickFlight(DeltaTime);
+	}
+}
+
 void AShooterProjectile::NotifyHit(class UPrimitiveComponent* MyComp, AActor* Other, class UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit)
 {
 	// ignore if we've already hit something else
@@ -515,10 +531,43 @@ void AShooterProjectile::ActivateFromPool(const FTransform& SpawnTransform, AAct
 	{
 		TrailComponent->Activate(true);
 	}
+
+	StartManagedFlight();
+}
+
+void AShooterProjectile::StartManagedFlight()
+{
+	UProjectileSimulationSubsystem* Sim = GetWorld() ? GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>() : nullptr;
+	if (!Sim || !Sim->Register(this))
+	{
+		return;
+	}
+
+	// The subsystem moves it from here on. The component stays active, as the holder of the velocity
+	// and the settings the subsystem reads, but no longer ticks; the actor only ticks for a Blueprint
+	// Tick event, which would otherwise go silent.
+	ProjectileMovement->SetComponentTickEnabled(false);
+	SetActorTickEnabled(GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AShooterProjectile, ReceiveTick)));
+}
+
+void AShooterProjectile::StopManagedFlight()
+{
+	if (!IsSimulatedByManager())
+	{
+		return;
+	}
+
+	if (UProjectileSimulationSubsystem* Sim = GetWorld() ? GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>() : nullptr)
+	{
+		Sim->Unregister(this);
+	}
+	SimulationIndex = INDEX_NONE;
 }
 
 void AShooterProjectile::DeactivateToPool()
 {
+	StopManagedFlight();
+
 	// Hide actor
 	SetActorHiddenInGame(true);
 	SetActorTickEnabled(false);
@@ -21,6 +21,8 @@ class POLARITY_API AShooterProjectile : public AActor
 {
 	GENERATED_BODY()
 
+	friend class UProjectileSimulationSubsystem;
+
 protected:
 
 	/** Provides collision detection for the projectile */
@@ -134,6 +136,9 @@ protected:
 	/** True if this projectile is managed by the pool system */
 	bool bIsPooled = false;
 
+	/** Slot in UProjectileSimulationSubsystem while it flies this projectile, INDEX_NONE while it flies itself */
+	int32 SimulationIndex = INDEX_NONE;
+
 	/** A shooting client spawns one of these the instant it pulls the trigger so the shot leaves the
 	 *  barrel with no round trip, and asks the server for the real one at the same time. This copy
 	 *  exists to be looked at: it hurts nothing and decides nothing, and the authoritative projectile
@@ -177,6 +182,9 @@ public:
 	/** Called by pool to deactivate projectile for reuse */
 	void DeactivateToPool();
 
+	/** True while UProjectileSimulationSubsystem moves this projectile instead of its movement component */
+	bool IsSimulatedByManager() const { return SimulationIndex != INDEX_NONE; }
+
 protected:
 	
 	/** Gameplay initialization */
@@ -185,6 +193,19 @@ protected:
 	/** Gameplay cleanup */
 	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
+	/** Runs TickFlight, unless the simulation subsystem does */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Per-frame steering before the projectile moves: forces, homing targets. Called from Tick, or
+	 *  by UProjectileSimulationSubsystem right before it moves the projectile. Base does nothing. */
+	virtual void TickFlight(float DeltaTime) {}
+
+	/** Hand the flight to UProjectileSimulationSubsystem if it takes it, or leave it to the movement component */
+	void StartManagedFlight();
+
+	/** Leave UProjectileSimulationSubsystem, if it was flying this projectile */
+	void StopManagedFlight();
+
 	/** Handles collision */
 	virtual void NotifyHit(class UPrimitiveComponent* MyComp, AActor* Other, UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
 
@@ -42,6 +42,8 @@
 #include "Upgrades/UpgradeManagerComponent.h"
 #include "EnemyBeamBoltSubsystem.h"
 #include "VFX/VFXVariantSequenceSubsystem.h"
+#include "VFX/VFXManagerSubsystem.h"
+#include "Pooling/ActorPoolSubsystem.h"
 
 void AShooterWeapon::PlayFireEffectsLocally()
 {
@@ -182,34 +184,12 @@ void AShooterWeapon::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// subscribe to the owner's destroyed delegate
-	GetOwner()->OnDestroyed.AddDynamic(this, &AShooterWeapon::OnOwnerDestroyed);
-
-	// cast the weapon owner
-	WeaponOwner = Cast<IShooterWeaponHolder>(GetOwner());
-	PawnOwner = Cast<APawn>(GetOwner());
-
-	// Cache movement component for Heat System speed calculations
-	if (ACharacter* CharOwner = Cast<ACharacter>(GetOwner()))
-	{
-		CachedMovementComponent = CharOwner->GetCharacterMovement();
-	}
-
-	// NPC optimization: hide first person mesh for non-player owners
-	if (!PawnOwner || !PawnOwner->IsPlayerControlled())
-	{
-		if (FirstPersonMesh)
-		{
-			FirstPersonMesh->SetVisibility(false);
-			FirstPersonMesh->SetComponentTickEnabled(false);
-		}
-	}
-
 	// fill the first ammo clip
 	CurrentBullets = MagazineSize;
 
-	// attach the meshes to the owner
-	WeaponOwner->AttachWeaponMeshes(this);
+	// A pooled weapon begins play parked and ownerless (on clients too, where the pool's flag
+	// never arrives); it binds when it is handed out, or when its owner replicates.
+	BindToOwner();
 
 	// Attach ADS camera to sight socket on the weapon's first person mesh
 	if (ADSCameraComponent && FirstPersonMesh && FirstPersonMesh->DoesSocketExist(ADSSocketName))
@@ -463,8 +443,138 @@ void AShooterWeapon::Tick(float DeltaTime)
 
 void AShooterWeapon::OnOwnerDestroyed(AActor* DestroyedActor)
 {
-	// ensure this weapon is destroyed when the owner is destroyed
-	Destroy();
+	// ensure this weapon is destroyed (or pooled) when the owner is destroyed
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
+void AShooterWeapon::OnRep_Owner()
+{
+	Super::OnRep_Owner();
+
+	// Before BeginPlay the owner is picked up there
+	if (HasActorBegunPlay() && GetOwner() != BoundOwner.Get())
+	{
+		UnbindFromOwner();
+		BindToOwner();
+	}
+}
+
+void AShooterWeapon::BindToOwner()
+{
+	AActor* NewOwner = GetOwner();
+	if (!NewOwner)
+	{
+		return;
+	}
+	BoundOwner = NewOwner;
+
+	// subscribe to the owner's destroyed delegate
+	NewOwner->OnDestroyed.AddUniqueDynamic(this, &AShooterWeapon::OnOwnerDestroyed);
+
+	// cast the weapon owner
+	WeaponOwner = Cast<IShooterWeaponHolder>(NewOwner);
+	PawnOwner = Cast<APawn>(NewOwner);
+
+	// Cache movement component for Heat System speed calculations
+	if (ACharacter* CharOwner = Cast<ACharacter>(NewOwner))
+	{
+		CachedMovementComponent = CharOwner->GetCharacterMovement();
+	}
+
+	// NPC optimization: hide first person mesh for non-player owners
+	if (!PawnOwner || !PawnOwner->IsPlayerControlled())
+	{
+		if (FirstPersonMesh)
+		{
+			FirstPersonMesh->SetVisibility(false);
+			FirstPersonMesh->SetComponentTickEnabled(false);
+		}
+	}
+
+	// attach the meshes to the owner
+	if (WeaponOwner)
+	{
+		WeaponOwner->AttachWeaponMeshes(this);
+	}
+}
+
+void AShooterWeapon::UnbindFromOwner()
+{
+	if (AActor* OldOwner = BoundOwner.Get())
+	{
+		OldOwner->OnDestroyed.RemoveDynamic(this, &AShooterWeapon::OnOwnerDestroyed);
+	}
+	BoundOwner.Reset();
+
+	WeaponOwner = nullptr;
+	PawnOwner = nullptr;
+	CachedMovementComponent = nullptr;
+
+	// AttachWeaponMeshes put the meshes on the holder's sockets
+	const FAttachmentTransformRules RootRule(EAttachmentRule::SnapToTarget, EAttachmentRule::SnapToTarget,
+		EAttachmentRule::KeepRelative, false);
+	if (FirstPersonMesh)
+	{
+		FirstPersonMesh->AttachToComponent(RootComponent, RootRule);
+	}
+	if (ThirdPersonMesh)
+	{
+		ThirdPersonMesh->AttachToComponent(RootComponent, RootRule);
+	}
+}
+
+// ==================== Pooling ====================
+
+void AShooterWeapon::OnPoolActivate()
+{
+	BindToOwner();
+}
+
+void AShooterWeapon::OnPoolDeactivate()
+{
+	StopFiring();
+	CancelReload();
+	GetWorld()->GetTimerManager().ClearTimer(ReloadTimer);
+
+	// The last holder's bindings (burst counting, heat HUD) must not fire for the next one. Only
+	// theirs: anything else listening to this weapon keeps its binding across holders.
+	if (AActor* OldOwner = BoundOwner.Get())
+	{
+		OnShotFired.RemoveAll(OldOwner);
+		OnHeatChanged.RemoveAll(OldOwner);
+
+		TInlineComponentArray<UActorComponent*> OwnerComponents(OldOwner);
+		for (UActorComponent* Component : OwnerComponents)
+		{
+			OnShotFired.RemoveAll(Component);
+			OnHeatChanged.RemoveAll(Component);
+		}
+	}
+
+	UnbindFromOwner();
+}
+
+void AShooterWeapon::OnPoolReset()
+{
+	const AShooterWeapon* Defaults = GetClass()->GetDefaultObject<AShooterWeapon>();
+
+	CurrentBullets = MagazineSize;
+	CurrentHeat = 0.0f;
+	bIsFiring = false;
+	bIsReloading = false;
+	TimeOfLastShot = 0.0f;
+	bWasYanked = false;
+	SourceYankDropClass = nullptr;
+	bHasLimitedAmmo = false;
+	ProjectileClass = Defaults->ProjectileClass;
+	ExternalFireRateMultiplier = Defaults->ExternalFireRateMultiplier;
+	bDeferBeamRelay = false;
+
+	// Shots the last holder fired that are still being traced (a shotgun's pellets, say)
+	if (UEnemyBeamBoltSubsystem* BoltSubsystem = GetWorld()->GetSubsystem<UEnemyBeamBoltSubsystem>())
+	{
+		BoltSubsystem->DropPendingShots(this);
+	}
 }
 
 void AShooterWeapon::ActivateWeapon()
@@ -1728,10 +1838,19 @@ void AShooterWeapon::ApplyHitscanDamage(const FHitResult& Hit, float EnergyMulti
 
 void AShooterWeapon::PerformSimpleHitscan(const FVector& Start, const FVector& Direction, float EnergyMultiplier)
 {
+	UEnemyBeamBoltSubsystem* BoltSys = GetWorld()->GetSubsystem<UEnemyBeamBoltSubsystem>();
+
+	// Nothing an enemy shot does is instant anyway -- its damage waits for the bolt -- so its traces
+	// can wait a frame too. The bolt subsystem runs them async and resolves the shot when they land.
+	if (BoltSys && BoltSys->QueueEnemyShot(this, Start, Direction, EnergyMultiplier))
+	{
+		return;
+	}
+
 	float TraceDistance = MaxHitscanRange * EnergyMultiplier;
 	FVector End = Start + Direction * TraceDistance;
 
-	FCollisionQueryParams QueryParams;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemyHitscan), false);
 	QueryParams.AddIgnoredActor(this);
 	QueryParams.AddIgnoredActor(GetOwner());
 	QueryParams.bReturnPhysicalMaterial = true;
@@ -1744,12 +1863,6 @@ void AShooterWeapon::PerformSimpleHitscan(const FVector& Start, const FVector& D
 
 	float WallDistance = bHitWall ? WallHit.Distance : TraceDistance;
 
-	// Damage non-Pawn damageable actors (e.g. EMFPhysicsProp)
-	if (bHitWall && WallHit.GetActor() && !Cast<APawn>(WallHit.GetActor()) && WallHit.GetActor()->CanBeDamaged())
-	{
-		ApplyHitscanDamage(WallHit, EnergyMultiplier, WallHit.Distance, 0.0f);
-	}
-
 	// --- Trace 2: Pawns (player) via ObjectType query ---
 	// Pawn collision profile blocks ObjectType queries for ECC_Pawn
 	FHitResult PawnHit;
@@ -1760,6 +1873,27 @@ void AShooterWeapon::PerformSimpleHitscan(const FVector& Start, const FVector& D
 	bool bHitPawn = GetWorld()->LineTraceSingleByObjectType(
 		PawnHit, Start, PawnTraceEnd, PawnObjectParams, QueryParams);
 
+	if (BoltSys)
+	{
+		BoltSys->NoteEnemyTraces(PawnOwner ? PawnOwner->GetClass() : GetClass(), 2, /*bAsync*/ false);
+	}
+
+	ResolveSimpleHitscan(Start, Direction, EnergyMultiplier, WallHit, bHitWall, PawnHit, bHitPawn);
+}
+
+void AShooterWeapon::ResolveSimpleHitscan(const FVector& Start, const FVector& Direction, float EnergyMultiplier,
+	const FHitResult& WallHit, bool bHitWall, const FHitResult& PawnHit, bool bHitPawn, float ShotAge)
+{
+	const float TraceDistance = MaxHitscanRange * EnergyMultiplier;
+	const FVector End = Start + Direction * TraceDistance;
+	const float WallDistance = bHitWall ? WallHit.Distance : TraceDistance;
+
+	// Damage non-Pawn damageable actors (e.g. EMFPhysicsProp)
+	if (bHitWall && WallHit.GetActor() && !Cast<APawn>(WallHit.GetActor()) && WallHit.GetActor()->CanBeDamaged())
+	{
+		ApplyHitscanDamage(WallHit, EnergyMultiplier, WallHit.Distance, 0.0f);
+	}
+
 	// --- Always fire a dodgeable traveling BOLT (down the aim line) instead of an instant hitscan ---
 	// EVERY enemy hitscan shot becomes a projectile-like bolt travelling down the aim line at
 	// HitscanBoltSpeed (fast by default). Damage lands only if the player's CURRENT position is
@@ -1788,8 +1922,11 @@ void AShooterWeapon::PerformSimpleHitscan(const FVector& Start, const FVector& D
 
 		if (UEnemyBeamBoltSubsystem* BoltSys = GetWorld() ? GetWorld()->GetSubsystem<UEnemyBeamBoltSubsystem>() : nullptr)
 		{
+			// A shot resolved from async traces is ShotAge old already: the bolt starts that far down
+			// the line, where it would have been had the traces come back at once.
 			BoltSys->RegisterBolt(this, TargetPlayer, Start, Direction, WallDistance,
-				RandSpeed, HitscanBoltLength, HitscanBoltRadius, EnergyMultiplier);
+				RandSpeed, HitscanBoltLength, HitscanBoltRadius, EnergyMultiplier,
+				1.0f, NAME_None, FHitResult(), false, nullptr, ShotAge);
 		}
 
 		// Tracer matches the bolt exactly (same effective Speed/Variance + RandomSeed pushed to Niagara).
@@ -1871,15 +2008,6 @@ void AShooterWeapon::PerformClassicHitscan(const FVector& Start, const FVector&
 	const bool bHitWall = GetWorld()->LineTraceSingleByChannel(WallHit, Start, End, ECC_Visibility, QueryParams);
 	const float WallDistance = bHitWall ? WallHit.Distance : SegmentMaxDistance;
 
-	// Damage non-pawn damageable actors (EMFPhysicsProp, convertible foliage) — same rule as the cone path.
-	// A travelling shot does not do this here: the prop is only hit when the bolt reaches it, so both
-	// the damage and the impact effect wait and are done by the bolt on arrival.
-	if (!bHitscanTravelsAsBolt
-		&& bHitWall && WallHit.GetActor() && !Cast<APawn>(WallHit.GetActor()) && WallHit.GetActor()->CanBeDamaged())
-	{
-		ApplyHitscanDamage(WallHit, RemainingEnergy, WallHit.Distance, 0.0f);
-	}
-
 	// --- Trace 2: thin pawn sweep up to the wall ---
 	// The swept volume is a thin capsule along the ray: SweepRadius units of forgiveness.
 	TArray<FHitResult> PawnHits;
@@ -1895,6 +2023,27 @@ void AShooterWeapon::PerformClassicHitscan(const FVector& Start, const FVector&
 		FCollisionShape::MakeSphere(SweepRadius),
 		QueryParams);
 
+	ResolveClassicHitscan(Start, Direction, RemainingEnergy, ReflectionCount, WallHit, bHitWall, PawnHits);
+}
+
+void AShooterWeapon::ResolveClassicHitscan(const FVector& Start, const FVector& Direction, float RemainingEnergy,
+	int32 ReflectionCount, const FHitResult& WallHit, bool bHitWall, const TArray<FHitResult>& PawnHits,
+	float BoltRandomSeed)
+{
+	const float SegmentMaxDistance = MaxHitscanRange * RemainingEnergy;
+	const FVector End = Start + Direction * SegmentMaxDistance;
+	const float SweepRadius = FMath::Max(InitialWaveRadius, 1.0f);
+	const float WallDistance = bHitWall ? WallHit.Distance : SegmentMaxDistance;
+
+	// Damage non-pawn damageable actors (EMFPhysicsProp, convertible foliage) — same rule as the cone path.
+	// A travelling shot does not do this here: the prop is only hit when the bolt reaches it, so both
+	// the damage and the impact effect wait and are done by the bolt on arrival.
+	if (!bHitscanTravelsAsBolt
+		&& bHitWall && WallHit.GetActor() && !Cast<APawn>(WallHit.GetActor()) && WallHit.GetActor()->CanBeDamaged())
+	{
+		ApplyHitscanDamage(WallHit, RemainingEnergy, WallHit.Distance, 0.0f);
+	}
+
 	UE_LOG(LogTemp, Warning, TEXT("[HITSCAN_DEBUG] === ClassicShot: Start=%s Dir=%s | SweepR=%.1f | Wall=%s dist=%.0f | pawnHits=%d refl=%d"),
 		*Start.ToCompactString(), *Direction.ToCompactString(), SweepRadius,
 		bHitWall ? *GetNameSafe(WallHit.GetActor()) : TEXT("none"),
@@ -1932,7 +2081,14 @@ void AShooterWeapon::PerformClassicHitscan(const FVector& Start, const FVector&
 	// One seed for this shot. The bolt's speed and the tracer's speed are derived from it the same
 	// way (Speed + Variance * sin(Seed)), which is what keeps the streak sitting on the damage
 	// region instead of merely resembling it. Negative means this weapon does not travel.
-	const float BoltRandomSeed = bHitscanTravelsAsBolt ? FMath::FRand() * 1000.0f : -1.0f;
+	if (!bHitscanTravelsAsBolt)
+	{
+		BoltRandomSeed = -1.0f;
+	}
+	else if (BoltRandomSeed < 0.0f)
+	{
+		BoltRandomSeed = FMath::FRand() * 1000.0f;
+	}
 
 	// Filled in below when the shot travels, then handed to the bolt in one place, so a shot on
 	// course to hit nobody is registered the same way as one that is: it still has to arrive
@@ -2178,6 +2334,8 @@ void AShooterWeapon::PerformClassicHitscan(const FVector& Start, const FVector&
 			UGameplayStatics::PlaySoundAtLocation(this, ReflectionSound, WallHit.ImpactPoint, NewEnergy);
 		}
 
+		// A volley relays its pellets' first segments as one call; a bounce is not part of that
+		TGuardValue<bool> RelayReflection(bDeferBeamRelay, false);
 		PerformClassicHitscan(WallHit.ImpactPoint + ReflectedDir * 1.0f, ReflectedDir, NewEnergy, ReflectionCount + 1);
 	}
 }
@@ -2548,16 +2706,13 @@ void AShooterWeapon::SpawnMuzzleFlashEffect()
 	}
 
 	// Spawn attached to muzzle socket so VFX follows weapon movement
-	UNiagaraComponent* MuzzleComp = UNiagaraFunctionLibrary::SpawnSystemAttached(
+	const bool bLocalShooter = PawnOwner && PawnOwner->IsLocallyControlled();
+	UNiagaraComponent* MuzzleComp = UVFXManagerSubsystem::SpawnSystemAttached(
 		VFXToSpawn,
 		FirstPersonMesh,
 		MuzzleSocketName,
-		FVector::ZeroVector,
-		FRotator::ZeroRotator,
 		FVector(MuzzleFlashScale),
-		EAttachLocation::SnapToTarget,
-		true,
-		ENCPoolMethod::None
+		bLocalShooter ? EVFXSignificance::High : EVFXSignificance::Medium
 	);
 
 	if (MuzzleComp)
@@ -2589,6 +2744,12 @@ UNiagaraComponent* AShooterWeapon::SpawnBeamEffect(const FVector& Start, const F
 	UNiagaraComponent* LocalBeam = SpawnBeamEffectLocally(Start, End, EnergyMultiplier,
 		OverrideBoltSpeed, OverrideBoltSpeedVariance, OverrideBoltLength, OverrideRandomSeed);
 
+	// Part of a volley the caller sends on as a whole
+	if (bDeferBeamRelay)
+	{
+		return LocalBeam;
+	}
+
 	if (HasAuthority())
 	{
 		Multicast_PlayBeamEffect(Start, End, EnergyMultiplier,
@@ -2642,15 +2803,25 @@ UNiagaraComponent* AShooterWeapon::SpawnBeamEffectLocally(const FVector& Start,
 	// asset's defaults -- BeamStart and BeamEnd both zero. That is the stray tracer that starts
 	// nowhere near the muzzle and runs off to the horizon, and it shows up on some shots and not
 	// others because it depends on where the frame boundary falls. Set everything, then activate.
-	UNiagaraComponent* BeamComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-		GetWorld(),
+	// A dodgeable bolt's streak is how the victim sees it coming, so it is never culled.
+	EVFXSignificance Significance = EVFXSignificance::Medium;
+	if (OverrideBoltSpeed >= 0.0f)
+	{
+		Significance = EVFXSignificance::Critical;
+	}
+	else if (PawnOwner && PawnOwner->IsLocallyControlled())
+	{
+		Significance = EVFXSignificance::High;
+	}
+
+	UNiagaraComponent* BeamComp = UVFXManagerSubsystem::SpawnSystemAtLocation(
+		this,
 		BeamFX,
 		Start,
 		(End - Start).Rotation(),
 		FVector::OneVector,
-		/*bAutoDestroy*/ true,
 		/*bAutoActivate*/ false,
-		ENCPoolMethod::None
+		Significance
 	);
 
 	if (BeamComp)
@@ -2761,15 +2932,14 @@ void AShooterWeapon::SpawnWaveFronts(const FVector& Start, const FVector& End)
 	float DivergenceAngle = WaveDivergence * MaxDivergenceAngle;
 
 	// ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¡ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¿ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â°ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â²ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â½ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¸ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¼ ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¾ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â´ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â½ÃƒÆ’Ã¢â‚¬ËœÃƒâ€ Ã¢â‚¬â„¢ Niagara ÃƒÆ’Ã¢â‚¬ËœÃƒâ€šÃ‚ÂÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¸ÃƒÆ’Ã¢â‚¬ËœÃƒâ€šÃ‚ÂÃƒÆ’Ã¢â‚¬ËœÃƒÂ¢Ã¢â€šÂ¬Ã…Â¡ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚ÂµÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¼ÃƒÆ’Ã¢â‚¬ËœÃƒâ€ Ã¢â‚¬â„¢ ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â² ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â½ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â°ÃƒÆ’Ã¢â‚¬ËœÃƒÂ¢Ã¢â€šÂ¬Ã‚Â¡ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â°ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â»ÃƒÆ’Ã¢â‚¬ËœÃƒâ€¦Ã¢â‚¬â„¢ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â½ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¾ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¹ ÃƒÆ’Ã¢â‚¬ËœÃƒÂ¢Ã¢â€šÂ¬Ã…Â¡ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Â¾ÃƒÆ’Ã¢â‚¬ËœÃƒÂ¢Ã¢â€šÂ¬Ã‚Â¡ÃƒÆ’Ã‚ÂÃƒâ€šÃ‚ÂºÃƒÆ’Ã‚ÂÃƒâ€šÃ‚Âµ
-	UNiagaraComponent* ConeComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-		GetWorld(),
+	UNiagaraComponent* ConeComp = UVFXManagerSubsystem::SpawnSystemAtLocation(
+		this,
 		WaveFrontFX,
 		Start,
 		Direction.Rotation(),
 		FVector::OneVector,
 		true,
-		true,
-		ENCPoolMethod::None
+		EVFXSignificance::Low
 	);
 
 	if (ConeComp)
@@ -2835,15 +3005,14 @@ void AShooterWeapon::SpawnImpactEffect(const FHitResult& Hit)
 
 	if (ResolvedFX)
 	{
-		UNiagaraComponent* ImpactComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
+		UNiagaraComponent* ImpactComp = UVFXManagerSubsystem::SpawnSystemAtLocation(
+			this,
 			ResolvedFX,
 			Location,
 			Normal.Rotation(),
 			FVector::OneVector,
-			true,
 			false,
-			ENCPoolMethod::None
+			EVFXSignificance::Medium
 		);
 
 		if (ImpactComp)
@@ -2900,15 +3069,14 @@ void AShooterWeapon::SpawnReflectionEffect(const FVector& Location, const FVecto
 		return;
 	}
 
-	UNiagaraComponent* ReflectionComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-		GetWorld(),
+	UNiagaraComponent* ReflectionComp = UVFXManagerSubsystem::SpawnSystemAtLocation(
+		this,
 		ReflectionFX,
 		Location,
 		FRotator::ZeroRotator,
 		FVector::OneVector,
 		true,
-		true,
-		ENCPoolMethod::None
+		EVFXSignificance::Medium
 	);
 
 	if (ReflectionComp)
@@ -11,6 +11,7 @@
 #include "CrosshairConfig.h"
 #include "MovementSettings.h"
 #include "Chaos/ChaosEngineInterface.h"
+#include "Pooling/PoolableActor.h"
 #include "ShooterWeapon.generated.h"
 
 class IShooterWeaponHolder;
@@ -42,7 +43,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWeaponShotFired);
  *  - Z-Factor: Bonus damage when shooting from above (rewards using EMF to gain height)
  */
 UCLASS(abstract)
-class POLARITY_API AShooterWeapon : public AActor
+class POLARITY_API AShooterWeapon : public AActor, public IPoolableActor
 {
 	GENERATED_BODY()
 
@@ -707,8 +708,34 @@ protected:
 	UFUNCTION()
 	void OnOwnerDestroyed(AActor* DestroyedActor);
 
+	/** A pooled weapon replicates with no owner and gains and loses one as NPCs take it */
+	virtual void OnRep_Owner() override;
+
+	/** Hook up to GetOwner(): holder interface, destroyed delegate, mesh attachment. No-op without an owner.
+	 *  Runs from BeginPlay, OnPoolActivate and OnRep_Owner; subclasses cache whatever they need from
+	 *  the owner here (after Super) rather than in BeginPlay, which a pooled weapon runs ownerless. */
+	virtual void BindToOwner();
+
+	/** Undo BindToOwner: meshes back under our own root, owner pointers cleared. Subclasses drop
+	 *  their owner caches here. */
+	virtual void UnbindFromOwner();
+
+	/** Owner BindToOwner hooked up to, so the delegate can be removed after the owner changed */
+	TWeakObjectPtr<AActor> BoundOwner;
+
 public:
 
+	// ==================== IPoolableActor ====================
+
+	/** Nothing to remember: BeginPlay already binds only when there is an owner */
+	virtual void OnPoolCreated() override {}
+	virtual void OnPoolActivate() override;
+	virtual void OnPoolDeactivate() override;
+
+	/** Base weapon state back to the class defaults. Subclasses with runtime state of their own
+	 *  override it (Super first) and clear that too, stopping anything that loops. */
+	virtual void OnPoolReset() override;
+
 	void ActivateWeapon();
 	void DeactivateWeapon();
 	void StartFiring();
@@ -814,11 +841,25 @@ protected:
 	 *  metal reflections, knockback and ionization behave like the cone path. */
 	void PerformClassicHitscan(const FVector& Start, const FVector& Direction, float RemainingEnergy, int32 ReflectionCount);
 
+	/** Everything PerformClassicHitscan does once its wall trace and pawn sweep are in: nearest pawn,
+	 *  damage or bolt, tracer, impact, reflection. Split out so a weapon that puts several rays in
+	 *  the air can run one pawn query for all of them and hand each ray its own hits. BoltRandomSeed
+	 *  is the travelling shot's seed; negative rolls one. */
+	void ResolveClassicHitscan(const FVector& Start, const FVector& Direction, float RemainingEnergy,
+		int32 ReflectionCount, const FHitResult& WallHit, bool bHitWall, const TArray<FHitResult>& PawnHits,
+		float BoltRandomSeed = -1.0f);
+
 	/** NPC simple hitscan: straight line trace without cone sweep.
 	 *  Bypasses the cone-based system which has parallax issues for NPCs
 	 *  (camera and muzzle are at different positions, causing the cone check to reject valid hits). */
 	void PerformSimpleHitscan(const FVector& Start, const FVector& Direction, float EnergyMultiplier);
 
+	/** Everything PerformSimpleHitscan does once its wall trace and pawn trace are in. Split out so
+	 *  UEnemyBeamBoltSubsystem can run those traces async and finish the shot when they land;
+	 *  ShotAge is how long ago the trigger was pulled, and the bolt starts that far along. */
+	void ResolveSimpleHitscan(const FVector& Start, const FVector& Direction, float EnergyMultiplier,
+		const FHitResult& WallHit, bool bHitWall, const FHitResult& PawnHit, bool bHitPawn, float ShotAge = 0.0f);
+
 	bool IsMetal(const FHitResult& Hit) const;
 	FVector CalculateReflection(const FVector& Direction, const FVector& Normal) const;
 	/** ExtraDamageMultiplier carries what a bolt cannot re-derive when it lands: heat, height
@@ -884,6 +925,10 @@ protected:
 		float OverrideBoltSpeed = -1.0f, float OverrideBoltSpeedVariance = -1.0f,
 		float OverrideBoltLength = -1.0f, float OverrideRandomSeed = -1.0f);
 
+	/** While set, SpawnBeamEffect draws on this machine only and leaves the relay to the caller,
+	 *  which sends the whole volley at once (see AShooterWeapon_Shotgun). */
+	bool bDeferBeamRelay = false;
+
 	/** The actual spawn, with no networking. Shared by the local call and the multicast. */
 	UNiagaraComponent* SpawnBeamEffectLocally(const FVector& Start, const FVector& End, float EnergyMultiplier,
 		float OverrideBoltSpeed, float OverrideBoltSpeedVariance,
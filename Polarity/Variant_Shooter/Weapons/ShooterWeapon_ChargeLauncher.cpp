@@ -12,9 +12,15 @@ AShooterWeapon_ChargeLauncher::AShooterWeapon_ChargeLauncher()
 	PrimaryActorTick.bCanEverTick = true;
 }
 
-void AShooterWeapon_ChargeLauncher::BeginPlay()
+void AShooterWeapon_ChargeLauncher::Tick(float DeltaTime)
 {
-	Super::BeginPlay();
+	Super::Tick(DeltaTime);
+	UpdateCharging(DeltaTime);
+}
+
+void AShooterWeapon_ChargeLauncher::BindToOwner()
+{
+	Super::BindToOwner();
 
 	// Cache references to owner's components (same pattern as ShooterWeapon::TryConsumeCharge)
 	if (AActor* OwnerActor = GetOwner())
@@ -24,10 +30,33 @@ void AShooterWeapon_ChargeLauncher::BeginPlay()
 	}
 }
 
-void AShooterWeapon_ChargeLauncher::Tick(float DeltaTime)
+void AShooterWeapon_ChargeLauncher::UnbindFromOwner()
 {
-	Super::Tick(DeltaTime);
-	UpdateCharging(DeltaTime);
+	// The sway override lives on the holder's recoil component; give it back before letting go
+	if (bIsCharging && CachedRecoilComp)
+	{
+		CachedRecoilComp->SetSwayOverrideMultiplier(1.0f);
+	}
+
+	CachedEMFMod = nullptr;
+	CachedRecoilComp = nullptr;
+
+	Super::UnbindFromOwner();
+}
+
+void AShooterWeapon_ChargeLauncher::OnPoolReset()
+{
+	Super::OnPoolReset();
+
+	bIsCharging = false;
+	ChargeStartTime = 0.0f;
+	AccumulatedCharge = 0.0f;
+
+	if (ChargingAudioComponent)
+	{
+		ChargingAudioComponent->Stop();
+		ChargingAudioComponent = nullptr;
+	}
 }
 
 // ==================== Secondary Action ====================
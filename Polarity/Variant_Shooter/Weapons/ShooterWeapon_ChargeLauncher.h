@@ -26,9 +26,13 @@ class POLARITY_API AShooterWeapon_ChargeLauncher : public AShooterWeapon
 public:
 	AShooterWeapon_ChargeLauncher();
 
+	/** A charge in progress is dropped without spawning or refunding anything, and its loop stops */
+	virtual void OnPoolReset() override;
+
 protected:
-	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
+	virtual void BindToOwner() override;
+	virtual void UnbindFromOwner() override;
 
 	// ==================== Secondary Action Overrides ====================
 
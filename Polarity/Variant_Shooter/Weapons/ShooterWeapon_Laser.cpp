@@ -522,6 +522,19 @@ void AShooterWeapon_Laser::DeactivateBeam()
 {
 	bBeamActive = false;
 
+	DestroyBeamComponents();
+
+	// Play stop sound
+	if (BeamStopSound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(this, BeamStopSound, GetActorLocation());
+	}
+
+	CurrentHitActor = nullptr;
+}
+
+void AShooterWeapon_Laser::DestroyBeamComponents()
+{
 	// Destroy beam VFX
 	if (ActiveBeamComponent)
 	{
@@ -542,14 +555,28 @@ void AShooterWeapon_Laser::DeactivateBeam()
 		BeamLoopAudioComponent->Stop();
 		BeamLoopAudioComponent = nullptr;
 	}
+}
 
-	// Play stop sound
-	if (BeamStopSound)
-	{
-		UGameplayStatics::PlaySoundAtLocation(this, BeamStopSound, GetActorLocation());
-	}
+// =============================================================================
+// OnPoolReset - back to a fresh laser for the next holder
+// =============================================================================
+void AShooterWeapon_Laser::OnPoolReset()
+{
+	Super::OnPoolReset();
+
+	const AShooterWeapon_Laser* Defaults = GetClass()->GetDefaultObject<AShooterWeapon_Laser>();
 
+	bBeamActive = false;
+	DestroyBeamComponents();
 	CurrentHitActor = nullptr;
+
+	CurrentHarmonicPhase = ESecondHarmonicPhase::None;
+	HarmonicPhaseElapsedTime = 0.0f;
+	LastHarmonicUseTime = Defaults->LastHarmonicUseTime;
+	bMainBeamWasActive = false;
+	HitActorsBeamA.Empty();
+	HitActorsBeamB.Empty();
+	DestroyHarmonicBeams();
 }
 
 // =============================================================================
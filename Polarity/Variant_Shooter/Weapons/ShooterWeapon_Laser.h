@@ -46,6 +46,9 @@ class POLARITY_API AShooterWeapon_Laser : public AShooterWeapon
 public:
 	AShooterWeapon_Laser();
 
+	/** Beam and Second Harmonic torn down silently, cooldown forgotten */
+	virtual void OnPoolReset() override;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
@@ -228,6 +231,9 @@ private:
 	/** Deactivate beam visuals and audio */
 	void DeactivateBeam();
 
+	/** Destroy the beam and impact VFX and stop the loop, without the stop sound */
+	void DestroyBeamComponents();
+
 	/** Update beam Niagara component endpoints */
 	void UpdateBeamVFX(const FVector& Start, const FVector& End);
 
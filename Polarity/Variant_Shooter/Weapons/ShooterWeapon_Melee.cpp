@@ -58,6 +58,11 @@ void AShooterWeapon_Melee::BeginPlay()
 	{
 		CurrentBullets = MagazineSize;
 	}
+}
+
+void AShooterWeapon_Melee::BindToOwner()
+{
+	Super::BindToOwner();
 
 	// Cache player controller
 	if (PawnOwner)
@@ -72,6 +77,68 @@ void AShooterWeapon_Melee::BeginPlay()
 	}
 }
 
+void AShooterWeapon_Melee::UnbindFromOwner()
+{
+	CachedPlayerController = nullptr;
+	CachedMeleeWeaponFPMesh = nullptr;
+
+	Super::UnbindFromOwner();
+}
+
+void AShooterWeapon_Melee::OnPoolReset()
+{
+	Super::OnPoolReset();
+
+	const AShooterWeapon_Melee* Defaults = GetClass()->GetDefaultObject<AShooterWeapon_Melee>();
+
+	StopSwingTrail();
+
+	VelocityAtSwingStart = FVector::ZeroVector;
+	LastSwingIndex = Defaults->LastSwingIndex;
+	CurrentSwingSide = Defaults->CurrentSwingSide;
+	bIsInCombo = false;
+	bCanComboSwing = true;
+	ComboSpeedMultiplier = Defaults->ComboSpeedMultiplier;
+
+	bDamageWindowActive = false;
+	bHitDuringWindow = false;
+	HitActorsThisSwing.Reset();
+	CurrentSwingData = nullptr;
+
+	MagnetismTarget = nullptr;
+	MagnetismLungeTargetPosition = FVector::ZeroVector;
+	bIsMagnetismActive = false;
+	LungeProgress = 0.0f;
+
+	CoolKickTimeRemaining = 0.0f;
+	CoolKickDirection = FVector::ZeroVector;
+	bIsDropKick = false;
+	DropKickHeightDifference = 0.0f;
+
+	CameraFocusTarget = nullptr;
+	CameraFocusTimeRemaining = 0.0f;
+
+	// Durability comes with the drop it is equipped from (SetRemainingHits, SetBreakData)
+	MaxHitCount = Defaults->MaxHitCount;
+	RemainingHits = Defaults->RemainingHits;
+	BreakGeometryCollection = Defaults->BreakGeometryCollection;
+	BreakImpulse = Defaults->BreakImpulse;
+	BreakAngularImpulse = Defaults->BreakAngularImpulse;
+	BreakGibLifetime = Defaults->BreakGibLifetime;
+
+	// Same bullet counter sync as BeginPlay
+	if (HasLimitedDurability())
+	{
+		MagazineSize = MaxHitCount;
+		CurrentBullets = RemainingHits;
+	}
+	else
+	{
+		MagazineSize = Defaults->MagazineSize;
+		CurrentBullets = MagazineSize;
+	}
+}
+
 void AShooterWeapon_Melee::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
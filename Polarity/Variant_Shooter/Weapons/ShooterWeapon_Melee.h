@@ -94,9 +94,15 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void Fire() override;
+	virtual void BindToOwner() override;
+	virtual void UnbindFromOwner() override;
 
 public:
 	virtual bool IsMeleeWeapon() const override { return true; }
+
+	/** Swing, combo, lunge, kick and camera focus state cleared, trail destroyed, durability and
+	 *  break settings back to the class defaults */
+	virtual void OnPoolReset() override;
 	virtual bool OnSecondaryAction() override;
 	virtual void OnSecondaryActionReleased() override;
 
@@ -3,6 +3,16 @@
 #include "ShooterWeapon_Shotgun.h"
 #include "Variant_Shooter/ShooterCharacter.h"
 #include "GameFramework/Pawn.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarShotgunBatchPellets(
+	TEXT("Shotgun.BatchPellets"),
+	1,
+	TEXT("1=a blast shares one pawn query and one RPC, 0=every pellet is traced and relayed on its own"),
+	ECVF_Default);
 
 AShooterWeapon_Shotgun::AShooterWeapon_Shotgun()
 {
@@ -77,6 +87,20 @@ FVector AShooterWeapon_Shotgun::GetPelletDirection(const FVector& AimDirection,
 		+ Up * (PatternOffset.Y * SpreadTangent)).GetSafeNormal();
 }
 
+FTransform AShooterWeapon_Shotgun::GetPelletTransform(const FTransform& AimTransform, const FVector2D& PatternOffset) const
+{
+	// Same muzzle for every pellet, different direction: they leave one barrel.
+	const FVector PelletDirection = GetPelletDirection(AimTransform.GetRotation().GetForwardVector(), PatternOffset);
+	return FTransform(PelletDirection.Rotation(), AimTransform.GetLocation(), FVector::OneVector);
+}
+
+float AShooterWeapon_Shotgun::GetPelletBoltSeed(FRandomStream& VolleyStream) const
+{
+	// Drawn whether or not it is used, so the shooter and every observer walk the stream in step
+	const float Seed = VolleyStream.FRand() * 1000.0f;
+	return bHitscanTravelsAsBolt ? Seed : -1.0f;
+}
+
 void AShooterWeapon_Shotgun::FireHitscan(const FVector& TargetLocation)
 {
 	// No pattern authored: nothing to spread, and one pellet down the aim line is exactly what the
@@ -95,67 +119,239 @@ void AShooterWeapon_Shotgun::FireHitscan(const FVector& TargetLocation)
 	ResolveHitscanRay(TargetLocation, Start, AimDirection);
 
 	// NPCs trace from the muzzle without the cone filter, exactly as the base class routes them.
+	// Their shots are the server's own, so there is no relay to save and each bolt is aimed at
+	// whoever its own trace finds.
 	const bool bNPCShooter = PawnOwner && !PawnOwner->IsPlayerControlled();
 
-	for (const FVector2D& PatternOffset : PelletPattern)
+	// The volley is a thin-ray thing; a Blueprint that gave this weapon a wave cone goes per pellet
+	const bool bBatch = !bNPCShooter
+		&& CVarShotgunBatchPellets.GetValueOnGameThread() != 0
+		&& WaveDivergence * MaxDivergenceAngle <= KINDA_SMALL_NUMBER;
+
+	if (bBatch)
 	{
-		const FVector PelletDirection = GetPelletDirection(AimDirection, PatternOffset);
+		const int32 VolleySeed = FMath::Rand();
+
+		// Tracers are drawn here as the pellets resolve; everyone else gets the blast as one call
+		bDeferBeamRelay = true;
+		PerformPelletVolley(Start, AimDirection, VolleySeed);
+		bDeferBeamRelay = false;
 
-		if (bNPCShooter)
+		if (HasAuthority())
 		{
-			PerformSimpleHitscan(Start, PelletDirection, 1.0f);
+			Multicast_PlayPelletVolley(Start, AimDirection, VolleySeed);
 		}
-		else
+		else if (AShooterCharacter* OwnerCharacter = Cast<AShooterCharacter>(PawnOwner))
 		{
-			PerformHitscan(Start, PelletDirection, 1.0f, 0);
+			OwnerCharacter->Server_ReportPelletVolley(this, Start, AimDirection, VolleySeed);
 		}
 	}
+	else
+	{
+		for (const FVector2D& PatternOffset : PelletPattern)
+		{
+			const FVector PelletDirection = GetPelletDirection(AimDirection, PatternOffset);
 
-	UE_LOG(LogTemp, Warning, TEXT("[SHOTGUN_DEBUG] %s: %d pellets, spread %.2f deg, %.0f damage each"),
-		*GetName(), PelletPattern.Num(), PelletSpreadAngle, HitscanDamage);
+			if (bNPCShooter)
+			{
+				PerformSimpleHitscan(Start, PelletDirection, 1.0f);
+			}
+			else
+			{
+				PerformHitscan(Start, PelletDirection, 1.0f, 0);
+			}
+		}
+	}
 
 	// Once per trigger pull, not once per pellet.
 	ConsumeRoundAfterShot();
 }
 
-void AShooterWeapon_Shotgun::FireProjectile(const FVector& TargetLocation, float ChargeMultiplier)
+void AShooterWeapon_Shotgun::PerformPelletVolley(const FVector& Start, const FVector& AimDirection, int32 VolleySeed)
 {
-	if (PelletPattern.Num() == 0)
+	UWorld* World = GetWorld();
+	const int32 NumPellets = PelletPattern.Num();
+	const float SweepRadius = FMath::Max(InitialWaveRadius, 1.0f);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShotgunVolley), false);
+	QueryParams.AddIgnoredActor(this);
+	QueryParams.AddIgnoredActor(GetOwner());
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	// --- Walls: one line per pellet, because each of them stops somewhere else ---
+	TArray<FVector, TInlineAllocator<16>> Directions;
+	TArray<FHitResult, TInlineAllocator<16>> WallHits;
+	TArray<bool, TInlineAllocator<16>> HitWall;
+	float Reach = 0.0f;
+	float MaxOffset = 0.0f;
+
+	for (int32 i = 0; i < NumPellets; ++i)
+	{
+		const FVector PelletDirection = GetPelletDirection(AimDirection, PelletPattern[i]);
+		FHitResult& WallHit = WallHits.AddDefaulted_GetRef();
+		const bool bHitWall = World->LineTraceSingleByChannel(
+			WallHit, Start, Start + PelletDirection * MaxHitscanRange, ECC_Visibility, QueryParams);
+
+		Directions.Add(PelletDirection);
+		HitWall.Add(bHitWall);
+		Reach = FMath::Max(Reach, bHitWall ? WallHit.Distance : MaxHitscanRange);
+		MaxOffset = FMath::Max(MaxOffset, static_cast<float>(PelletPattern[i].Size()));
+	}
+
+	// --- Pawns: ONE overlap for the whole blast ---
+	// A pellet is never further off the aim line than Reach * tan(spread) * |offset|, so a capsule
+	// down the aim line that wide (plus the pellet's own sweep radius) holds every body any pellet
+	// can touch. Replaces a scene sweep per pellet.
+	const float BoundRadius = Reach * FMath::Tan(FMath::DegreesToRadians(PelletSpreadAngle)) * MaxOffset + SweepRadius;
+	const float BoundHalfHeight = Reach * 0.5f + BoundRadius;
+	const FVector BoundCentre = Start + AimDirection * (Reach * 0.5f);
+	const FQuat BoundRotation = FRotationMatrix::MakeFromZ(AimDirection).ToQuat();
+
+	FCollisionObjectQueryParams PawnObjectParams;
+	PawnObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(Overlaps, BoundCentre, BoundRotation, PawnObjectParams,
+		FCollisionShape::MakeCapsule(BoundRadius, BoundHalfHeight), QueryParams);
+
+	TArray<UPrimitiveComponent*, TInlineAllocator<16>> Candidates;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		if (UPrimitiveComponent* Component = Overlap.GetComponent())
+		{
+			Candidates.AddUnique(Component);
+		}
+	}
+
+	// --- Per pellet: the usual pawn sweep, but only near those bodies, then resolve exactly like a single thin ray ---
+	// The scene sweep is what returns one hit per body of a skeletal mesh, with its bone name (the
+	// headshot check) and physical material. A pellet that passes no candidate's bounds cannot hit
+	// anything and skips it, which is most pellets of most blasts.
+	FRandomStream VolleyStream(VolleySeed);
+	const FCollisionShape PelletShape = FCollisionShape::MakeSphere(SweepRadius);
+	TArray<FHitResult> PawnHits;
+
+	for (int32 i = 0; i < NumPellets; ++i)
+	{
+		const float WallDistance = HitWall[i] ? WallHits[i].Distance : MaxHitscanRange;
+		const FVector PelletEnd = Start + Directions[i] * WallDistance;
+
+		PawnHits.Reset();
+		const bool bNearCandidate = Candidates.ContainsByPredicate([&](const UPrimitiveComponent* Candidate)
+		{
+			// An instant pellet before this one may have killed it
+			return IsValid(Candidate) && FMath::PointDistToSegment(Candidate->Bounds.Origin, Start, PelletEnd)
+				<= Candidate->Bounds.SphereRadius + SweepRadius;
+		});
+
+		if (bNearCandidate)
+		{
+			World->SweepMultiByObjectType(PawnHits, Start, PelletEnd, FQuat::Identity, PawnObjectParams, PelletShape, QueryParams);
+			PawnHits.RemoveAll([&Candidates](const FHitResult& Hit)
+			{
+				return !Candidates.Contains(Hit.GetComponent());
+			});
+		}
+
+		ResolveClassicHitscan(Start, Directions[i], 1.0f, 0, WallHits[i], HitWall[i], PawnHits,
+			GetPelletBoltSeed(VolleyStream));
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("[SHOTGUN_DEBUG] %s: volley of %d, bound r=%.0f reach=%.0f, %d candidate bodies"),
+		*GetName(), NumPellets, BoundRadius, Reach, Candidates.Num());
+}
+
+void AShooterWeapon_Shotgun::Multicast_PlayPelletVolley_Implementation(FVector_NetQuantize Start,
+	FVector_NetQuantizeNormal AimDirection, int32 VolleySeed)
+{
+	// The shooter drew these as the pellets resolved; a dedicated server draws nothing.
+	if ((PawnOwner && PawnOwner->IsLocallyControlled()) || GetNetMode() == NM_DedicatedServer)
 	{
-		Super::FireProjectile(TargetLocation, ChargeMultiplier);
 		return;
 	}
 
-	// Same muzzle for every pellet, different direction: they leave one barrel.
-	const FTransform AimTransform = CalculateProjectileSpawnTransform(TargetLocation);
-	const FVector AimDirection = AimTransform.GetRotation().GetForwardVector();
+	// From OUR view of the gun, as Multicast_PlayBeamEffect does
+	FVector ObserverStart = Start;
+	if (ThirdPersonMesh)
+	{
+		ObserverStart = ThirdPersonMesh->GetSocketLocation(MuzzleSocketName);
+	}
 
-	AShooterCharacter* OwnerCharacter = Cast<AShooterCharacter>(PawnOwner);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShotgunVolleyCosmetic), false);
+	QueryParams.AddIgnoredActor(this);
+	QueryParams.AddIgnoredActor(GetOwner());
 
+	// Endpoints are where each pellet's line meets the world here; the pellets are already decided
+	// on the shooter's machine, and these streaks are only the picture of them.
+	FRandomStream VolleyStream(VolleySeed);
 	for (const FVector2D& PatternOffset : PelletPattern)
 	{
 		const FVector PelletDirection = GetPelletDirection(AimDirection, PatternOffset);
-		const FTransform PelletTransform(PelletDirection.Rotation(), AimTransform.GetLocation(), FVector::OneVector);
+		FVector End = Start + PelletDirection * MaxHitscanRange;
 
-		if (HasAuthority())
+		FHitResult WallHit;
+		if (GetWorld()->LineTraceSingleByChannel(WallHit, Start, End, ECC_Visibility, QueryParams))
+		{
+			End = WallHit.ImpactPoint;
+		}
+
+		const float BoltSeed = GetPelletBoltSeed(VolleyStream);
+		if (BoltSeed >= 0.0f)
 		{
-			SpawnProjectileAtTransform(PelletTransform, ChargeMultiplier, /*bCosmeticOnly*/ false);
+			SpawnBeamEffectLocally(ObserverStart, End, 1.0f,
+				HitscanBoltSpeed, HitscanBoltSpeedVariance, HitscanBoltLength, BoltSeed);
 		}
 		else
 		{
-			// The same split the base class makes, once per pellet: the shooter sees its own pellet
-			// leave the barrel immediately and asks the server for the real one in the same breath.
-			SpawnProjectileAtTransform(PelletTransform, ChargeMultiplier, /*bCosmeticOnly*/ true);
+			SpawnBeamEffectLocally(ObserverStart, End, 1.0f, -1.0f, -1.0f, -1.0f, -1.0f);
+		}
+	}
+}
+
+void AShooterWeapon_Shotgun::FireProjectile(const FVector& TargetLocation, float ChargeMultiplier)
+{
+	if (PelletPattern.Num() == 0)
+	{
+		Super::FireProjectile(TargetLocation, ChargeMultiplier);
+		return;
+	}
+
+	const FTransform AimTransform = CalculateProjectileSpawnTransform(TargetLocation);
+
+	if (HasAuthority())
+	{
+		SpawnPelletProjectiles(AimTransform, ChargeMultiplier, /*bCosmeticOnly*/ false);
+	}
+	else
+	{
+		// The same split the base class makes: the shooter sees its own pellets leave the barrel
+		// immediately and asks the server for the real ones in the same breath -- once for the
+		// blast, and the server turns the aim into pellets through the same pattern.
+		SpawnPelletProjectiles(AimTransform, ChargeMultiplier, /*bCosmeticOnly*/ true);
 
-			if (OwnerCharacter)
+		if (AShooterCharacter* OwnerCharacter = Cast<AShooterCharacter>(PawnOwner))
+		{
+			if (CVarShotgunBatchPellets.GetValueOnGameThread() != 0)
+			{
+				OwnerCharacter->Server_FirePellets(this, AimTransform, ChargeMultiplier);
+			}
+			else
 			{
-				OwnerCharacter->Server_FireProjectile(this, PelletTransform, ChargeMultiplier);
+				for (const FVector2D& PatternOffset : PelletPattern)
+				{
+					OwnerCharacter->Server_FireProjectile(this, GetPelletTransform(AimTransform, PatternOffset), ChargeMultiplier);
+				}
 			}
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[SHOTGUN_DEBUG] %s: %d projectile pellets, spread %.2f deg"),
-		*GetName(), PelletPattern.Num(), PelletSpreadAngle);
-
 	ConsumeRoundAfterShot();
 }
+
+void AShooterWeapon_Shotgun::SpawnPelletProjectiles(const FTransform& AimTransform, float ChargeMultiplier, bool bCosmeticOnly)
+{
+	for (const FVector2D& PatternOffset : PelletPattern)
+	{
+		SpawnProjectileAtTransform(GetPelletTransform(AimTransform, PatternOffset), ChargeMultiplier, bCosmeticOnly);
+	}
+}
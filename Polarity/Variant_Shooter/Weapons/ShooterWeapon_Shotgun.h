@@ -23,6 +23,12 @@
  *
  * What one shot costs is unchanged: pellets are not rounds. The montage plays once, the recoil kicks
  * once, one round leaves the magazine (see AShooterWeapon::ConsumeRoundAfterShot).
+ *
+ * A blast is also resolved and sent as one thing. The pellets share a single pawn query over the
+ * bound of the whole pattern, and each pellet then tests only the bodies it turned up; the network
+ * carries one RPC per blast (aim and seed, or the aim transform for projectile pellets) and every
+ * machine rebuilds the pellets from the fixed pattern. Shotgun.BatchPellets 0 goes back to tracing
+ * and relaying each pellet on its own.
  */
 UCLASS()
 class POLARITY_API AShooterWeapon_Shotgun : public AShooterWeapon
@@ -41,6 +47,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Shotgun")
 	float GetPelletSpreadAngle() const { return PelletSpreadAngle; }
 
+	/** Every pellet of one blast as a projectile, turned off AimTransform by the pattern. Public
+	 *  because the authoritative ones come from the owning character's Server_FirePellets. */
+	void SpawnPelletProjectiles(const FTransform& AimTransform, float ChargeMultiplier, bool bCosmeticOnly);
+
+	/** Tracers of a blast for everyone but the shooter, rebuilt from the aim line and the seed.
+	 *  Unreliable for the same reason as Multicast_PlayBeamEffect: cosmetic. */
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_PlayPelletVolley(FVector_NetQuantize Start, FVector_NetQuantizeNormal AimDirection, int32 VolleySeed);
+
 protected:
 
 	// ==================== Pattern ====================
@@ -67,4 +82,17 @@ protected:
 	/** The aim line turned by one pattern offset. Returns the aim line unchanged for a centre
 	 *  pellet or a zero spread. */
 	FVector GetPelletDirection(const FVector& AimDirection, const FVector2D& PatternOffset) const;
+
+	/** Resolve every pellet of a player's blast on the thin-ray path: a wall trace per pellet, ONE
+	 *  pawn overlap over the capsule that bounds the pattern out to the farthest wall, then the
+	 *  usual pawn sweep only for pellets that pass within the bounds of a body that overlap found,
+	 *  keeping only those bodies' hits. Each pellet's bolt seed comes from VolleySeed, so the
+	 *  relayed volley draws the same streaks. */
+	void PerformPelletVolley(const FVector& Start, const FVector& AimDirection, int32 VolleySeed);
+
+	/** Where one pellet of a projectile blast leaves from and which way it flies */
+	FTransform GetPelletTransform(const FTransform& AimTransform, const FVector2D& PatternOffset) const;
+
+	/** The seed of one pellet's bolt and tracer; negative if this weapon's shots do not travel */
+	float GetPelletBoltSeed(FRandomStream& VolleyStream) const;
 };
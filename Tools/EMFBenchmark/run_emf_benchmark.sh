@@ -0,0 +1,103 @@
+#!/usr/bin/env bash
+# Headless EMF benchmark runner (Linux). Companion to UEMFBenchmarkSubsystem.
+#
+# Launches the game with -nullrhi on a fixed map, lets UEMFBenchmarkSubsystem spawn
+# the charged NPCs / props / projectiles, capture N frames with the CSV profiler and
+# exit, then copies the CSV next to --out and prints a summary (summarize_emf_csv.py).
+#
+# Usage:
+#   Tools/EMFBenchmark/run_emf_benchmark.sh --engine /opt/UnrealEngine \
+#       [--project /path/Polarity.uproject] [--map /Game/Maps/EMFBenchmark] \
+#       [--npcs 20] [--props 40] [--projectiles 20] [--frames 600] [--seed 1] \
+#       [--npc-class /Game/...BP_X.BP_X_C] [--prop-class ...] [--projectile-class ...] \
+#       [--out emf_benchmark.csv] [--baseline previous.csv] [--threshold 10]
+#
+# With --baseline, exits 1 if mean EMF time regressed by more than --threshold percent.
+#
+# Log filter tag: [EMF_BENCH]
+
+set -euo pipefail
+
+TOOLS_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+
+ENGINE=""
+PROJECT="$(cd "$TOOLS_DIR/../.." && pwd)/Polarity.uproject"
+MAP="/Game/Maps/EMFBenchmark"
+NPCS=20
+PROPS=40
+PROJECTILES=20
+FRAMES=600
+SEED=1
+NPC_CLASS=""
+PROP_CLASS=""
+PROJECTILE_CLASS=""
+OUT="emf_benchmark.csv"
+BASELINE=""
+THRESHOLD=10
+
+while [[ $# -gt 0 ]]; do
+    case "$1" in
+        --engine) ENGINE="$2"; shift 2 ;;
+        --project) PROJECT="$2"; shift 2 ;;
+        --map) MAP="$2"; shift 2 ;;
+        --npcs) NPCS="$2"; shift 2 ;;
+        --props) PROPS="$2"; shift 2 ;;
+        --projectiles) PROJECTILES="$2"; shift 2 ;;
+        --frames) FRAMES="$2"; shift 2 ;;
+        --seed) SEED="$2"; shift 2 ;;
+        --npc-class) NPC_CLASS="$2"; shift 2 ;;
+        --prop-class) PROP_CLASS="$2"; shift 2 ;;
+        --projectile-class) PROJECTILE_CLASS="$2"; shift 2 ;;
+        --out) OUT="$2"; shift 2 ;;
+        --baseline) BASELINE="$2"; shift 2 ;;
+        --threshold) THRESHOLD="$2"; shift 2 ;;
+        -h|--help) sed -n '2,18p' "$0"; exit 0 ;;
+        *) echo "[EMF_BENCH] Unknown argument: $1" >&2; exit 2 ;;
+    esac
+done
+
+if [[ -z "$ENGINE" ]]; then
+    echo "[EMF_BENCH] --engine is required (UE root, containing Engine/Binaries/Linux)" >&2
+    exit 2
+fi
+
+EDITOR="$ENGINE/Engine/Binaries/Linux/UnrealEditor"
+if [[ ! -x "$EDITOR" ]]; then
+    echo "[EMF_BENCH] Not found: $EDITOR" >&2
+    exit 2
+fi
+
+CSV_DIR="$(dirname "$PROJECT")/Saved/Profiling/CSV/EMFBenchmark"
+mkdir -p "$CSV_DIR"
+MARKER="$(mktemp)"
+
+ARGS=(
+    "$PROJECT" "$MAP"
+    -game -nullrhi -nosound -unattended -nosplash -nopause
+    -benchmark -fps=60 -deterministic
+    "-EMFBenchmark=$NPCS,$PROPS,$PROJECTILES,$FRAMES"
+    "-EMFBenchmarkSeed=$SEED"
+    -EMFBenchmarkQuit
+    -log -stdout -FullStdOutLogOutput
+)
+[[ -n "$NPC_CLASS" ]] && ARGS+=("-EMFBenchmarkNPC=$NPC_CLASS")
+[[ -n "$PROP_CLASS" ]] && ARGS+=("-EMFBenchmarkProp=$PROP_CLASS")
+[[ -n "$PROJECTILE_CLASS" ]] && ARGS+=("-EMFBenchmarkProjectile=$PROJECTILE_CLASS")
+
+echo "[EMF_BENCH] $EDITOR ${ARGS[*]}"
+"$EDITOR" "${ARGS[@]}" | grep --line-buffered -E "\[EMF_BENCH\]|Error" || true
+
+# Newest capture written by this run
+CSV="$(find "$CSV_DIR" -name 'EMFBenchmark_*.csv' -newer "$MARKER" -print0 | xargs -0 -r ls -t | head -n 1)"
+rm -f "$MARKER"
+if [[ -z "$CSV" ]]; then
+    echo "[EMF_BENCH] No CSV was written to $CSV_DIR" >&2
+    exit 1
+fi
+
+cp "$CSV" "$OUT"
+echo "[EMF_BENCH] CSV: $OUT"
+
+SUMMARY_ARGS=("$OUT")
+[[ -n "$BASELINE" ]] && SUMMARY_ARGS+=(--baseline "$BASELINE" --threshold "$THRESHOLD")
+python3 "$TOOLS_DIR/summarize_emf_csv.py" "${SUMMARY_ARGS[@]}"
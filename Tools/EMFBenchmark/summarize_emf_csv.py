@@ -0,0 +1,110 @@
+# Summary of an EMF benchmark CSV (written by UEMFBenchmarkSubsystem via the CSV profiler).
+#
+# Prints mean / p50 / p95 / max per frame for EMF time, LOS traces and allocator calls,
+# and optionally compares mean EMF time against a baseline capture.
+#
+# Usage:
+#   python3 Tools/EMFBenchmark/summarize_emf_csv.py run.csv [--baseline old.csv] [--threshold 10]
+#
+# EMF time is ReceiverUpdate + SolverPrepare + SolverSolve: every other EMF timer
+# (source index rebuild, kernel) runs nested inside one of those.
+#
+# Exit code 1 when the mean EMF time is more than --threshold percent above the baseline.
+#
+# Log filter tag: [EMF_BENCH]
+
+import argparse
+import csv
+import sys
+
+EMF_TIME_COLUMNS = ("EMF/ReceiverUpdate", "EMF/SolverPrepare", "EMF/SolverSolve")
+REPORT_COLUMNS = (
+    ("FrameTime", "ms"),
+    ("GameThreadTime", "ms"),
+    ("EMF/ReceiverUpdate", "ms"),
+    ("EMF/SolverPrepare", "ms"),
+    ("EMF/SolverSolve", "ms"),
+    ("EMF/SourceIndexRebuild", "ms"),
+    ("EMF/LOSSyncTraces", ""),
+    ("EMF/LOSAsyncTraces", ""),
+    ("EMF/Mallocs", ""),
+)
+
+
+def is_number(text):
+    try:
+        float(text)
+        return True
+    except ValueError:
+        return False
+
+
+def load(path):
+    """Rows of the capture as {column: float}; the CSV profiler's trailing header/metadata rows are skipped."""
+    with open(path, newline="") as f:
+        reader = csv.reader(f)
+        header = next(reader)
+        rows = []
+        for raw in reader:
+            # Trailing rows (repeated header, [metadata]) start with text
+            if not raw or not is_number(raw[0]):
+                break
+            # Text columns such as EVENTS are left out
+            rows.append({name: float(v) for name, v in zip(header, raw) if is_number(v)})
+    if not rows:
+        sys.exit("[EMF_BENCH] %s: no frames" % path)
+    for row in rows:
+        row["EMF/Total"] = sum(row.get(c, 0.0) for c in EMF_TIME_COLUMNS)
+    return rows
+
+
+def percentile(values, p):
+    ordered = sorted(values)
+    return ordered[min(int(round(p / 100.0 * (len(ordered) - 1))), len(ordered) - 1)]
+
+
+def summarize(rows):
+    summary = {}
+    for column in ("EMF/Total",) + tuple(c for c, _ in REPORT_COLUMNS):
+        values = [r[column] for r in rows if column in r]
+        if values:
+            summary[column] = (sum(values) / len(values), percentile(values, 50), percentile(values, 95), max(values))
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("csv")
+    parser.add_argument("--baseline")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed regression of mean EMF time, percent")
+    args = parser.parse_args()
+
+    rows = load(args.csv)
+    summary = summarize(rows)
+
+    print("[EMF_BENCH] %d frames from %s" % (len(rows), args.csv))
+    print("[EMF_BENCH] %-26s %10s %10s %10s %10s" % ("column", "mean", "p50", "p95", "max"))
+    units = dict(REPORT_COLUMNS)
+    units["EMF/Total"] = "ms"
+    for column, (mean, p50, p95, peak) in summary.items():
+        label = column + (" (%s)" % units[column] if units.get(column) else "")
+        print("[EMF_BENCH] %-26s %10.3f %10.3f %10.3f %10.3f" % (label, mean, p50, p95, peak))
+
+    if not args.baseline:
+        return 0
+
+    base = summarize(load(args.baseline))
+    if "EMF/Total" not in base or base["EMF/Total"][0] <= 0.0:
+        print("[EMF_BENCH] Baseline has no EMF time, nothing to compare")
+        return 0
+
+    change = 100.0 * (summary["EMF/Total"][0] - base["EMF/Total"][0]) / base["EMF/Total"][0]
+    print("[EMF_BENCH] Mean EMF time %.3f ms vs baseline %.3f ms (%+.1f%%)" % (summary["EMF/Total"][0], base["EMF/Total"][0], change))
+    if change > args.threshold:
+        print("[EMF_BENCH] REGRESSION: above the %.1f%% threshold" % args.threshold)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())